@@ -0,0 +1,42 @@
+/**
+ * @file    benchmark.h
+ * @brief   On-Target Microbenchmark Suite ('bench' Console Command)
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * One harness for all before/after numbers. Every case pairs a baseline
+ * against its optimized variant (CRC16 bitwise vs table, PID float vs
+ * Q16.16, snprintf vs the append formatter, W5500 byte vs burst SPI,
+ * SD single vs multi block), runs warmup + measured iterations under the
+ * DWT cycle counter and prints one comparison table. Hardware cases
+ * (SPI, flash, SD) skip themselves when the device is not up.
+ *
+ * Console: 'bench' runs every case, 'bench <name>' runs one.
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include "main.h"
+#include <stdint.h>
+
+/* Iteration defaults - cases override where hardware wear or runtime matters */
+#define BENCH_WARMUP_ITERATIONS     32
+#define BENCH_MEASURED_ITERATIONS   1000
+
+/* Function Declarations */
+
+/**
+ * @brief Run the benchmark suite and print the comparison table
+ * @param name Case name to run, or NULL/empty for all cases
+ */
+void Benchmark_Run(const char *name);
+
+/**
+ * @brief List the registered cases
+ */
+void Benchmark_List(void);
+
+#endif /* BENCHMARK_H */
@@ -0,0 +1,87 @@
+/**
+ * @file    block_pool.h
+ * @brief   Fixed-Block Pool Allocator with High-Water Telemetry
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * O(1) alloc/free over caller-owned static storage via an index
+ * freelist - no heap, no fragmentation, no linear find-free scans.
+ * Each pool tracks its high-water mark and allocation failures, and
+ * every pool registers itself for the 'pools' console report, so a
+ * deployment running close to buffer exhaustion shows up in telemetry
+ * long before connections start being refused.
+ *
+ * Storage and the freelist next[] array are supplied by the caller
+ * (one uint8_t per block), keeping the pool header small and letting
+ * linker placement decide where the blocks live.
+ */
+
+#ifndef BLOCK_POOL_H
+#define BLOCK_POOL_H
+
+#include "main.h"
+#include <stdint.h>
+
+#define BLOCK_POOL_MAX_POOLS        8       // Registry size for the stats report
+#define BLOCK_POOL_NONE             0xFF    // Freelist terminator
+
+typedef struct {
+    const char *name;                   // Pool name for the stats report
+    uint8_t *storage;                   // block_count * block_size bytes
+    uint8_t *next;                      // Freelist links, one per block
+    uint16_t block_size;
+    uint8_t block_count;
+    uint8_t free_head;                  // First free block index
+    uint8_t used;                       // Blocks currently allocated
+    uint8_t high_water;                 // Peak simultaneous allocations
+    uint32_t alloc_total;               // Lifetime successful allocs
+    uint32_t alloc_failures;            // Allocs refused on empty pool
+} BlockPool_t;
+
+/* Function Declarations */
+
+/**
+ * @brief Initialize a pool over caller-owned storage and register it
+ *        for the stats report
+ * @param pool Pool header
+ * @param name Short name shown by BlockPool_PrintStats()
+ * @param storage block_count * block_size bytes
+ * @param next Freelist array, block_count entries
+ * @param block_size Bytes per block
+ * @param block_count Number of blocks (max 254)
+ */
+void BlockPool_Init(BlockPool_t *pool, const char *name, void *storage,
+                    uint8_t *next, uint16_t block_size, uint8_t block_count);
+
+/**
+ * @brief Allocate one block - O(1)
+ * @return Block pointer, or NULL if the pool is exhausted
+ */
+void *BlockPool_Alloc(BlockPool_t *pool);
+
+/**
+ * @brief Return a block to the pool - O(1)
+ * @note  The pointer must have come from BlockPool_Alloc on this pool
+ */
+void BlockPool_Free(BlockPool_t *pool, void *block);
+
+/**
+ * @brief Index of a pool block (for subsystems that address slots by id)
+ * @return Block index, or BLOCK_POOL_NONE if the pointer is not in the pool
+ */
+uint8_t BlockPool_IndexOf(const BlockPool_t *pool, const void *block);
+
+/**
+ * @brief Blocks currently allocated
+ */
+uint8_t BlockPool_Used(const BlockPool_t *pool);
+
+/**
+ * @brief Print usage, high-water mark and failure counts for every
+ *        registered pool ('pools' console command)
+ */
+void BlockPool_PrintStats(void);
+
+#endif /* BLOCK_POOL_H */
@@ -0,0 +1,76 @@
+/**
+ * @file    ch_control_path.h
+ * @brief   Sensor-Tier Resolution and Precompiled Control-Path Dispatch
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * Resolves the active sensor tier once - at boot and whenever sensor
+ * validity, control mode or the sensor configuration changes - and binds
+ * the result into a descriptor of function pointers: which temperature
+ * source the PID reads and which setpoint compensation layer runs. The
+ * 10ms control tick executes the bound path without re-testing
+ * availability flags, and degradation (return sensor lost -> supply
+ * based estimate -> output hold) becomes one atomic descriptor swap
+ * instead of if-chains scattered through every cycle. Rebinding happens
+ * in task context from the 1s sensor pass; the tick only ever follows
+ * the published pointer.
+ */
+
+#ifndef CH_CONTROL_PATH_H
+#define CH_CONTROL_PATH_H
+
+#include "main.h"
+#include <stdint.h>
+
+/* Resolved sensor tiers, best first */
+typedef enum {
+    CONTROL_PATH_TIER_HOLD = 0,         // No usable water sensor - hold output
+    CONTROL_PATH_TIER_ESTIMATED,        // Supply sensor only - estimated return
+    CONTROL_PATH_TIER_DIRECT,           // Return water sensor, no compensation
+    CONTROL_PATH_TIER_COMPENSATED       // Return water + ambient compensation
+} ControlPathTier_t;
+
+typedef float (*ControlPathTempFn)(void);
+typedef float (*ControlPathCompFn)(float setpoint);
+
+/* Bound control path - built by Rebind, read-only for consumers */
+typedef struct {
+    ControlPathTier_t tier;             // Resolved tier
+    uint8_t pid_enabled;                // Tick PID runs at all
+    uint8_t supply_fault_checks;        // Core supply-temp fault scan bound in
+    uint8_t ambient_fault_checks;       // Core ambient fault scan bound in
+    ControlPathTempFn read_control_temp;    // Control temperature source
+    ControlPathCompFn compensate_setpoint;  // Setpoint compensation layer
+} ControlPathDescriptor_t;
+
+/* Function Declarations */
+
+/**
+ * @brief Bind the initial descriptor (call once after TempControl init)
+ */
+void ControlPath_Init(void);
+
+/**
+ * @brief Re-resolve the tier and publish a fresh descriptor
+ */
+void ControlPath_Rebind(void);
+
+/**
+ * @brief Detect availability/mode/config changes and rebind on change
+ *        (task context, rides the 1s sensor pass)
+ */
+void ControlPath_Poll(void);
+
+/**
+ * @brief Currently bound descriptor (safe from the control tick)
+ */
+const ControlPathDescriptor_t* ControlPath_Get(void);
+
+/**
+ * @brief Print the bound tier and rebind statistics
+ */
+void ControlPath_PrintStatus(void);
+
+#endif /* CH_CONTROL_PATH_H */
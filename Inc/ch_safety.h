@@ -60,6 +60,14 @@
  #define SAFETY_OIL_TEMP_TRIP           70     // Emergency shutdown at 70°C
  #define SAFETY_RETURN_WATER_MAX        18     // Maximum return water temp
  #define SAFETY_AMBIENT_CRITICAL        45     // Critical ambient temp
+
+ // Oil thermal model (incremental per-compressor state, Q16.16)
+ #define SAFETY_OIL_EMA_FACTOR          0.25f  // EMA weight per 1s sample
+ #define SAFETY_OIL_RATE_ALPHA          0.30f  // Rate-of-rise filter weight
+ #define SAFETY_OIL_RATE_DERATE         0.20f  // °C/s rise that derates staging
+ #define SAFETY_OIL_DERATE_MARGIN       5.0f   // Derate window below alarm (°C)
+ #define SAFETY_OIL_INTEGRAL_DERATE_MS  10000  // Time above alarm -> derate
+ #define SAFETY_OIL_INTEGRAL_TRIP_MS    30000  // Time above alarm -> trip
  
  // Pressure limits (bar) - Adaptive for hot climate
  #define SAFETY_HIGH_PRESSURE_ALARM     25     // Base high pressure alarm
@@ -223,9 +231,11 @@
  
  // Main processing functions
  void Safety_Process(void);
+ void Safety_TickISR(void);
  void Safety_ProcessFastChecks(void);
  void Safety_ProcessNormalChecks(void);
  void Safety_ProcessSlowChecks(void);
+void Safety_PrintCheckTable(void);
  
  // Temperature monitoring
  void Safety_CheckTemperatures(void);
@@ -233,6 +243,10 @@
  bool Safety_CheckOilTemperature(uint8_t compressor_id);
  bool Safety_CheckReturnWaterTemperature(void);
  bool Safety_CheckAmbientTemperature(void);
+
+ // Oil thermal model (per-compressor EMA, rate of rise, excursion integral)
+ bool Safety_GetOilDerate(uint8_t compressor_id);
+ float Safety_GetOilTempRate(uint8_t compressor_id);
  
  // Pressure monitoring  
  void Safety_CheckPressures(void);
@@ -274,7 +274,24 @@
   * @return true if all stops successful
   */
  bool Staging_StopAllCompressors(void);
- 
+
+ /**
+  * @brief Resume saved running set after a warm restart
+  * @param compressor_mask Bit per compressor that was running
+  * @param comp_elapsed_ms Per-compressor run time at save, milliseconds
+  * @param condenser_mask Bit per condenser bank that was running
+  * @param cond_elapsed_ms Per-condenser run time at save, milliseconds
+  * @param since_start_ms Age of the last compressor start at save
+  * @param since_stop_ms Age of the last compressor stop at save
+  * @return Number of compressors resumed
+  * @note Bypasses the stagger gate and start_cycles - this is a resume
+  *       of an already-running set, not a new start. Each compressor is
+  *       still re-validated through Safety_CanStartCompressor().
+  */
+ uint8_t Staging_WarmRestore(uint8_t compressor_mask, const uint32_t* comp_elapsed_ms,
+                             uint8_t condenser_mask, const uint32_t* cond_elapsed_ms,
+                             uint32_t since_start_ms, uint32_t since_stop_ms);
+
  // === CONDENSER CONTROL FUNCTIONS ===
  /**
   * @brief Start a specific condenser bank
@@ -397,6 +414,18 @@
   * @return Number of currently running condensers
   */
  uint8_t Staging_GetRunningCondenserCount(void);
+
+ /**
+  * @brief Get number of compressor starts queued in the stagger sequencer
+  * @return Pending scheduled starts (0 when no transition in progress)
+  */
+ uint8_t Staging_GetPendingStartCount(void);
+
+ /**
+  * @brief Get time until the next scheduled compressor start
+  * @return Milliseconds until the next start, 0 if none queued
+  */
+ uint32_t Staging_GetNextStartDelayMs(void);
  
  // === DEBUG AND DIAGNOSTICS FUNCTIONS ===
  /**
@@ -424,6 +453,11 @@
   * @brief Print runtime balancing information to debug port
   */
  void Staging_PrintRuntimeBalance(void);
+
+ /**
+  * @brief Print the precomputed staging schedule table to debug port
+  */
+ void Staging_PrintSchedule(void);
  
  /**
   * @brief Test staging system functionality
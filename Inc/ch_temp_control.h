@@ -86,6 +86,11 @@
  #define TEMP_SENSOR_TIMEOUT_MS          10000   // 10 second sensor timeout
  #define TEMP_FAULT_RECOVERY_TIME_MS     30000   // 30 second fault recovery
  #define TEMP_SETPOINT_RAMP_RATE         0.1f    // °C/minute setpoint ramp rate
+
+ // Slow-loop validation constants (off the PID's input path)
+ #define TEMP_STUCK_EPSILON              0.05f   // Changes below this count as frozen
+ #define TEMP_STUCK_TIMEOUT_MS           120000  // Unchanging live sensor declared stuck
+ #define TEMP_DISAGREE_MARGIN            1.0f    // Supply above return by this = disagreement
  
  // ========================================================================
  // TEMPERATURE CONTROL ENUMERATIONS
@@ -115,7 +120,8 @@
      TEMP_FAULT_COOLING_EFFICIENCY,
      TEMP_FAULT_PID_SATURATED,
      TEMP_FAULT_SETPOINT_DEVIATION,
-     TEMP_FAULT_SYSTEM_OVERLOAD
+     TEMP_FAULT_SYSTEM_OVERLOAD,
+     TEMP_FAULT_SENSOR_DISAGREEMENT
  } TempFaultType_t;
  
  // ========================================================================
@@ -237,7 +243,9 @@
  // Main processing functions
  void TempControl_Process(void);
  void TempControl_ProcessSensors(void);
+ void TempControl_ProcessValidation(void);
  void TempControl_ProcessPID(void);
+ void TempControl_TickPID(void);
  void TempControl_ProcessFaultDetection(void);
  
  // Sensor management
@@ -29,7 +29,7 @@ extern "C" {
 #include "main.h"
 
 /* USER CODE BEGIN Includes */
-
+#include "fixed_point.h"
 /* USER CODE END Includes */
 
 /* USER CODE BEGIN Private defines */
@@ -62,6 +62,8 @@ typedef struct {
     float output_max;                   // Maximum output limit
     uint32_t last_update_time;          // Last update timestamp
     bool enabled;                       // Controller enabled flag
+    bool use_fixed_point;               // Run the Q16.16 integer path
+    PIDQ16_t q16;                       // Fixed-point state (mirrors gains)
 } PIDController_t;
 
 // Advanced control parameters
@@ -102,6 +104,7 @@ void PID_SetTunings(PIDController_t* pid, float kp, float ki, float kd);
 void PID_SetOutputLimits(PIDController_t* pid, float min, float max);
 void PID_Reset(PIDController_t* pid);
 void PID_Enable(PIDController_t* pid, bool enabled);
+void PID_EnableFixedPoint(PIDController_t* pid, bool enabled);
 
 // Advanced control functions
 bool ControlAlgorithms_Process(void);
@@ -0,0 +1,58 @@
+/**
+ * @file    control_tick.h
+ * @brief   10 ms Hardware Control Tick Preempting the Comms Superloop
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * Two-level execution model: TIM7 fires every 10 ms at elevated NVIC
+ * priority and runs the deterministic control kernels - the Q-safe PID
+ * update on the published sensor snapshot and the analog trip detection
+ * (high pressure, compressor discharge temperature) with the same
+ * direct-BSRR compressor drop the EXTI fast path uses. However long the
+ * background loop spends inside an SPI burst, an SD re-init or a flash
+ * erase, control jitter is capped at interrupt latency.
+ *
+ * The ISR side never logs, allocates or touches a peripheral driver:
+ * trips latch a cause and post EVENT_SAFETY_TRIP so the safety task does
+ * the alarm/lockout bookkeeping in task context, and PID saturation is
+ * flagged for the temperature task to report. Everything crossing the
+ * boundary goes through the lock-free event queue or single-word flags.
+ */
+
+#ifndef CONTROL_TICK_H
+#define CONTROL_TICK_H
+
+#include "main.h"
+#include <stdint.h>
+
+#define CONTROL_TICK_PERIOD_MS      10
+#define CONTROL_TICK_IRQ_PRIORITY   3   // Above comms DMA/SDMMC, below faults
+
+/* Function Declarations */
+
+/**
+ * @brief Start TIM7 as the 10 ms control tick
+ * @return 1 if the timer is running
+ * @note  Call after the control subsystems are initialized - the first
+ *        tick runs the kernels immediately
+ */
+uint8_t ControlTick_Init(void);
+
+/**
+ * @brief 1 once the tick is running (tasks skip their own PID pass)
+ */
+uint8_t ControlTick_IsActive(void);
+
+/**
+ * @brief TIM7 interrupt body - called from TIM7_IRQHandler
+ */
+void ControlTick_IRQHandler(void);
+
+/**
+ * @brief Print tick count, period jitter and ISR runtime statistics
+ */
+void ControlTick_PrintStats(void);
+
+#endif /* CONTROL_TICK_H */
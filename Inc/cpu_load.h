@@ -0,0 +1,82 @@
+/**
+ * @file    cpu_load.h
+ * @brief   Idle-Time CPU Load Accounting and Per-IRQ Latency Statistics
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * Headroom in numbers instead of vibes. An idle counter in the main
+ * superloop, calibrated at boot against an empty scheduler pass, yields
+ * percent CPU per one-second window: every cycle a task or interrupt
+ * steals shows up as missing idle iterations. Separately, each handler
+ * in stm32h7xx_it.c brackets its body with CpuLoad_IrqEnter/IrqExit so
+ * the DWT cycle counter records per-IRQ entry counts and worst/average
+ * handler duration. Reports land in 'cpuload', Display_SystemStatus()
+ * and (via the shared dispatcher) the TCP CLI.
+ */
+
+#ifndef CPU_LOAD_H
+#define CPU_LOAD_H
+
+#include "main.h"
+#include <stdint.h>
+
+#define CPU_LOAD_WINDOW_MS      1000    // Load accounting window
+#define CPU_LOAD_CAL_MS         20      // Boot calibration spin
+
+/* IRQ slots for the latency statistics (stm32h7xx_it.c handlers) */
+typedef enum {
+    CPU_IRQ_SYSTICK = 0,
+    CPU_IRQ_EXTI0,                      // E-stop
+    CPU_IRQ_EXTI9_5,                    // Phase monitor
+    CPU_IRQ_UART4,                      // HMI
+    CPU_IRQ_UART8,                      // Modbus RTU
+    CPU_IRQ_UART7,                      // Debug console
+    CPU_IRQ_DMA_UART8_RX,
+    CPU_IRQ_DMA_UART7_TX,
+    CPU_IRQ_SPI4,                       // W5500
+    CPU_IRQ_DMA_SPI4_TX,
+    CPU_IRQ_DMA_SPI4_RX,
+    CPU_IRQ_DMA_UART4_RX,
+    CPU_IRQ_SDMMC1,
+    CPU_IRQ_TIM7_TICK,                  // 10ms control tick
+    CPU_IRQ_SLOT_COUNT
+} cpu_irq_slot_t;
+
+/* Function Declarations */
+
+/**
+ * @brief Calibrate the idle baseline: spin the empty scheduler loop for
+ *        CPU_LOAD_CAL_MS (call after Scheduler_Init, before any task is
+ *        registered)
+ */
+void CpuLoad_Calibrate(void);
+
+/**
+ * @brief Count one idle pass; closes the 1s window when due
+ *        (call once per main-loop iteration)
+ */
+void CpuLoad_IdleHook(void);
+
+/**
+ * @brief CPU load of the last completed window, 0-100
+ */
+uint8_t CpuLoad_GetPercent(void);
+
+/**
+ * @brief DWT cycle count at handler entry
+ */
+uint32_t CpuLoad_IrqEnter(void);
+
+/**
+ * @brief Record one handler exit (count, max and total cycles)
+ */
+void CpuLoad_IrqExit(uint8_t slot, uint32_t entry_cycles);
+
+/**
+ * @brief Print load history and the per-IRQ statistics table
+ */
+void CpuLoad_PrintStatus(void);
+
+#endif /* CPU_LOAD_H */
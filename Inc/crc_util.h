@@ -0,0 +1,51 @@
+/**
+ * @file    crc_util.h
+ * @brief   Shared Table-Driven CRC Kernels (CRC8 / CRC16-Modbus / CRC32)
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * One CRC implementation for all protocol and storage paths. The previous
+ * bit-by-bit loops in modbus_sensor.c, hmi.c, flash_config.c and
+ * equipment_config.c ran 8 iterations per byte on every frame; these
+ * kernels use 256-entry lookup tables (built once on first use), and the
+ * CRC32 runs on the STM32H7 hardware CRC unit when available. Same
+ * polynomials and results as before - only faster.
+ */
+
+#ifndef CRC_UTIL_H
+#define CRC_UTIL_H
+
+#include "main.h"
+#include <stdint.h>
+
+/* Function Declarations */
+
+/**
+ * @brief CRC16 (Modbus RTU): poly 0xA001 reflected, init 0xFFFF
+ * @param data Input bytes
+ * @param length Number of bytes
+ * @return CRC16 value (transmit low byte first on Modbus)
+ */
+uint16_t CRC16_Modbus(const uint8_t *data, uint16_t length);
+
+/**
+ * @brief CRC8: poly 0x07, init 0x00 (DWIN HMI command checksum)
+ * @param data Input bytes
+ * @param length Number of bytes
+ * @return CRC8 value
+ */
+uint8_t CRC8_Calculate(const uint8_t *data, uint16_t length);
+
+/**
+ * @brief CRC32 (IEEE 802.3): poly 0xEDB88320 reflected, init 0xFFFFFFFF,
+ *        final XOR - used for config block integrity
+ * @param data Input bytes
+ * @param length Number of bytes
+ * @return CRC32 value
+ * @note  Uses the hardware CRC unit when initialized, software table otherwise
+ */
+uint32_t CRC32_Calculate(const uint8_t *data, uint32_t length);
+
+#endif /* CRC_UTIL_H */
@@ -0,0 +1,54 @@
+/**
+ * @file    dcache_util.h
+ * @brief   D-Cache Maintenance Helpers for DMA Buffers
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * With the Cortex-M7 D-cache enabled, DMA peripherals see memory, not
+ * the cache - so every DMA boundary needs explicit maintenance: clean
+ * (write back) before a peripheral reads a buffer, invalidate after a
+ * peripheral has written one. These helpers round the range out to
+ * whole 32-byte cache lines, which the SCB operations require.
+ */
+
+#ifndef DCACHE_UTIL_H
+#define DCACHE_UTIL_H
+
+#include "main.h"
+
+/* Cortex-M7 cache line size */
+#define DCACHE_LINE_SIZE    32U
+
+/* Alignment attribute for DMA buffers: a buffer that owns its cache
+ * lines outright can be invalidated without clobbering neighbours */
+#define DCACHE_ALIGNED      __attribute__((aligned(DCACHE_LINE_SIZE)))
+
+/**
+ * @brief Write dirty cache lines covering a buffer back to memory
+ *        (call before a DMA peripheral reads the buffer)
+ */
+static inline void DCache_CleanRange(const void *addr, uint32_t size)
+{
+    uint32_t start = (uint32_t)addr & ~(DCACHE_LINE_SIZE - 1U);
+    uint32_t end = ((uint32_t)addr + size + DCACHE_LINE_SIZE - 1U) &
+                   ~(DCACHE_LINE_SIZE - 1U);
+    SCB_CleanDCache_by_Addr((uint32_t*)start, (int32_t)(end - start));
+}
+
+/**
+ * @brief Discard cache lines covering a buffer so the next read fetches
+ *        from memory (call after a DMA peripheral wrote the buffer)
+ * @note  The buffer must be DCACHE_ALIGNED with a line-multiple size,
+ *        otherwise data sharing its first/last line is lost
+ */
+static inline void DCache_InvalidateRange(void *addr, uint32_t size)
+{
+    uint32_t start = (uint32_t)addr & ~(DCACHE_LINE_SIZE - 1U);
+    uint32_t end = ((uint32_t)addr + size + DCACHE_LINE_SIZE - 1U) &
+                   ~(DCACHE_LINE_SIZE - 1U);
+    SCB_InvalidateDCache_by_Addr((uint32_t*)start, (int32_t)(end - start));
+}
+
+#endif /* DCACHE_UTIL_H */
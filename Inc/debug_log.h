@@ -0,0 +1,140 @@
+/**
+ * @file    debug_log.h
+ * @brief   Zero-Allocation Logging Facade with Deferred Formatting
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * Three gates between a log call and the UART. Per-module compile-time
+ * levels turn disabled calls into nothing at all (the level test is a
+ * constant, the compiler drops the call and its format string). Runtime
+ * per-module levels silence the rest without recompiling call sites.
+ * And for hot/ISR contexts, LOG_*_DEFER enqueues just the format string
+ * pointer and up to three raw argument words into a ring - a few stores
+ * - while snprintf runs later in the low-priority log pump task before
+ * transmission.
+ *
+ * Deferred rules: the format string must be a literal (the ring stores
+ * the pointer) and arguments must be integer words - no floats, no
+ * transient char pointers. Scale floats at the call site (e.g. tenths).
+ */
+
+#ifndef DEBUG_LOG_H
+#define DEBUG_LOG_H
+
+#include "main.h"
+#include <stdint.h>
+
+/* Log levels */
+#define LOG_LEVEL_NONE          0
+#define LOG_LEVEL_ERROR         1
+#define LOG_LEVEL_WARN          2
+#define LOG_LEVEL_INFO          3
+#define LOG_LEVEL_DEBUG         4
+
+/* Log modules */
+typedef enum {
+    LOG_MOD_SYS = 0,                    // main, scheduler, boot
+    LOG_MOD_GPIO,                       // gpio_manager
+    LOG_MOD_SAFETY,                     // ch_safety
+    LOG_MOD_CTRL,                       // temp control, staging, core
+    LOG_MOD_FLASH,                      // flash config/journal/async
+    LOG_MOD_NET,                        // W5500, TCP/HTTP servers
+    LOG_MOD_COUNT
+} log_module_t;
+
+/* Per-module compile-time gates. Calls above the gate compile out
+ * entirely - override per build (e.g. -DLOG_COMPILE_LEVEL_NET=1) to
+ * strip verbose paths from release images. */
+#ifndef LOG_COMPILE_LEVEL_SYS
+#define LOG_COMPILE_LEVEL_SYS       LOG_LEVEL_DEBUG
+#endif
+#ifndef LOG_COMPILE_LEVEL_GPIO
+#define LOG_COMPILE_LEVEL_GPIO      LOG_LEVEL_DEBUG
+#endif
+#ifndef LOG_COMPILE_LEVEL_SAFETY
+#define LOG_COMPILE_LEVEL_SAFETY    LOG_LEVEL_DEBUG
+#endif
+#ifndef LOG_COMPILE_LEVEL_CTRL
+#define LOG_COMPILE_LEVEL_CTRL      LOG_LEVEL_DEBUG
+#endif
+#ifndef LOG_COMPILE_LEVEL_FLASH
+#define LOG_COMPILE_LEVEL_FLASH     LOG_LEVEL_DEBUG
+#endif
+#ifndef LOG_COMPILE_LEVEL_NET
+#define LOG_COMPILE_LEVEL_NET       LOG_LEVEL_DEBUG
+#endif
+
+#define LOG_DEFER_RING_SIZE         32      // Power of two (index masking)
+#define LOG_DEFER_MAX_ARGS          3       // Raw words per deferred entry
+#define LOG_PUMP_BATCH              4       // Entries formatted per pump pass
+
+/* Function Declarations */
+
+void DebugLog_Init(void);
+
+/**
+ * @brief Runtime gate: does this module pass this level right now?
+ */
+uint8_t DebugLog_Enabled(uint8_t module, uint8_t level);
+
+/**
+ * @brief Set a module's runtime level (LOG_LEVEL_NONE silences it)
+ */
+void DebugLog_SetLevel(uint8_t module, uint8_t level);
+
+/**
+ * @brief Format and transmit immediately (task context only). Formats
+ *        nothing when the runtime gate rejects the call.
+ */
+void DebugLog_Printf(uint8_t module, uint8_t level, const char *format, ...);
+
+/**
+ * @brief Defer: store format pointer + raw words, format in the pump
+ *        (ISR-safe). Format must be a literal, args integer words.
+ * @return 1 if queued, 0 if gated off or the ring was full
+ */
+uint8_t DebugLog_Defer(uint8_t module, uint8_t level, const char *format,
+                       uint32_t a0, uint32_t a1, uint32_t a2);
+
+/**
+ * @brief Drain a batch of deferred entries through snprintf to the UART
+ *        (register as a low-priority scheduler task)
+ */
+void DebugLog_Pump(void);
+
+/**
+ * @brief Print runtime levels and ring statistics
+ */
+void DebugLog_PrintStatus(void);
+
+/**
+ * @brief Handle 'loglevel <module> <level>' console input
+ */
+void DebugLog_HandleCommand(const char *args);
+
+/* Call-site macros. The gate comparison is a compile-time constant, so
+ * a call above the module's compile gate vanishes along with its format
+ * string. */
+#define LOG_AT(mod, gate, level, ...) \
+    do { if ((level) <= (gate)) DebugLog_Printf((mod), (level), __VA_ARGS__); } while (0)
+#define LOG_DEFER_AT(mod, gate, level, fmt, a0, a1, a2) \
+    do { if ((level) <= (gate)) DebugLog_Defer((mod), (level), (fmt), \
+         (uint32_t)(a0), (uint32_t)(a1), (uint32_t)(a2)); } while (0)
+
+#define LOG_SYS(level, ...)     LOG_AT(LOG_MOD_SYS,    LOG_COMPILE_LEVEL_SYS,    level, __VA_ARGS__)
+#define LOG_GPIO(level, ...)    LOG_AT(LOG_MOD_GPIO,   LOG_COMPILE_LEVEL_GPIO,   level, __VA_ARGS__)
+#define LOG_SAFETY(level, ...)  LOG_AT(LOG_MOD_SAFETY, LOG_COMPILE_LEVEL_SAFETY, level, __VA_ARGS__)
+#define LOG_CTRL(level, ...)    LOG_AT(LOG_MOD_CTRL,   LOG_COMPILE_LEVEL_CTRL,   level, __VA_ARGS__)
+#define LOG_FLASH(level, ...)   LOG_AT(LOG_MOD_FLASH,  LOG_COMPILE_LEVEL_FLASH,  level, __VA_ARGS__)
+#define LOG_NET(level, ...)     LOG_AT(LOG_MOD_NET,    LOG_COMPILE_LEVEL_NET,    level, __VA_ARGS__)
+
+#define LOG_GPIO_DEFER(level, fmt, a0, a1, a2) \
+    LOG_DEFER_AT(LOG_MOD_GPIO, LOG_COMPILE_LEVEL_GPIO, level, fmt, a0, a1, a2)
+#define LOG_SAFETY_DEFER(level, fmt, a0, a1, a2) \
+    LOG_DEFER_AT(LOG_MOD_SAFETY, LOG_COMPILE_LEVEL_SAFETY, level, fmt, a0, a1, a2)
+#define LOG_CTRL_DEFER(level, fmt, a0, a1, a2) \
+    LOG_DEFER_AT(LOG_MOD_CTRL, LOG_COMPILE_LEVEL_CTRL, level, fmt, a0, a1, a2)
+
+#endif /* DEBUG_LOG_H */
@@ -0,0 +1,82 @@
+/**
+ * @file    event_queue.h
+ * @brief   Lock-Free Event Queue Between ISRs and the Main Loop
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * Single queue decoupling interrupt handlers from main-loop consumers:
+ * ISRs post small typed events (Modbus frame received, HMI frame
+ * received, socket event, SD write done), the dispatcher drains the
+ * queue every scheduler pass and wakes the owning task immediately
+ * instead of waiting out its polling period. One choke point for all
+ * ISR-to-task handoffs also gives the profiler a single place to
+ * measure event latency.
+ */
+
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+
+#include "main.h"
+#include <stdint.h>
+
+#define EVENT_QUEUE_SIZE        32      // Power of two (index masking)
+
+/* Event Types */
+typedef enum {
+    EVENT_NONE = 0,
+    EVENT_MODBUS_FRAME_RX,              // UART8 IDLE - slave response complete
+    EVENT_HMI_FRAME_RX,                 // UART4 IDLE - DWIN frame bytes pending
+    EVENT_SOCKET_EVENT,                 // W5500 INTn - socket Sn_IR activity
+    EVENT_SD_WRITE_DONE,                // SDMMC DMA burst complete
+    EVENT_INPUT_EDGE,                   // Debounced digital input changed (value = mask)
+    EVENT_SAFETY_TRIP,                  // Control tick ISR dropped compressors (param = cause)
+    EVENT_FLASH_OP_DONE,                // Async flash op retired (param = op, value = sector)
+    EVENT_TIMER,                        // Callback-less software timer fired (param = timer ID)
+    EVENT_TYPE_COUNT
+} event_type_t;
+
+/* One queued event (8 bytes) */
+typedef struct {
+    uint8_t type;                       // event_type_t
+    uint8_t param;                      // Source-specific (e.g. socket number)
+    uint16_t value;                     // Source-specific (e.g. frame length)
+    uint32_t post_time;                 // Tick when the ISR posted it
+} event_t;
+
+/* Function Declarations */
+
+/**
+ * @brief Reset the queue and its statistics
+ */
+void EventQueue_Init(void);
+
+/**
+ * @brief Post an event (ISR-safe; drops and counts when full)
+ * @param type Event type
+ * @param param Source-specific parameter
+ * @param value Source-specific value
+ * @return 1 if queued, 0 if the queue was full
+ */
+uint8_t EventQueue_Post(event_type_t type, uint8_t param, uint16_t value);
+
+/**
+ * @brief Pop the oldest pending event
+ * @param event Destination (latency statistics update on success)
+ * @return 1 if an event was returned, 0 if the queue is empty
+ */
+uint8_t EventQueue_Pop(event_t *event);
+
+/**
+ * @brief Number of events currently queued
+ */
+uint8_t EventQueue_Pending(void);
+
+/**
+ * @brief Print queue statistics (posted/dropped counts, depth high
+ *        water mark, post-to-dispatch latency)
+ */
+void EventQueue_PrintStatus(void);
+
+#endif /* EVENT_QUEUE_H */
@@ -0,0 +1,79 @@
+/**
+ * @file    fault_intake.h
+ * @brief   Central Fault Intake - Priority Queue and Rate Limiting
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * Faults used to be handled inline where detected: every occurrence
+ * paid for a debug print, a flash alarm record and an HMI refresh on
+ * the spot, and a flapping sensor during a storm could triple the loop
+ * time - exactly when the control system matters most. The intake
+ * decouples detection from fan-out: reporters post into a fixed-size
+ * queue ordered by severity (critical drains before informational, and
+ * evicts it when the queue is full), a per-fault-code token bucket
+ * caps how often one chattering code gets through (suppressed repeats
+ * coalesce onto the queued entry), and the drain task retires a
+ * bounded batch per pass. Worst-case fault-path cost per loop is the
+ * batch size, independent of the storm rate.
+ */
+
+#ifndef FAULT_INTAKE_H
+#define FAULT_INTAKE_H
+
+#include "main.h"
+#include <stdint.h>
+
+/* Severity scale matches FlashConfig_LogAlarm (1 = info, 5 = critical) */
+#define FAULT_SEV_INFO          1
+#define FAULT_SEV_WARNING       2
+#define FAULT_SEV_MEDIUM        3
+#define FAULT_SEV_HIGH          4
+#define FAULT_SEV_CRITICAL      5
+
+#define FAULT_QUEUE_SIZE        16      // Pending fault entries
+#define FAULT_BUCKET_SLOTS      12      // Distinct codes tracked for rate limiting
+#define FAULT_BUCKET_TOKENS     4       // Burst allowance per code
+#define FAULT_BUCKET_REFILL_MS  5000    // One token back per 5 seconds
+#define FAULT_DRAIN_BATCH       2       // Entries retired per drain pass
+
+/* Function Declarations */
+
+/**
+ * @brief Reset the queue, buckets and statistics
+ */
+void FaultIntake_Init(void);
+
+/**
+ * @brief Post a fault occurrence (ISR-safe)
+ *
+ * Costs a token from the code's bucket. When the bucket is empty the
+ * occurrence coalesces onto an already-queued entry for the code (or
+ * is counted as suppressed) - no downstream work happens here either
+ * way; logging and display run from FaultIntake_Process.
+ *
+ * @param code Fault/alarm code
+ * @param severity FAULT_SEV_INFO..FAULT_SEV_CRITICAL
+ * @param value Trigger value for the alarm record
+ * @param description Human-readable description (string literal -
+ *        only the pointer is stored)
+ * @return 1 if queued or coalesced, 0 if dropped
+ */
+uint8_t FaultIntake_Report(uint16_t code, uint8_t severity, float value,
+                           const char *description);
+
+/**
+ * @brief Drain up to FAULT_DRAIN_BATCH entries, highest severity first
+ *
+ * Each retired entry costs one alarm record and one debug line, with
+ * coalesced occurrences folded into both. Runs as a scheduler task.
+ */
+void FaultIntake_Process(void);
+
+/**
+ * @brief Print queue depth, bucket state and intake statistics
+ */
+void FaultIntake_PrintStatus(void);
+
+#endif /* FAULT_INTAKE_H */
@@ -0,0 +1,107 @@
+/**
+ * @file    fixed_point.h
+ * @brief   Q16.16 Fixed-Point Control Kernels (PID, Filter, Moving Average)
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * Integer Q16.16 variants of the control kernels in control_algorithms.c.
+ * The M7 FPU handles the float math fine, but the float paths drag in
+ * float/printf conversions and double-promotion traps; these kernels give
+ * the control tick a deterministic, branch-light integer path suitable
+ * for ITCM. All arithmetic saturates instead of wrapping. A controller
+ * selects the fixed-point path at init via PID_EnableFixedPoint(); the
+ * 'fxbench' console command times both paths with the DWT profiler.
+ *
+ * Q16.16: 32-bit signed, 16 integer bits, 16 fraction bits.
+ * Range +/-32767.9999, resolution ~15.3e-6 - ample for temperatures in
+ * degrees C and outputs in percent.
+ */
+
+#ifndef FIXED_POINT_H
+#define FIXED_POINT_H
+
+#include "main.h"
+#include <stdint.h>
+
+/* Q16.16 type and conversions */
+typedef int32_t q16_t;
+
+#define Q16_SHIFT           16
+#define Q16_ONE             ((q16_t)(1 << Q16_SHIFT))
+#define Q16_MAX             ((q16_t)0x7FFFFFFF)
+#define Q16_MIN             ((q16_t)0x80000000)
+
+#define Q16_FROM_INT(x)     ((q16_t)((x) << Q16_SHIFT))
+#define Q16_FROM_FLOAT(x)   ((q16_t)((x) * 65536.0f))
+#define Q16_TO_FLOAT(x)     ((float)(x) / 65536.0f)
+
+/* Fixed-point PID controller state */
+typedef struct {
+    q16_t kp;                           // Proportional gain (Q16.16)
+    q16_t ki;                           // Integral gain (Q16.16)
+    q16_t kd;                           // Derivative gain (Q16.16)
+    q16_t integral;                     // Integral accumulator
+    q16_t previous_error;               // Previous error value
+    q16_t derivative;                   // Filtered derivative state
+    q16_t output;                       // Controller output
+    q16_t output_min;                   // Minimum output limit
+    q16_t output_max;                   // Maximum output limit
+    uint32_t last_update_time;          // Last update timestamp (ms)
+} PIDQ16_t;
+
+/* Fixed-point running-average state */
+typedef struct {
+    q16_t buffer[16];                   // Sample window
+    int64_t running_sum;                // Sum of the window (no recompute)
+    uint8_t index;                      // Next write position
+    uint8_t count;                      // Valid samples (ramps to 16)
+} MovAvgQ16_t;
+
+/* Sliding-window least-squares trend state. The x axis is the sample
+ * position inside the window (0 = oldest); the four accumulators are
+ * maintained incrementally as samples enter and leave the ring, so the
+ * slope query is a constant-time formula evaluation. */
+#define TRENDQ16_MAX_WINDOW     16      // Largest supported trend window
+
+typedef struct {
+    q16_t window[TRENDQ16_MAX_WINDOW];  // Sample ring (Q16.16)
+    uint8_t window_size;                // Configured window length
+    uint8_t index;                      // Next write position
+    uint8_t count;                      // Valid samples (ramps to size)
+    int64_t sum_y;                      // Sum of y (Q16.16)
+    int64_t sum_xy;                     // Sum of x*y (Q16.16)
+    int32_t sum_x;                      // Sum of x (integer)
+    int32_t sum_x2;                     // Sum of x^2 (integer)
+} TrendQ16_t;
+
+/* Function Prototypes */
+
+/* Saturating Q16.16 arithmetic */
+q16_t Q16_SatAdd(q16_t a, q16_t b);
+q16_t Q16_Mul(q16_t a, q16_t b);
+q16_t Q16_Div(q16_t a, q16_t b);
+
+/* Fixed-point PID */
+void PIDQ16_Init(PIDQ16_t* pid, float kp, float ki, float kd);
+void PIDQ16_SetOutputLimits(PIDQ16_t* pid, float min, float max);
+void PIDQ16_Reset(PIDQ16_t* pid);
+q16_t PIDQ16_Update(PIDQ16_t* pid, q16_t process_value, q16_t setpoint);
+
+/* Fixed-point single-pole low-pass filter (factor in Q16.16, 0..1) */
+q16_t FilterQ16_Update(q16_t* state, q16_t input, q16_t filter_factor);
+
+/* Fixed-point moving average */
+void MovAvgQ16_Init(MovAvgQ16_t* avg);
+q16_t MovAvgQ16_Update(MovAvgQ16_t* avg, q16_t sample);
+
+/* Incremental least-squares trend (slope in Q16.16 per sample) */
+void TrendQ16_Init(TrendQ16_t* trend, uint8_t window_size);
+void TrendQ16_Add(TrendQ16_t* trend, q16_t sample);
+q16_t TrendQ16_Slope(const TrendQ16_t* trend);
+
+/* Benchmark float vs fixed PID with the DWT profiler ('fxbench') */
+void FixedPoint_Benchmark(void);
+
+#endif /* FIXED_POINT_H */
@@ -31,6 +31,9 @@ uint8_t Flash_Init(void);
 uint8_t Flash_ReadID(uint8_t *manufacturer, uint8_t *device_id);
 uint8_t Flash_ReadData(uint32_t address, uint8_t *data, uint16_t length);
 uint8_t Flash_WritePage(uint32_t address, uint8_t *data, uint16_t length);
+uint8_t Flash_EraseSector(uint32_t address);
+uint8_t Flash_WritePageStart(uint32_t address, uint8_t *data, uint16_t length);
+uint8_t Flash_EraseSectorStart(uint32_t address);
 uint8_t Flash_ReadStatusReg(void); // Renamed function
 uint8_t Flash_WaitReady(void);
 uint8_t Flash_WriteEnable(void);
@@ -0,0 +1,77 @@
+/**
+ * @file    flash_async.h
+ * @brief   Background Erase/Program Engine for the 25Q16 SPI Flash
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * Queued, non-blocking persistence: erase and page-program commands are
+ * issued to the chip and then only its BUSY bit is polled from a
+ * scheduler task, instead of spinning in Flash_WaitReady() for up to
+ * 400ms per sector erase. Ops execute strictly in queue order (so an
+ * erase queued before a program into the same sector is safe), and
+ * each completion posts EVENT_FLASH_OP_DONE. Page data is staged into
+ * the queue slot, so the caller's buffer is free the moment the queue
+ * accepts the op.
+ */
+
+#ifndef FLASH_ASYNC_H
+#define FLASH_ASYNC_H
+
+#include "main.h"
+#include <stdint.h>
+
+#define FLASH_ASYNC_QUEUE_DEPTH     6       // Erase + rescues + record + slack
+#define FLASH_ASYNC_MAX_DATA        256     // One flash page per program op
+#define FLASH_ASYNC_OP_TIMEOUT_MS   1000    // Chip stuck-busy giveup
+
+/* Op types (EVENT_FLASH_OP_DONE param) */
+#define FLASH_ASYNC_OP_ERASE        0
+#define FLASH_ASYNC_OP_WRITE        1
+
+/* Function Declarations */
+
+/**
+ * @brief Reset the queue and engine state
+ */
+void FlashAsync_Init(void);
+
+/**
+ * @brief Queue a 4KB sector erase
+ * @param address Any address inside the sector
+ * @return 1 if queued, 0 if the queue is full
+ */
+uint8_t FlashAsync_QueueEraseSector(uint32_t address);
+
+/**
+ * @brief Queue a page program (data is copied into the queue slot)
+ * @param address Page-aligned flash address
+ * @param data Bytes to program
+ * @param length Up to FLASH_ASYNC_MAX_DATA bytes
+ * @return 1 if queued, 0 if the queue is full or length too large
+ */
+uint8_t FlashAsync_QueueWritePage(uint32_t address, const uint8_t *data, uint16_t length);
+
+/**
+ * @brief Engine pump - issues the next op when the chip is idle and
+ *        polls the BUSY bit otherwise (call from the scheduler)
+ */
+void FlashAsync_Process(void);
+
+/**
+ * @brief Is the engine ready to accept ops? (set after Init)
+ */
+uint8_t FlashAsync_IsReady(void);
+
+/**
+ * @brief Queued plus in-flight op count (0 = all persisted)
+ */
+uint8_t FlashAsync_Pending(void);
+
+/**
+ * @brief Print queue state and completion statistics
+ */
+void FlashAsync_PrintStats(void);
+
+#endif /* FLASH_ASYNC_H */
@@ -55,9 +55,21 @@ extern "C" {
 
 /* Configuration Limits ------------------------------------------------------*/
 #define MAX_SENSOR_LOG_ENTRIES          100         // Maximum sensor log entries
-#define MAX_ALARM_LOG_ENTRIES           50          // Maximum alarm log entries  
+#define MAX_ALARM_LOG_ENTRIES           50          // Maximum alarm log entries
 #define MAX_CONFIG_CHANGES              1000        // Configuration change tracking
 
+/* Runtime Counter Deltas ----------------------------------------------------*/
+#define RUNTIME_DELTA_COMPRESSOR        0           // Matches equipment_type 0
+#define RUNTIME_DELTA_CONDENSER         1           // Matches equipment_type 1
+#define RUNTIME_DELTA_SYSTEM            2           // System-level hour tick
+#define RUNTIME_DELTA_COMPACT_COUNT     16          // Deltas outstanding before a forced base save
+
+/* Alarm Compression and Indexing --------------------------------------------*/
+#define ALARM_DEDUP_WINDOW_MS           60000       // Repeats inside this window collapse
+#define ALARM_SEVERITY_SLOTS            6           // Severity values 0-5
+#define ALARM_SOURCE_SLOTS              16          // Indexed equipment IDs 0-15
+#define ALARM_INDEX_NONE                0xFF        // Empty index slot
+
 /* Data Types ----------------------------------------------------------------*/
 
 /**
@@ -151,17 +163,38 @@ typedef struct {
     
 } RuntimeData_t;
 
+/**
+ * @brief Runtime Counter Delta Record
+ *
+ * One journaled increment against the last full RuntimeData_t base
+ * record. Recovery loads the base, then replays every delta appended
+ * after it - a power cut during a base save loses nothing, and one
+ * torn delta costs a single increment, not the counter block.
+ */
+typedef struct {
+    uint8_t equipment_type;             // RUNTIME_DELTA_* category
+    uint8_t equipment_id;               // Equipment index (0 for system)
+    uint16_t delta_starts;              // Starts added since the base
+    uint32_t delta_hours;               // Hours added since the base
+} RuntimeDelta_t;
+
 /**
  * @brief Alarm Log Entry
+ *
+ * Identical alarms (same code/severity/source) arriving within
+ * ALARM_DEDUP_WINDOW_MS collapse into one record: timestamp keeps the
+ * first occurrence, last_timestamp and repeat_count track the storm.
  */
 typedef struct {
-    uint32_t timestamp;                 // Alarm timestamp
+    uint32_t timestamp;                 // First occurrence timestamp
     uint16_t alarm_code;                // Alarm identification code
     uint8_t alarm_severity;             // Alarm severity (1-5)
     uint8_t alarm_source;               // Alarm source (equipment ID)
-    float trigger_value;                // Value that triggered alarm
+    float trigger_value;                // Value that triggered alarm (latest)
     uint8_t system_state;               // System state when alarm occurred
     char alarm_description[32];         // Alarm description text
+    uint32_t last_timestamp;            // Most recent collapsed occurrence
+    uint16_t repeat_count;              // Occurrences folded into this record
 } AlarmLogEntry_t;
 
 /**
@@ -228,6 +261,10 @@ FlashConfig_Status_t FlashConfig_LogAlarm(uint16_t alarm_code, uint8_t severity,
 FlashConfig_Status_t FlashConfig_SaveAlarmLogs(void);
 FlashConfig_Status_t FlashConfig_LoadAlarmLogs(void);
 void FlashConfig_GetLatestAlarm(AlarmLogEntry_t *latest_alarm);
+const AlarmLogEntry_t* FlashConfig_GetLatestAlarmBySeverity(uint8_t severity);
+const AlarmLogEntry_t* FlashConfig_GetLatestAlarmBySource(uint8_t source);
+uint16_t FlashConfig_GetAlarmCountBySeverity(uint8_t severity);
+void FlashConfig_RebuildAlarmIndex(void);
 
 /* === SD CARD INTEGRATION FUNCTIONS === */
 FlashConfig_Status_t FlashConfig_WriteToSDCard(void);
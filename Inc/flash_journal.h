@@ -0,0 +1,114 @@
+/**
+ * @file    flash_journal.h
+ * @brief   Wear-Leveled Config Journal on the 25Q16 SPI Flash
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * Journaled replacement for the fixed-address config writes. Versioned
+ * records are appended one 256-byte page at a time across a rotating
+ * set of 4KB sectors; the newest valid CRC32 record per stream wins at
+ * boot. Spreading writes over 8 sectors multiplies the 100K-cycle
+ * endurance by 128 page slots, and a save is a single page program
+ * instead of an erase-plus-rewrite of the same sector every time.
+ */
+
+#ifndef FLASH_JOURNAL_H
+#define FLASH_JOURNAL_H
+
+#include "main.h"
+#include <stdint.h>
+
+/* Journal region: 8 rotating 4KB sectors above the legacy config layout */
+#define FJOURNAL_BASE_ADDR          0x010000UL
+#define FJOURNAL_SECTOR_SIZE        4096
+#define FJOURNAL_SECTOR_COUNT       8
+#define FJOURNAL_PAGE_SIZE          256
+#define FJOURNAL_TOTAL_PAGES        ((FJOURNAL_SECTOR_SIZE / FJOURNAL_PAGE_SIZE) * FJOURNAL_SECTOR_COUNT)
+
+#define FJOURNAL_MAGIC              0xA55A
+#define FJOURNAL_HEADER_SIZE        16
+#define FJOURNAL_MAX_PAYLOAD        (FJOURNAL_PAGE_SIZE - FJOURNAL_HEADER_SIZE)
+
+/* Record streams - one monotonic sequence shared by all streams */
+#define FJOURNAL_STREAM_USER_CONFIG     0x01
+#define FJOURNAL_STREAM_RUNTIME_DATA    0x02
+#define FJOURNAL_STREAM_RUNTIME_DELTA   0x03    // Small counter deltas against a base record
+
+typedef enum {
+    FJOURNAL_OK = 0,
+    FJOURNAL_ERROR,
+    FJOURNAL_NOT_FOUND,
+    FJOURNAL_TOO_LARGE
+} FJournal_Status_t;
+
+/* 16-byte record header, one record per flash page */
+typedef struct {
+    uint16_t magic;                 // FJOURNAL_MAGIC
+    uint8_t stream;                 // FJOURNAL_STREAM_*
+    uint8_t reserved;
+    uint32_t sequence;              // Monotonic across all streams
+    uint16_t length;                // Payload bytes
+    uint16_t pad;
+    uint32_t crc32;                 // CRC32 over payload
+} FJournal_Header_t;
+
+/* Function Declarations */
+
+/**
+ * @brief Scan the journal region and recover the append position
+ *        (highest valid sequence number across all pages)
+ * @return FJOURNAL_OK always; an empty/corrupt region starts fresh
+ */
+FJournal_Status_t FJournal_Init(void);
+
+/**
+ * @brief Append one record - a single page program, plus a sector erase
+ *        only when rotating into the oldest sector
+ * @param stream FJOURNAL_STREAM_* identifier
+ * @param data Record payload
+ * @param length Payload size, up to FJOURNAL_MAX_PAYLOAD bytes
+ */
+FJournal_Status_t FJournal_Append(uint8_t stream, const void *data, uint16_t length);
+
+/**
+ * @brief Replay the newest valid record of a stream into the caller's buffer.
+ *        A torn newest record (power loss mid-program) falls back to the
+ *        next-newest valid one, so a bad save never costs the stream.
+ * @param stream FJOURNAL_STREAM_* identifier
+ * @param data Destination buffer
+ * @param length Expected payload size (mismatched records are skipped)
+ * @return FJOURNAL_OK, or FJOURNAL_NOT_FOUND if no valid record exists
+ */
+FJournal_Status_t FJournal_ReadLatest(uint8_t stream, void *data, uint16_t length);
+
+/**
+ * @brief Sequence number of the newest record in a stream
+ * @return Sequence number, 0 if the stream has no record yet
+ */
+uint32_t FJournal_GetLatestSequence(uint8_t stream);
+
+/* Per-record callback for FJournal_ReplayStream */
+typedef void (*FJournal_ReplayFn_t)(const void *data, uint16_t length, void *ctx);
+
+/**
+ * @brief Deliver every valid record of a stream with a sequence number
+ *        above the given floor, in ascending sequence order. Torn or
+ *        CRC-failed records are skipped - a crash mid-append costs at
+ *        most the one record that was being programmed.
+ * @param stream FJOURNAL_STREAM_* identifier
+ * @param after_sequence Only records strictly newer than this are replayed
+ * @param handler Called once per record with the verified payload
+ * @param ctx Opaque pointer handed through to the handler
+ * @return Number of records delivered
+ */
+uint16_t FJournal_ReplayStream(uint8_t stream, uint32_t after_sequence,
+                               FJournal_ReplayFn_t handler, void *ctx);
+
+/**
+ * @brief Print journal position and per-stream sequence numbers
+ */
+void FJournal_PrintStatus(void);
+
+#endif /* FLASH_JOURNAL_H */
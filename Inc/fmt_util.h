@@ -0,0 +1,97 @@
+/**
+ * @file    fmt_util.h
+ * @brief   Lightweight Append-Style Formatter for Hot Output Paths
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * Minimal integer/fixed-point/hex string builders for the periodic and
+ * error paths that previously went through newlib's snprintf (thousands
+ * of cycles per call with float support, plus reentrancy concerns).
+ * Every function appends at dst, writes a terminating NUL and returns a
+ * pointer to that NUL, so lines are built by chaining:
+ *
+ *     char *p = msg;
+ *     p = Fmt_Str(p, "Calc=0x");
+ *     p = Fmt_Hex16(p, crc);
+ *
+ * No width/precision parsing, no varargs, no heap - the caller owns the
+ * buffer and must size it for the worst case. snprintf remains the right
+ * tool for cold diagnostics; these are for code that runs every cycle.
+ * The 'fmtbench' console command documents the cycle win with the DWT
+ * profiler.
+ */
+
+#ifndef FMT_UTIL_H
+#define FMT_UTIL_H
+
+#include "main.h"
+#include "fixed_point.h"
+#include <stdint.h>
+
+/* Function Declarations */
+
+/**
+ * @brief Append a NUL-terminated string
+ * @return Pointer to the new terminating NUL
+ */
+char *Fmt_Str(char *dst, const char *src);
+
+/**
+ * @brief Append a single character
+ */
+char *Fmt_Char(char *dst, char c);
+
+/**
+ * @brief Append an unsigned 32-bit decimal
+ */
+char *Fmt_U32(char *dst, uint32_t value);
+
+/**
+ * @brief Append a signed 32-bit decimal
+ */
+char *Fmt_I32(char *dst, int32_t value);
+
+/**
+ * @brief Append a pre-scaled fixed-point decimal, e.g. scaled=-123,
+ *        decimals=1 appends "-12.3"
+ * @param scaled Value multiplied by 10^decimals
+ * @param decimals Digits after the point (0-9)
+ */
+char *Fmt_Fixed(char *dst, int32_t scaled, uint8_t decimals);
+
+/**
+ * @brief Append a Q16.16 value with the given number of decimals
+ */
+char *Fmt_Q16(char *dst, q16_t value, uint8_t decimals);
+
+/**
+ * @brief Append fixed-width uppercase hex (2/4/8 digits)
+ */
+char *Fmt_Hex8(char *dst, uint8_t value);
+char *Fmt_Hex16(char *dst, uint16_t value);
+char *Fmt_Hex32(char *dst, uint32_t value);
+
+/**
+ * @brief Append a space-separated hex dump ("AA BB CC")
+ */
+char *Fmt_HexBytes(char *dst, const uint8_t *data, uint16_t length);
+
+/**
+ * @brief Append a dotted-quad IP address ("192.168.8.100")
+ */
+char *Fmt_IP(char *dst, const uint8_t *ip);
+
+/**
+ * @brief Append a colon-separated MAC address ("00:08:DC:12:34:56")
+ */
+char *Fmt_MAC(char *dst, const uint8_t *mac);
+
+/**
+ * @brief Cycle comparison of snprintf vs the append formatters on a
+ *        representative sensor line ('fmtbench' console command)
+ */
+void Fmt_Benchmark(void);
+
+#endif /* FMT_UTIL_H */
@@ -40,6 +40,12 @@ typedef struct {
 void GPIO_Manager_Init(void);
 void GPIO_InitAllRelays(void);
 void GPIO_InitAllInputs(void);
+void GPIO_InitSafetyEXTI(void);                 // E-stop/phase EXTI fast path
+uint16_t GPIO_GetAndClearSafetyTrips(void);     // Latched EXTI trips (bit n = input n)
+void GPIO_FastTripDropCompressors(void);        // Direct-BSRR compressor drop (ISR-safe)
+void Input_DebounceInit(void);                  // Arm the SysTick debounce engine
+void Input_DebounceTick(void);                  // 1ms tick (SysTick_Handler)
+void Input_GetAndClearEdges(uint16_t *rising, uint16_t *falling);
 
 /* Relay Control Functions */
 void Relay_Set(uint8_t relay_id, uint8_t state);
@@ -48,6 +54,8 @@ void Relay_Toggle(uint8_t relay_id);
 void Relay_AllOff(void);
 
 /* Input Reading Functions */
+uint16_t Relay_GetAll(void);                    // Bitmask of relay states
+void Relay_CommitGroup(uint16_t desired_mask);  // Batched delta commit, one BSRR per port
 uint8_t Input_Read(uint8_t input_id);
 uint8_t Input_ReadDebounced(uint8_t input_id);
 uint16_t Input_ReadAll(void);
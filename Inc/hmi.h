@@ -83,6 +83,11 @@ extern "C" {
 #define HMI_VP_BTN_RESET        0x2002  // Reset button
 #define HMI_VP_BTN_TEST         0x2003  // Test button
 
+// Panel pages (for page-aware VP update scheduling)
+#define HMI_PAGE_MAIN           0       // Main status page
+#define HMI_PAGE_IO             1       // I/O and counters page
+#define HMI_PAGE_ANY            0xFF    // VP visible on every page
+
 // System Status Values
 #define HMI_STATUS_INIT         0x0000
 #define HMI_STATUS_RUNNING      0x0001
@@ -250,6 +255,30 @@ uint8_t HMI_Is_Initialized(void);
 void HMI_Write_VP_Register(uint16_t address, uint16_t value);
 void HMI_Send_Cyclic_Commands(void);  // Add this line
 
+// VP transaction layer (shadow cache, coalesced writes, batched polls)
+uint8_t HMI_VP_Set(uint16_t address, uint16_t value);
+uint8_t HMI_VP_Get(uint16_t address, uint16_t *value);
+uint8_t HMI_VP_InputEdge(uint16_t address, uint16_t *value);
+void HMI_VP_Process(void);
+void HMI_VP_PrintStatus(void);
+
+// Page tracking (fed by received picture-ID and touch frames)
+uint8_t HMI_GetCurrentPage(void);
+uint8_t HMI_PageForVP(uint16_t vp_address);
+
+// Non-blocking TX pipeline (SysTick-driven state machine on UART4)
+uint8_t HMI_TX_Enqueue(const uint8_t *data, uint8_t length, uint8_t gap_ms);
+uint8_t HMI_TX_GetQueueDepth(void);
+uint32_t HMI_TX_GetDroppedFrames(void);
+void HMI_TX_Tick(void);             // Call every 1 ms (SysTick handler)
+void HMI_TxCpltCallback(void);      // UART4 TX complete (from dispatcher)
+
+// Circular-DMA RX pipeline with IDLE-line DWIN frame delimiting
+uint8_t HMI_RX_GetFrame(uint8_t *data);     // data: >= 64 bytes
+uint32_t HMI_RX_GetDroppedFrames(void);
+void HMI_RxEventCallback(uint16_t Size);    // UART4 RX event (from dispatcher)
+void HMI_ErrorCallback(void);               // UART4 error (from dispatcher)
+
 #ifdef __cplusplus
 }
 #endif
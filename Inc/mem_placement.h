@@ -0,0 +1,30 @@
+/**
+ * @file    mem_placement.h
+ * @brief   ITCM/DTCM Placement Attributes for the Hot Control Path
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * The H7B0 carries 64KB ITCM (0x00000000) and 128KB DTCM (0x20000000)
+ * that run at core speed with zero wait states and sit outside the
+ * cache/AXI fabric. Placing the deterministic control kernels and their
+ * working data there decouples control-loop timing from whatever the
+ * comms code does to the caches and the flash interface.
+ *
+ * The linker script must provide the matching output sections - the
+ * standard CubeMX H7 layout: .itcm_text loaded from flash and copied to
+ * ITCM by startup, .dtcm_bss zero-initialized in DTCM.
+ */
+
+#ifndef MEM_PLACEMENT_H
+#define MEM_PLACEMENT_H
+
+/* Hot functions: copied into ITCM at startup, executed zero-wait-state */
+#define ITCM_FUNC   __attribute__((section(".itcm_text")))
+
+/* Hot zero-initialized data: lives in DTCM (CPU-only - never hand DTCM
+ * addresses to DMA peripherals, most masters cannot reach it) */
+#define DTCM_BSS    __attribute__((section(".dtcm_bss")))
+
+#endif /* MEM_PLACEMENT_H */
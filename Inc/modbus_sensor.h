@@ -30,7 +30,58 @@
 // Sensor Count Limits
 #define MAX_SENSORS               8
 
+// Multi-drop bus configuration (up to 6 RS485 devices)
+#define MODBUS_MAX_SLAVES         6
+#define MODBUS_POLL_FAST_MS       5000      // Supply/return temperature board
+#define MODBUS_POLL_SLOW_MS       30000    // Auxiliary sensor boards
+#define MODBUS_BACKOFF_BASE_MS    2000      // First back-off after a dead poll
+#define MODBUS_BACKOFF_MAX_MS     300000   // Back-off ceiling (5 minutes)
+#define MODBUS_DEAD_THRESHOLD     3         // Consecutive failures -> offline
+
+// Non-blocking engine states (advanced by Modbus_System_Process)
+typedef enum {
+    MODBUS_ENGINE_IDLE = 0,       // Bus free, ready for a new request
+    MODBUS_ENGINE_TX,             // Interrupt-driven transmit in progress
+    MODBUS_ENGINE_WAIT_RX,        // RX DMA armed, waiting for IDLE-line frame end
+    MODBUS_ENGINE_RETRY_WAIT,     // Non-blocking back-off before retry
+    MODBUS_ENGINE_ERROR           // UART error - engine recovers next process call
+} ModbusEngineState_t;
+
+// Pending request type (selects the response parser)
+typedef enum {
+    MODBUS_REQ_NONE = 0,
+    MODBUS_REQ_ALL_DATA,
+    MODBUS_REQ_SENSOR_COUNT,
+    MODBUS_REQ_TEMPERATURES,
+    MODBUS_REQ_STATUS
+} ModbusRequestType_t;
+
+// Per-slave polling state and health statistics
+typedef struct {
+    uint8_t address;                    // Slave address on the bus
+    uint8_t enabled;                    // Slot participates in polling
+    uint8_t online;                     // Responding (cleared after repeated failures)
+    uint32_t poll_interval;             // Base polling period (ms)
+    uint32_t next_poll_time;            // Earliest next poll (tick)
+    uint32_t backoff_ms;                // Current exponential back-off (0 = healthy)
+    uint8_t consecutive_failures;       // Failed polls since last good response
+    uint32_t responses;                 // Good responses
+    uint32_t errors;                    // Retries + failed polls
+    uint32_t response_time_avg;         // EMA of request-to-response time (ms)
+    uint32_t response_time_max;         // Worst response time (ms)
+    uint8_t use_split_reads;            // Device rejected the block read (exception)
+    uint8_t split_phase;                // 0=count, 1=temperatures, 2=status
+    // Last good data from this slave
+    float temperatures[MAX_SENSORS];
+    uint16_t status_bitmap;
+    uint16_t uptime;
+    uint16_t error_count;
+    uint8_t sensor_count;
+} ModbusSlave_t;
+
 // Function Prototypes
+// NOTE: The Read_* functions are non-blocking - they queue a request and return
+// cached values; results are updated when the response frame arrives.
 uint8_t Modbus_Init(void);
 void Modbus_ProcessCommunication(void);
 void Modbus_Debug_Status(void);
@@ -40,6 +91,11 @@ uint8_t Modbus_Read_Status(uint16_t *status, uint16_t *error_count);
 uint8_t Modbus_Read_SensorCount(uint8_t *count);
 uint8_t Modbus_Read_Uptime(uint16_t *uptime);
 
+// Interrupt callbacks (dispatched from uart_comm.c HAL callbacks)
+void Modbus_TxCpltCallback(void);
+void Modbus_RxEventCallback(uint16_t size);
+void Modbus_ErrorCallback(void);
+
 // Utility: Convert register value to temperature
 float Modbus_Decode_Temperature(uint16_t reg_value);
 
@@ -52,6 +108,12 @@ void Modbus_System_Enable(void);
 void Modbus_System_Disable(void);
 void Modbus_System_SetInterval(uint32_t interval_ms);  // Add this line
 
+// Multi-drop slave scheduler
+uint8_t Modbus_Slave_Configure(uint8_t index, uint8_t address, uint32_t poll_interval_ms);
+const ModbusSlave_t* Modbus_Slave_Get(uint8_t index);
+uint8_t Modbus_Slave_HealthScore(uint8_t index);    // 0-100
+void Modbus_PrintSlaveTable(void);                  // 'mb_slaves' console command
+
 // Modbus Sensor Data Structure
 typedef struct {
     float value;
@@ -62,4 +124,22 @@ typedef struct {
 // Function to get sensor data
 uint8_t ModbusSensor_GetSensorData(uint8_t sensor_id, ModbusSensorData_t* sensor_data);
 
+// Published sensor snapshot: one coherent, dated view per poll cycle.
+// Swapped atomically (double buffer) when the primary slave's cycle
+// completes, so consumers never see a half-updated register block.
+#define MODBUS_SNAPSHOT_MAX_AGE_MS  15000   // Older snapshots count as stale
+
+typedef struct {
+    float temperatures[MAX_SENSORS];    // Decoded temperatures (A0-A7)
+    uint16_t valid_mask;                // Bit n = sensor n plausible this cycle
+    uint8_t sensor_count;               // Slave-reported active sensor count
+    uint16_t status_bitmap;             // Slave status register
+    uint16_t error_count;               // Slave error counter
+    uint32_t timestamp;                 // Tick when the poll cycle completed
+    uint32_t sequence;                  // Publication counter (0 = never published)
+} ModbusSnapshot_t;
+
+const ModbusSnapshot_t* Modbus_GetSnapshot(void);   // Single pointer read
+uint32_t Modbus_SnapshotAge(void);                  // ms since publication
+
 #endif /* MODBUS_SENSOR_H */
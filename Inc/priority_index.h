@@ -0,0 +1,58 @@
+/**
+ * @file    priority_index.h
+ * @brief   Incrementally Maintained Priority Ordering for Equipment Selection
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * Keeps a small set of units (compressors, condenser banks) ordered by a
+ * priority score, updated only when a unit's score actually changes.
+ * Runtime hours and fault states move slowly, so the staging selection
+ * paths no longer rescore and re-sort every unit per evaluation: the
+ * "next unit to start/stop" query is a walk from one end of an already
+ * sorted array, which at 8-16 units is effectively a pointer read.
+ *
+ * Ordering is ascending by score. Callers decide what the score means
+ * (runtime minutes, weighted hybrid score, ...) and which end to query.
+ */
+
+#ifndef PRIORITY_INDEX_H
+#define PRIORITY_INDEX_H
+
+#include "main.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define PRIORITY_INDEX_MAX_UNITS    16      // Largest supported unit set
+#define PRIORITY_INDEX_NONE         0xFF    // No eligible unit found
+
+/* Per-query eligibility filter (availability, running state, mode) */
+typedef bool (*PriorityIndexEligible_fn)(uint8_t unit);
+
+typedef struct {
+    uint8_t order[PRIORITY_INDEX_MAX_UNITS];    // Unit ids, ascending score
+    float scores[PRIORITY_INDEX_MAX_UNITS];     // Current score per unit id
+    uint8_t count;                              // Units in the index
+    uint32_t reorder_count;                     // Position changes (diagnostics)
+} PriorityIndex_t;
+
+/* Build an identity ordering over unit_count units with zero scores */
+void PriorityIndex_Init(PriorityIndex_t* index, uint8_t unit_count);
+
+/* Update one unit's score; repositions only that unit, and only when
+ * the score change actually moves it. Returns true if the order moved. */
+bool PriorityIndex_UpdateScore(PriorityIndex_t* index, uint8_t unit, float score);
+
+/* Lowest-score unit passing the filter (PRIORITY_INDEX_NONE if none) */
+uint8_t PriorityIndex_FirstEligible(const PriorityIndex_t* index,
+                                    PriorityIndexEligible_fn eligible);
+
+/* Highest-score unit passing the filter (PRIORITY_INDEX_NONE if none) */
+uint8_t PriorityIndex_LastEligible(const PriorityIndex_t* index,
+                                   PriorityIndexEligible_fn eligible);
+
+/* Current score for a unit (0.0f if out of range) */
+float PriorityIndex_GetScore(const PriorityIndex_t* index, uint8_t unit);
+
+#endif /* PRIORITY_INDEX_H */
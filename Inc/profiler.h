@@ -0,0 +1,89 @@
+/**
+ * @file    profiler.h
+ * @brief   DWT Cycle-Counter Profiling for Named Hot-Path Sections
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * Lightweight on-target profiler built on the Cortex-M7 DWT->CYCCNT.
+ * Code marks sections with Profiler_Begin()/Profiler_End() around a named
+ * slot; the profiler accumulates min/avg/max cycles and call counts per
+ * slot. The table is dumped with the 'profile' console command, so
+ * performance regressions are measured instead of guessed at.
+ *
+ * Usage:
+ *     static uint8_t prof_id = PROFILER_INVALID_SECTION;
+ *     if (prof_id == PROFILER_INVALID_SECTION)
+ *         prof_id = Profiler_RegisterSection("HMI_Process");
+ *     Profiler_Begin(prof_id);
+ *     ... work ...
+ *     Profiler_End(prof_id);
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include "main.h"
+#include <stdint.h>
+
+#define PROFILER_MAX_SECTIONS       24
+#define PROFILER_INVALID_SECTION    0xFF
+
+/* Per-section accumulated cycle statistics */
+typedef struct {
+    const char *name;               // Section name (string literal)
+    uint32_t start_cycles;          // CYCCNT at Profiler_Begin
+    uint32_t call_count;
+    uint32_t min_cycles;
+    uint32_t max_cycles;
+    uint64_t total_cycles;          // For exact average over the window
+} profiler_section_t;
+
+/* Function Declarations */
+
+/**
+ * @brief Initialize the profiler (enables the DWT cycle counter)
+ * @return 1 if successful, 0 if failed
+ */
+uint8_t Profiler_Init(void);
+
+/**
+ * @brief Register a named section
+ * @param name Section name (stored by pointer - use a literal)
+ * @return Section ID, or PROFILER_INVALID_SECTION if the table is full
+ */
+uint8_t Profiler_RegisterSection(const char *name);
+
+/**
+ * @brief Mark the start of a section
+ * @param section_id Section ID from Profiler_RegisterSection
+ */
+void Profiler_Begin(uint8_t section_id);
+
+/**
+ * @brief Mark the end of a section and accumulate its cycle count
+ * @param section_id Section ID from Profiler_RegisterSection
+ */
+void Profiler_End(uint8_t section_id);
+
+/**
+ * @brief Reset all accumulated statistics (sections stay registered)
+ */
+void Profiler_Reset(void);
+
+/**
+ * @brief Get a copy of one section's statistics
+ * @param section_id Section ID
+ * @param section Destination for the copy
+ * @return 1 if successful, 0 if invalid ID
+ */
+uint8_t Profiler_GetSection(uint8_t section_id, profiler_section_t *section);
+
+/**
+ * @brief Print the profile table (calls, min/avg/max cycles and us)
+ *        to the debug console
+ */
+void Profiler_PrintReport(void);
+
+#endif /* PROFILER_H */
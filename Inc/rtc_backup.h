@@ -0,0 +1,72 @@
+/**
+ * @file    rtc_backup.h
+ * @brief   Runtime-Hours Accounting in RTC Backup Registers
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * The H7 battery-backed RTC backup registers survive power cuts, so the
+ * live equipment hour and start counters are mirrored there on every
+ * change and once a minute - register writes, no flash involved. SPI
+ * flash only gets a commit every 8 hours or on controlled shutdown,
+ * cutting wear and save latency while losing at most one minute of
+ * accounting on a hard power cut instead of a whole save interval.
+ *
+ * Register map (RTC->BKPxR):
+ *   0      magic (validity marker)
+ *   1-8    compressor hours [0..7]
+ *   9-12   condenser hours [0..3]
+ *   13-20  compressor starts [0..7]
+ *   21-24  condenser starts [0..3]
+ *   25     system total hours
+ *   26     system start count
+ *   27     minutes since last flash commit
+ */
+
+#ifndef RTC_BACKUP_H
+#define RTC_BACKUP_H
+
+#include "main.h"
+#include <stdint.h>
+
+#define RTC_BACKUP_MAGIC            0x52554E48UL    // "RUNH"
+#define RTC_BACKUP_COMMIT_MINUTES   480             // Flash commit every 8 hours
+
+/* Function Declarations */
+
+/**
+ * @brief Enable backup-domain access and reconcile with loaded runtime data
+ *
+ * If the backup registers hold valid counters newer than what flash
+ * replayed (power was cut between flash commits), they win and are
+ * copied back into g_flash_config.runtime_data. Otherwise the registers
+ * are seeded from the flash copy.
+ *
+ * @return 1 if backup registers are usable, 0 if unavailable
+ */
+uint8_t RTCBackup_Init(void);
+
+/**
+ * @brief Mirror the live runtime counters into the backup registers
+ * @note  Pure register writes - safe to call on every counter change
+ */
+void RTCBackup_Sync(void);
+
+/**
+ * @brief Bump the minutes-since-commit counter (call once a minute)
+ * @return Minutes elapsed since the last flash commit
+ */
+uint32_t RTCBackup_MinuteTick(void);
+
+/**
+ * @brief Reset the minutes-since-commit counter after a flash commit
+ */
+void RTCBackup_MarkCommitted(void);
+
+/**
+ * @brief 1 if the backup registers were valid at init
+ */
+uint8_t RTCBackup_IsAvailable(void);
+
+#endif /* RTC_BACKUP_H */
@@ -0,0 +1,62 @@
+/**
+ * @file    run_stats.h
+ * @brief   O(1) Incremental Statistics (Running Sum, Windowed Min/Max, Variance)
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * Per-sample O(1) replacement for the O(n) history-buffer rescans in the
+ * analytics and temperature-control paths. Each sample updates:
+ *   - a running sum for the windowed mean (evict one, add one)
+ *   - windowed min/max via monotonic deques (amortized O(1))
+ *   - exponentially-weighted mean and variance
+ * With 8 sensors rescanned at the control scan rate, the old full-buffer
+ * walks were measurable loop time for identical results.
+ */
+
+#ifndef RUN_STATS_H
+#define RUN_STATS_H
+
+#include "main.h"
+#include <stdint.h>
+
+#define RUN_STATS_MAX_WINDOW    32      // Largest supported window
+
+/* Monotonic deque entry (sample number + value) */
+typedef struct {
+    uint32_t seq;                       // Sample sequence number
+    float value;                        // Sample value
+} run_stats_dq_entry_t;
+
+/* Incremental statistics state */
+typedef struct {
+    float window[RUN_STATS_MAX_WINDOW]; // Sample window (ring)
+    uint8_t window_size;                // Configured window length
+    uint8_t index;                      // Next write position
+    uint8_t count;                      // Valid samples (ramps to window_size)
+    uint32_t seq;                       // Total samples accepted
+    float running_sum;                  // Sum of the current window
+
+    // Monotonic deques: front holds the current window min/max
+    run_stats_dq_entry_t min_dq[RUN_STATS_MAX_WINDOW];
+    run_stats_dq_entry_t max_dq[RUN_STATS_MAX_WINDOW];
+    uint8_t min_head, min_tail;
+    uint8_t max_head, max_tail;
+
+    // Exponentially-weighted moments
+    float ema_alpha;                    // Smoothing factor (0..1)
+    float ema_mean;                     // EW mean
+    float ema_var;                      // EW variance
+} RunStats_t;
+
+/* Function Prototypes */
+void RunStats_Init(RunStats_t* stats, uint8_t window_size, float ema_alpha);
+void RunStats_Add(RunStats_t* stats, float sample);
+float RunStats_Mean(const RunStats_t* stats);       // Windowed mean
+float RunStats_Min(const RunStats_t* stats);        // Windowed minimum
+float RunStats_Max(const RunStats_t* stats);        // Windowed maximum
+float RunStats_EMAMean(const RunStats_t* stats);    // Exponential mean
+float RunStats_Variance(const RunStats_t* stats);   // Exponential variance
+
+#endif /* RUN_STATS_H */
@@ -46,6 +46,12 @@ SD_Card_Status_t SD_Card_WriteSingleBlock(uint8_t *pData, uint32_t BlockAdd);
 SD_Card_Status_t SD_Card_ReadSingleBlock(uint8_t *pData, uint32_t BlockAdd);
 SD_Card_Status_t SD_Card_EraseBlocks(uint32_t StartBlock, uint32_t EndBlock);
 
+// Write-behind queue: enqueue 512-byte blocks, flushed in multi-block
+// DMA bursts from SD_Card_Process(); completion runs in the SDMMC1 IRQ
+SD_Card_Status_t SD_Card_QueueWriteBlock(const uint8_t *pData, uint32_t BlockAdd);
+uint8_t SD_Card_WriteQueue_Pending(void);
+void SD_Card_WriteQueue_Stats(void);
+
 // Utility functions
 void SD_Card_Process(void);
 void SD_Card_Test(void);
@@ -0,0 +1,167 @@
+/**
+ * @file    sd_ring_log.h
+ * @brief   Append-Only Sector-Aligned Ring Log on the SD Card
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * Raw-block ring log for sensor and alarm history - no filesystem, no
+ * in-place updates, no corruption modes on power loss. Fixed 64-byte
+ * records (8 per 512-byte sector) are packed into a RAM sector and
+ * appended through the SD write-behind queue when the sector fills. A
+ * superblock carries head/tail pointers and is re-written every few
+ * sector appends; boot recovery reads it and walks forward at most that
+ * many sectors using record sequence numbers, so finding the write
+ * position is O(1) regardless of log size.
+ *
+ * Capacity: 256K sectors = 128 MB = ~120 days of 5-second sensor records.
+ */
+
+#ifndef SD_RING_LOG_H
+#define SD_RING_LOG_H
+
+#include "main.h"
+#include "flash_config.h"
+#include <stdint.h>
+
+/* On-card layout (block addresses) */
+#define SDLOG_SUPERBLOCK_BLOCK      100000UL    // ~49 MB in, clear of test areas
+#define SDLOG_DATA_START_BLOCK      (SDLOG_SUPERBLOCK_BLOCK + 1)
+#define SDLOG_DATA_BLOCKS           262144UL    // 128 MB ring
+
+#define SDLOG_RECORD_SIZE           64
+#define SDLOG_RECORDS_PER_SECTOR    8           // 512 / 64
+#define SDLOG_SUPERBLOCK_SYNC       16          // Superblock rewrite cadence (sectors)
+
+#define SDLOG_MAGIC                 0x53444C47UL    // "SDLG"
+#define SDLOG_VERSION               1
+
+/* Record types */
+#define SDLOG_REC_EMPTY             0x00
+#define SDLOG_REC_SENSOR            0x01
+#define SDLOG_REC_ALARM             0x02
+#define SDLOG_REC_PERF              0x03
+
+/* Per-unit performance snapshot payload (binary, for fleet analysis) */
+#define SDLOG_PERF_UNIT_COMPRESSOR  0
+#define SDLOG_PERF_UNIT_CONDENSER   1
+
+typedef struct __attribute__((packed)) {
+    uint32_t timestamp;                 // Uptime seconds at capture
+    uint8_t unit_type;                  // SDLOG_PERF_UNIT_*
+    uint8_t unit_index;                 // Unit number (0-based)
+    uint16_t fault_count;               // Fault occurrences
+    uint32_t runtime_hours;             // Accumulated runtime counter
+    uint32_t start_cycles;              // Accumulated start cycles
+    int32_t efficiency_q16;             // Efficiency rating (Q16.16)
+    int32_t trend_q16;                  // Efficiency trend slope (Q16.16)
+} PerfLogEntry_t;
+
+typedef enum {
+    SDLOG_OK = 0,
+    SDLOG_ERROR,
+    SDLOG_NOT_READY,
+    SDLOG_FULL
+} SDLog_Status_t;
+
+/* 64-byte on-card record: 8-byte header + payload */
+typedef struct {
+    uint32_t sequence;                  // Monotonic record sequence number
+    uint8_t type;                       // SDLOG_REC_*
+    uint8_t length;                     // Payload bytes used
+    uint16_t crc16;                     // CRC16 over payload
+    uint8_t payload[SDLOG_RECORD_SIZE - 8];
+} SDLog_Record_t;
+
+/* Superblock (one sector, mostly padding) */
+typedef struct {
+    uint32_t magic;                     // SDLOG_MAGIC
+    uint16_t version;
+    uint16_t reserved;
+    uint32_t head_sector;               // Next data sector to write (ring offset)
+    uint32_t tail_sector;               // Oldest valid data sector (ring offset)
+    uint32_t next_sequence;             // Sequence of the next record
+    uint32_t wrap_count;                // Times the ring has wrapped
+    uint32_t crc32;                     // CRC32 over the fields above
+} SDLog_Superblock_t;
+
+/* Function Declarations */
+
+/**
+ * @brief Mount the ring log: read the superblock and recover the exact
+ *        write position (bounded forward scan by sequence number)
+ * @return SDLOG_OK, or SDLOG_ERROR if the card is unavailable
+ * @note  A missing/corrupt superblock formats a fresh, empty log
+ */
+SDLog_Status_t SDLog_Init(void);
+
+/**
+ * @brief Append a sensor history record
+ * @param entry Sensor log entry to append
+ * @return SDLOG_OK if accepted (sector flush happens in the background)
+ */
+SDLog_Status_t SDLog_AppendSensor(const SensorLogEntry_t *entry);
+
+/**
+ * @brief Append an alarm history record
+ * @param entry Alarm log entry to append
+ * @return SDLOG_OK if accepted
+ */
+SDLog_Status_t SDLog_AppendAlarm(const AlarmLogEntry_t *entry);
+
+/**
+ * @brief Append a binary performance snapshot record
+ * @param entry Per-unit performance snapshot to append
+ * @return SDLOG_OK if accepted
+ */
+SDLog_Status_t SDLog_AppendPerf(const PerfLogEntry_t *entry);
+
+/**
+ * @brief Force the partially-filled RAM sector out to the card
+ *        (remaining record slots are written as SDLOG_REC_EMPTY)
+ * @return SDLOG_OK if queued
+ */
+SDLog_Status_t SDLog_Flush(void);
+
+/**
+ * @brief Read one record by offset from the oldest entry
+ * @param index 0 = oldest record on card
+ * @param record Destination
+ * @return SDLOG_OK, SDLOG_NOT_FOUND semantics via SDLOG_ERROR
+ */
+SDLog_Status_t SDLog_ReadRecord(uint32_t index, SDLog_Record_t *record);
+
+/**
+ * @brief Bulk sector read for streaming export: one multi-block command
+ *        for up to max_sectors consecutive sectors
+ * @param sector_off Sector offset from the oldest sector on card
+ * @param buffer Destination (max_sectors * 512 bytes)
+ * @param max_sectors Read limit
+ * @return Sectors actually read (clipped at the ring wrap and head), 0 on error
+ */
+uint32_t SDLog_ReadSectors(uint32_t sector_off, uint8_t *buffer, uint32_t max_sectors);
+
+/**
+ * @brief Number of records currently on the card
+ */
+uint32_t SDLog_GetRecordCount(void);
+
+/**
+ * @brief 1 if the log is mounted and accepting records
+ */
+uint8_t SDLog_IsReady(void);
+
+/**
+ * @brief Print ring-log status (position, counts, drops) to the console
+ */
+void SDLog_PrintStatus(void);
+
+/**
+ * @brief Stream recent performance snapshot records to the console
+ *        ('perf_dump' command)
+ * @param max_records Scan depth from the newest record backward
+ */
+void SDLog_DumpPerfRecords(uint32_t max_records);
+
+#endif /* SD_RING_LOG_H */
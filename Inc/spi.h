@@ -38,6 +38,9 @@ extern SPI_HandleTypeDef hspi4;
 
 /* USER CODE BEGIN Private defines */
 
+extern DMA_HandleTypeDef hdma_spi4_tx;
+extern DMA_HandleTypeDef hdma_spi4_rx;
+
 /* USER CODE END Private defines */
 
 void MX_SPI2_Init(void);
@@ -8,11 +8,27 @@
 void SPI_W5500_Init(void);
 void SPI_W5500_CS_Enable(void);
 void SPI_W5500_CS_Disable(void);
+uint32_t SPI_W5500_GetTransactionCount(void);  // CS assertions since boot
 
 HAL_StatusTypeDef SPI_W5500_TransmitReceive(uint8_t *tx_data, uint8_t *rx_data, uint16_t size);
 HAL_StatusTypeDef SPI_W5500_Transmit(uint8_t *tx_data, uint16_t size);
 HAL_StatusTypeDef SPI_W5500_Receive(uint8_t *rx_data, uint16_t size);
 
+// Burst transfers: one 3-byte address phase, then len data bytes with
+// W5500 sequential address auto-increment. control_byte carries the BSB.
+HAL_StatusTypeDef SPI_W5500_WriteBurst(uint16_t addr, uint8_t control_byte, const uint8_t *data, uint16_t len);
+HAL_StatusTypeDef SPI_W5500_ReadBurst(uint16_t addr, uint8_t control_byte, uint8_t *data, uint16_t len);
+
+// DMA burst transfers: payload phase runs on DMA, CPU returns immediately.
+// Completion releases CS and fires the registered callback (IRQ context).
+// With the D-cache enabled, read destinations must be DCACHE_ALIGNED and
+// padded to a line multiple (the driver invalidates the range by address).
+typedef void (*spi_w5500_dma_callback_t)(void);
+HAL_StatusTypeDef SPI_W5500_WriteBurst_DMA(uint16_t addr, uint8_t control_byte, const uint8_t *data, uint16_t len);
+HAL_StatusTypeDef SPI_W5500_ReadBurst_DMA(uint16_t addr, uint8_t control_byte, uint8_t *data, uint16_t len);
+uint8_t SPI_W5500_IsDmaBusy(void);
+void SPI_W5500_SetDmaCallback(spi_w5500_dma_callback_t callback);
+
 void SPI_W5500_Test_Communication(void);
 
 // W5500 Register Operations
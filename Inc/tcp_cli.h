@@ -0,0 +1,48 @@
+/**
+ * @file    tcp_cli.h
+ * @brief   Telnet-Style Debug CLI over TCP
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * Line-oriented TCP console on a dedicated W5500 socket exposing the
+ * same command dispatcher as the UART7 serial console, so profiler
+ * dumps, scheduler tables and socket stats are reachable without
+ * opening the panel. Built non-blocking on the socket layer; command
+ * output is mirrored from the debug path into a TX ring and drained to
+ * the client as the TX window allows.
+ */
+
+#ifndef TCP_CLI_H
+#define TCP_CLI_H
+
+#include "main.h"
+#include <stdint.h>
+
+#define TCP_CLI_SOCKET          2       // Socket 0 = HTTP, 1 = TCP server
+#define TCP_CLI_PORT            2323
+#define TCP_CLI_LINE_MAX        64      // Command line length
+#define TCP_CLI_TX_RING_SIZE    2048    // Buffered command output
+#define TCP_CLI_IDLE_TIMEOUT_MS 60000
+
+/* Function Declarations */
+
+/**
+ * @brief Open the CLI socket and start listening
+ */
+void TCP_CLI_Init(void);
+
+/**
+ * @brief Non-blocking CLI state machine (call from the main loop):
+ *        accepts connections, assembles command lines, runs them
+ *        through Process_DebugCommands() and drains buffered output
+ */
+void TCP_CLI_Process(void);
+
+/**
+ * @brief 1 if a CLI client is currently connected
+ */
+uint8_t TCP_CLI_IsConnected(void);
+
+#endif /* TCP_CLI_H */
@@ -0,0 +1,119 @@
+/**
+ * @file    telemetry_frame.h
+ * @brief   Compact Binary Telemetry Frame Format
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * Versioned binary frame for the TCP streaming path, replacing the
+ * snprintf-built text messages. A fixed 8-byte header (magic, version,
+ * type, length, payload CRC16) is followed by little-endian fixed-point
+ * fields - temperatures as centidegrees, capacity as tenths of a
+ * percent. A sensor frame is 34 bytes against ~200 of text, and
+ * building one is a handful of integer stores instead of printf
+ * formatting.
+ */
+
+#ifndef TELEMETRY_FRAME_H
+#define TELEMETRY_FRAME_H
+
+#include "main.h"
+#include <stdint.h>
+
+#define TELEM_MAGIC                 0x4C54      // "TL" little-endian
+#define TELEM_VERSION               1
+#define TELEM_MAX_FRAME             64
+
+/* Frame types */
+#define TELEM_TYPE_SENSOR           0x01        // Full sensor/status snapshot (keyframe)
+#define TELEM_TYPE_DELTA            0x02        // Changed fields only
+
+/* Field bits for subscriptions and delta masks - one bit per payload
+ * field, in payload order. uptime_ms counts as always-changed, so
+ * subscribing bit 0 timestamps every delta frame. */
+#define TELEM_FIELD_UPTIME          (1 << 0)
+#define TELEM_FIELD_SUPPLY_TEMP     (1 << 1)
+#define TELEM_FIELD_RETURN_TEMP     (1 << 2)
+#define TELEM_FIELD_AMBIENT_TEMP    (1 << 3)
+#define TELEM_FIELD_PRESSURE        (1 << 4)
+#define TELEM_FIELD_FLOW_RATE       (1 << 5)
+#define TELEM_FIELD_SYSTEM_STATE    (1 << 6)
+#define TELEM_FIELD_CAPACITY_MODE   (1 << 7)
+#define TELEM_FIELD_COMPRESSORS     (1 << 8)
+#define TELEM_FIELD_CONDENSERS      (1 << 9)
+#define TELEM_FIELD_CAPACITY_PCT    (1 << 10)
+#define TELEM_FIELD_FAULT_BITS      (1 << 11)
+#define TELEM_FIELD_ALARM_COUNT     (1 << 12)
+#define TELEM_FIELD_COUNT           13
+#define TELEM_FIELD_MASK_ALL        0x1FFF
+
+/* 8-byte frame header */
+typedef struct __attribute__((packed)) {
+    uint16_t magic;                 // TELEM_MAGIC
+    uint8_t version;                // TELEM_VERSION
+    uint8_t type;                   // TELEM_TYPE_*
+    uint16_t length;                // Payload bytes
+    uint16_t crc16;                 // CRC16 over payload
+} TelemetryHeader_t;
+
+/* TELEM_TYPE_SENSOR payload - all little-endian, fixed-point */
+typedef struct __attribute__((packed)) {
+    uint32_t uptime_ms;             // System uptime
+    int16_t supply_temp_cc;         // Supply water temp (°C x 100)
+    int16_t return_temp_cc;         // Return water temp (°C x 100)
+    int16_t ambient_temp_cc;        // Ambient temp (°C x 100)
+    uint16_t pressure;              // System pressure
+    uint16_t flow_rate;             // Water flow rate
+    uint8_t system_state;           // ChillerSystemState_t
+    uint8_t capacity_mode;          // CapacityMode_t
+    uint8_t active_compressors;     // Running compressor count
+    uint8_t active_condensers;      // Running condenser count
+    uint16_t capacity_pct_x10;      // Staged capacity (% x 10)
+    uint32_t fault_bits;            // ChillerFaultCode_t bitmask
+    uint16_t alarm_count;           // Active safety alarms
+} TelemetrySensorPayload_t;
+
+/* Function Declarations */
+
+/**
+ * @brief Build a TELEM_TYPE_SENSOR frame from the live system state
+ * @param buffer Destination, at least TELEM_MAX_FRAME bytes
+ * @param max_length Buffer capacity
+ * @return Frame length in bytes, 0 if the buffer is too small
+ */
+uint16_t Telemetry_BuildSensorFrame(uint8_t *buffer, uint16_t max_length);
+
+/**
+ * @brief Fill a sensor payload from the live system state
+ * @param pl Destination payload
+ */
+void Telemetry_FillSensorPayload(TelemetrySensorPayload_t *pl);
+
+/**
+ * @brief Build a TELEM_TYPE_SENSOR keyframe from a prepared payload
+ * @param buffer Destination, at least TELEM_MAX_FRAME bytes
+ * @param max_length Buffer capacity
+ * @param pl Payload to wrap
+ * @return Frame length in bytes, 0 if the buffer is too small
+ */
+uint16_t Telemetry_BuildKeyFrame(uint8_t *buffer, uint16_t max_length,
+                                 const TelemetrySensorPayload_t *pl);
+
+/**
+ * @brief Build a TELEM_TYPE_DELTA frame: uint16 field mask followed by
+ *        only the fields that differ between current and previous (and
+ *        are subscribed)
+ * @param buffer Destination, at least TELEM_MAX_FRAME bytes
+ * @param max_length Buffer capacity
+ * @param current Current payload
+ * @param previous Payload the client last received
+ * @param subscribe_mask Fields the client asked for (TELEM_FIELD_*)
+ * @return Frame length in bytes, 0 if nothing changed (no frame to send)
+ */
+uint16_t Telemetry_BuildDeltaFrame(uint8_t *buffer, uint16_t max_length,
+                                   const TelemetrySensorPayload_t *current,
+                                   const TelemetrySensorPayload_t *previous,
+                                   uint16_t subscribe_mask);
+
+#endif /* TELEMETRY_FRAME_H */
@@ -0,0 +1,84 @@
+/**
+ * @file    timebase.h
+ * @brief   Software Timers and 64-bit Microsecond Clock
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * One home for the "if (HAL_GetTick() - last > interval)" pattern that
+ * was copied (with independent state and its own rollover story) across
+ * the codebase. Periodic and one-shot timers register with a callback
+ * or, callback-less, post EVENT_TIMER through the event queue; the
+ * service pass is O(1) when nothing is due because the earliest
+ * deadline is tracked across arms and fires. A 64-bit monotonic
+ * microsecond clock built on the DWT cycle counter backs high-resolution
+ * timestamps without the ~15s CYCCNT wrap leaking to callers.
+ */
+
+#ifndef TIMEBASE_H
+#define TIMEBASE_H
+
+#include "main.h"
+#include <stdint.h>
+
+#define TIMEBASE_MAX_TIMERS         16
+#define TIMEBASE_INVALID_TIMER      0xFF
+
+/* Timer modes */
+#define TIMEBASE_ONESHOT            0   // Fires once, then disarms
+#define TIMEBASE_PERIODIC           1   // Re-arms itself on fire
+
+typedef void (*timebase_fn_t)(void);
+
+/* Function Declarations */
+
+/**
+ * @brief Initialize the timer table and the microsecond clock
+ *        (DWT cycle counter must already be running - Profiler_Init)
+ */
+void Timebase_Init(void);
+
+/**
+ * @brief Register a software timer
+ * @param name Short timer name (stored by pointer - use a literal)
+ * @param fn Callback run in task context when the timer fires; NULL
+ *           posts EVENT_TIMER (param = timer ID, value = fire count)
+ *           through the event queue instead
+ * @param period_ms Delay (one-shot) or period (periodic) in milliseconds
+ * @param mode TIMEBASE_ONESHOT or TIMEBASE_PERIODIC
+ * @return Timer ID, or TIMEBASE_INVALID_TIMER if the table is full
+ */
+uint8_t Timebase_Register(const char *name, timebase_fn_t fn,
+                          uint32_t period_ms, uint8_t mode);
+
+/**
+ * @brief Re-arm a timer with a new delay from now (starts a stopped
+ *        timer, reschedules a running one)
+ */
+void Timebase_Restart(uint8_t timer_id, uint32_t delay_ms);
+
+/**
+ * @brief Disarm a timer (the slot stays registered)
+ */
+void Timebase_Stop(uint8_t timer_id);
+
+/**
+ * @brief Fire due timers - call every main-loop pass. Early-outs on a
+ *        single compare against the earliest deadline when nothing is
+ *        due, and keeps the 64-bit clock accumulator ahead of the
+ *        CYCCNT wrap as a side effect.
+ */
+void Timebase_Process(void);
+
+/**
+ * @brief Monotonic microseconds since boot (64-bit, ISR-safe)
+ */
+uint64_t Timebase_Micros64(void);
+
+/**
+ * @brief Print the timer table and clock state
+ */
+void Timebase_PrintStatus(void);
+
+#endif /* TIMEBASE_H */
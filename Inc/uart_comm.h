@@ -8,6 +8,8 @@ void Init_UARTs(void);
 void Send_Debug_Data(const char *message);
 void Send_HMI_Data(const char *message);
 void Send_RS485_Data(const char *message);
+uint32_t Debug_GetOverflowDrops(void);  // Messages dropped by the full TX ring
+void Debug_SetMirror(void (*mirror)(const char *message));  // Tee debug output (NULL to clear)
 
 // DE Pin definitions
 #define U485_DE_RE_PORT     GPIOD
@@ -40,6 +40,10 @@ extern UART_HandleTypeDef huart8;
 
 /* USER CODE BEGIN Private defines */
 
+extern DMA_HandleTypeDef hdma_uart8_rx;
+extern DMA_HandleTypeDef hdma_uart7_tx;
+extern DMA_HandleTypeDef hdma_uart4_rx;
+
 /* USER CODE END Private defines */
 
 void MX_UART4_Init(void);
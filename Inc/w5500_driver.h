@@ -12,7 +12,9 @@
 #define W5500_SIPR          0x000F  // Source IP Address
 #define W5500_IR            0x0015  // Interrupt Register
 #define W5500_IMR           0x0016  // Interrupt Mask Register
-#define W5500_RTR           0x0017  // Retry Timeout Register
+#define W5500_SIR           0x0017  // Socket Interrupt Register (one bit per socket)
+#define W5500_SIMR          0x0018  // Socket Interrupt Mask Register
+#define W5500_RTR           0x0019  // Retry Timeout Register
 #define W5500_RCR           0x0019  // Retry Count Register
 #define W5500_PTIMER        0x0028  // PPP LCP Request Timer
 #define W5500_PMAGIC        0x0029  // PPP LCP Magic Number
@@ -56,4 +58,8 @@ void W5500_Debug_Message(const char *message);
 void W5500_WriteByte(uint16_t addr, uint8_t data);
 uint8_t W5500_ReadByte(uint16_t addr);
 
+// Burst block I/O - sequential auto-increment, one address phase per block
+void W5500_WriteBuffer(uint16_t addr, const uint8_t *data, uint16_t len);
+void W5500_ReadBuffer(uint16_t addr, uint8_t *data, uint16_t len);
+
 #endif /* W5500_DRIVER_H */
@@ -34,6 +34,13 @@
 #define W5500_Sn_MR                 0x0000  // Socket Mode Register
 #define W5500_Sn_CR                 0x0001  // Socket Command Register
 #define W5500_Sn_IR                 0x0002  // Socket Interrupt Register
+
+/* Sn_IR event bits */
+#define W5500_Sn_IR_CON             0x01    // Connection established
+#define W5500_Sn_IR_DISCON          0x02    // Disconnect received
+#define W5500_Sn_IR_RECV            0x04    // Data received
+#define W5500_Sn_IR_TIMEOUT         0x08    // Connect/retransmit timeout
+#define W5500_Sn_IR_SEND_OK         0x10    // Send completed
 #define W5500_Sn_SR                 0x0003  // Socket Status Register
 #define W5500_Sn_PORT0              0x0004  // Socket Source Port
 #define W5500_Sn_PORT1              0x0005
@@ -43,6 +50,21 @@
 #define W5500_Sn_MSSR0              0x0012  // Maximum Segment Size
 #define W5500_Sn_TOS                0x0015  // Type of Service
 #define W5500_Sn_TTL                0x0016  // Time to Live
+#define W5500_Sn_TX_FSR0            0x0020  // TX Free Size (2 bytes)
+#define W5500_Sn_TX_RD0             0x0022  // TX Read Pointer (2 bytes)
+#define W5500_Sn_TX_WR0             0x0024  // TX Write Pointer (2 bytes)
+#define W5500_Sn_RX_RSR0            0x0026  // RX Received Size (2 bytes)
+#define W5500_Sn_RX_RD0             0x0028  // RX Read Pointer (2 bytes)
+#define W5500_Sn_RX_WR0             0x002A  // RX Write Pointer (2 bytes)
+#define W5500_Sn_RXBUF_SIZE         0x001E  // RX Buffer Size (KB)
+#define W5500_Sn_TXBUF_SIZE         0x001F  // TX Buffer Size (KB)
+
+/* Control byte BSB values for socket data buffers (burst transfers).
+ * Socket registers use direct addressing in this driver, but the TX/RX
+ * data buffers have no direct-address aliases - they must be selected
+ * through the control byte's Block Select Bits. */
+#define W5500_BSB_SOCKET_TX(s)      ((uint8_t)((((s) << 2) + 2) << 3))
+#define W5500_BSB_SOCKET_RX(s)      ((uint8_t)((((s) << 2) + 3) << 3))
 
 /* Socket Commands */
 #define W5500_CMD_OPEN              0x01
@@ -88,6 +110,32 @@ typedef enum {
     SOCKET_BUF_8KB = 0x03
 } socket_buffer_size_t;
 
+/* Socket Roles for Buffer Partitioning */
+typedef enum {
+    SOCKET_ROLE_IDLE = 0,           // Unused/parked - 1KB TX, 1KB RX
+    SOCKET_ROLE_SERVER,             // Request/response (HTTP, CLI) - 4KB TX, 2KB RX
+    SOCKET_ROLE_STREAM,             // Bulk/telemetry streaming - 8KB TX, 2KB RX
+    SOCKET_ROLE_DATA                // Connection-pool data socket - 2KB TX, 2KB RX
+} socket_role_t;
+
+/* TX Fragment for Scatter-Gather Sends */
+typedef struct {
+    const uint8_t *data;            // Fragment data (not copied)
+    uint16_t length;                // Fragment length in bytes
+} w5500_tx_fragment_t;
+
+/* Per-Socket Traffic Counters (accumulated continuously since boot) */
+typedef struct {
+    uint32_t tx_bytes;              // Payload bytes committed with SEND
+    uint32_t rx_bytes;              // Payload bytes read out of the RX window
+    uint32_t tx_sends;              // SEND commands issued
+    uint32_t tx_window_full;        // Sends rejected because the TX window was full
+    uint32_t rx_buffer_full;        // RX window seen completely full (peer backpressure)
+    uint32_t connects;              // CON events (client connections accepted)
+    uint32_t disconnects;           // DISCON events (peer closed)
+    uint32_t timeouts;              // TIMEOUT events (ARP/retransmit failures)
+} w5500_socket_stats_t;
+
 /* Socket State Structure */
 typedef struct {
     uint8_t socket_id;
@@ -101,6 +149,7 @@ typedef struct {
 } w5500_socket_t;
 
 /* Function Declarations */
+uint8_t W5500_Socket_Init_TCP_Server(uint8_t socket, uint16_t port);
 uint8_t W5500_Socket_Init_TCP_Server_Debug(uint8_t socket, uint16_t port);
 void W5500_Socket_Diagnostic(uint8_t socket);
 void Test_Socket_Access_Methods(uint8_t socket);
@@ -126,6 +175,20 @@ uint8_t W5500_Socket_InitBuffers(void);
  */
 uint8_t W5500_Socket_SetBufferSize(uint8_t socket, socket_buffer_size_t tx_size, socket_buffer_size_t rx_size);
 
+/**
+ * @brief Partition the chip's 16KB TX / 16KB RX memory by socket role
+ *
+ * Hot sockets get large TX windows (stream 8KB, server 4KB) so bulk
+ * sends need fewer SEND commits; idle sockets shrink to 1KB. The plan
+ * is validated against the 16KB budget per direction and written to
+ * the per-socket Sn_TXBUF_SIZE/Sn_RXBUF_SIZE registers. Apply at init
+ * or with the affected sockets closed - resizing wipes buffer content.
+ *
+ * @param roles Role per socket, indexed 0-7
+ * @return 1 if the plan fits and was applied, 0 otherwise
+ */
+uint8_t W5500_Socket_SetBufferPlan(const socket_role_t roles[W5500_MAX_SOCKETS]);
+
 /**
  * @brief Initialize specific socket with mode and port
  * @param socket Socket number (0-7)
@@ -149,6 +212,37 @@ uint8_t W5500_Socket_GetStatus(uint8_t socket);
  */
 uint8_t W5500_Socket_Close(uint8_t socket);
 
+/**
+ * @brief Graceful TCP disconnect (DISCON/FIN) without blocking
+ * @param socket Socket number (0-7)
+ * @return 1 if the command was issued
+ */
+uint8_t W5500_Socket_Disconnect(uint8_t socket);
+
+/**
+ * @brief Set TCP mode/port and issue OPEN without waiting
+ * @param socket Socket number (0-7)
+ * @param port Local port number
+ * @return 1 if the command was issued
+ * @note  Poll W5500_Socket_GetStatus() for SOCK_INIT before LISTEN
+ */
+uint8_t W5500_Socket_OpenTCP(uint8_t socket, uint16_t port);
+
+/**
+ * @brief Issue the LISTEN command without waiting
+ * @param socket Socket number (0-7, must be in SOCK_INIT)
+ * @return 1 if the command was issued
+ */
+uint8_t W5500_Socket_Listen(uint8_t socket);
+
+/**
+ * @brief Read the connected peer's address (valid once ESTABLISHED)
+ * @param socket Socket number (0-7)
+ * @param ip Remote IP (4 bytes, may be NULL)
+ * @param port Remote port (may be NULL)
+ */
+void W5500_Socket_GetRemote(uint8_t socket, uint8_t *ip, uint16_t *port);
+
 /**
  * @brief Close all sockets (system reset)
  * @return 1 if successful, 0 if failed
@@ -182,4 +276,125 @@ uint8_t W5500_Socket_ResetAll(void);
  */
 void W5500_Socket_Debug(uint8_t socket);
 
+/**
+ * @brief Get free space in socket TX buffer
+ * @param socket Socket number (0-7)
+ * @return Free bytes in the TX window
+ */
+uint16_t W5500_Socket_GetTxFreeSize(uint8_t socket);
+
+/**
+ * @brief Get pending byte count in socket RX buffer
+ * @param socket Socket number (0-7)
+ * @return Received bytes waiting to be read
+ */
+uint16_t W5500_Socket_GetRxReceivedSize(uint8_t socket);
+
+/**
+ * @brief Send data through socket TX buffer (burst write + SEND command)
+ * @param socket Socket number (0-7)
+ * @param data Data to send
+ * @param len Number of bytes
+ * @return Bytes queued for transmission (0 on failure)
+ */
+uint16_t W5500_Socket_SendData(uint8_t socket, const uint8_t *data, uint16_t len);
+
+/**
+ * @brief Send with the payload phase on SPI DMA - the caller returns to
+ *        the loop while the burst runs; short payloads and DMA-busy
+ *        cases fall back to the polled path (committed before return)
+ * @param socket Socket number (0-7)
+ * @param data Payload (must stay valid until W5500_Socket_AsyncPump
+ *        commits - check W5500_Socket_AsyncInFlight before reuse)
+ * @param len Number of bytes
+ * @return Bytes accepted for transmission (0 = retry next pass)
+ */
+uint16_t W5500_Socket_SendDataAsync(uint8_t socket, const uint8_t *data, uint16_t len);
+
+/**
+ * @brief Whether an async send still owns its caller buffer
+ * @return 1 while a DMA send is uncommitted
+ */
+uint8_t W5500_Socket_AsyncInFlight(void);
+
+/**
+ * @brief Commit a completed async send (TX pointer advance + SEND)
+ * @return Bytes committed, 0 if idle or the payload is still moving
+ */
+uint16_t W5500_Socket_AsyncPump(void);
+
+/**
+ * @brief Drop the cached status/TX-free/RX-pending snapshot for a socket
+ *        so the next query reads the chip again
+ * @param socket Socket number (0-7)
+ */
+void W5500_Socket_CacheInvalidate(uint8_t socket);
+
+/**
+ * @brief Unmask socket interrupts in SIMR so SIR accumulates events
+ */
+void W5500_Events_Enable(void);
+
+/**
+ * @brief EXTI hook for the W5500 INTn pin - call from the EXTI callback
+ *        on board revisions that route the pin. Until the first call the
+ *        event layer polls SIR once per pass instead.
+ */
+void W5500_Events_IRQHook(void);
+
+/**
+ * @brief Collect pending socket events: one SIR byte read, then Sn_IR
+ *        read+clear only for sockets flagged there
+ * @return Bitmask of sockets with new events (bit n = socket n)
+ */
+uint8_t W5500_Events_Poll(void);
+
+/**
+ * @brief Fetch and clear the accumulated Sn_IR event bits for a socket
+ * @param socket Socket number (0-7)
+ * @return W5500_Sn_IR_* bits collected since the last call
+ */
+uint8_t W5500_Events_Get(uint8_t socket);
+
+/**
+ * @brief Scatter-gather send: burst-write several caller fragments
+ *        (e.g. header + payload) back-to-back into the socket TX window
+ *        and commit with a single SEND - no staging buffer, no copies
+ * @param socket Socket number (0-7)
+ * @param fragments Fragment list (data pointers are read, never copied)
+ * @param count Number of fragments
+ * @return Total bytes queued, 0 if the whole frame did not fit
+ */
+uint16_t W5500_Socket_SendVectored(uint8_t socket, const w5500_tx_fragment_t *fragments,
+                                   uint8_t count);
+
+/**
+ * @brief Copy the accumulated traffic counters for a socket
+ * @param socket Socket number (0-7)
+ * @param stats Destination structure
+ * @return 1 if successful, 0 if failed
+ */
+uint8_t W5500_Socket_GetStats(uint8_t socket, w5500_socket_stats_t *stats);
+
+/**
+ * @brief Zero all per-socket traffic counters
+ */
+void W5500_Socket_ResetStats(void);
+
+/**
+ * @brief Print per-socket throughput/error counters plus SPI transaction
+ *        and register-cache totals - the numbers to look at when a
+ *        customer reports slow telemetry
+ */
+void W5500_Socket_PrintStats(void);
+
+/**
+ * @brief Read received data from socket RX buffer (burst read + RECV command)
+ * @param socket Socket number (0-7)
+ * @param buffer Destination buffer
+ * @param max_len Buffer capacity
+ * @return Bytes read (0 if nothing pending)
+ */
+uint16_t W5500_Socket_ReceiveData(uint8_t socket, uint8_t *buffer, uint16_t max_len);
+
 #endif /* W5500_SOCKET_H */
@@ -20,15 +20,29 @@
 
 /* TCP Server Configuration */
 #define TCP_SERVER_PORT             8080    // Default listening port
-#define TCP_SERVER_SOCKET           1       // Use Socket 1 for TCP server
-#define TCP_MAX_CLIENTS             4       // Maximum concurrent clients
+#define TCP_SERVER_SOCKET           1       // First data-service socket
+#define TCP_MAX_CLIENTS             6       // Data-service sockets (1, 3-7)
 #define TCP_BUFFER_SIZE             512     // TX/RX buffer size
 #define TCP_CLIENT_TIMEOUT          30000   // Client timeout in ms
 #define TCP_KEEPALIVE_INTERVAL      10000   // Keep-alive interval in ms
+#define TCP_CLIENT_BUDGET_US        2000    // Per-socket service budget per pass
+
+/* Per-Socket Service Descriptors
+ * Socket 0 = HTTP (http_server.c), socket 2 = debug CLI (tcp_cli.c);
+ * every remaining socket is a data-service listener on TCP_SERVER_PORT,
+ * so SCADA, the engineering laptop and the log downloader can all be
+ * connected at once. */
+typedef enum {
+    TCP_SVC_NONE = 0,                   // Unassigned
+    TCP_SVC_HTTP,                       // Owned by http_server.c
+    TCP_SVC_CLI,                        // Owned by tcp_cli.c
+    TCP_SVC_DATA                        // Telemetry/log-export pool (this module)
+} tcp_service_t;
 
 /* TCP Server States */
 typedef enum {
     TCP_STATE_IDLE = 0,
+    TCP_STATE_OPENING,                  // OPEN issued, waiting for SOCK_INIT
     TCP_STATE_LISTENING,
     TCP_STATE_CONNECTED,
     TCP_STATE_DATA_READY,
@@ -111,6 +125,18 @@ void TCP_Server_Process(void);
  */
 uint16_t TCP_Server_Send(uint8_t client_id, uint8_t *data, uint16_t length);
 
+/**
+ * @brief Scatter-gather send to specific client - fragments (e.g. header
+ *        + payload) are burst-written straight into the W5500 TX window
+ *        with a single SEND commit, no staging copy
+ * @param client_id Client ID (0-3)
+ * @param fragments Fragment list
+ * @param count Number of fragments
+ * @return Total bytes sent, 0 if the frame did not fit or client gone
+ */
+uint16_t TCP_Server_SendVectored(uint8_t client_id, const w5500_tx_fragment_t *fragments,
+                                 uint8_t count);
+
 /**
  * @brief Send data to all connected clients
  * @param data Pointer to data buffer
@@ -119,6 +145,15 @@ uint16_t TCP_Server_Send(uint8_t client_id, uint8_t *data, uint16_t length);
  */
 uint8_t TCP_Server_Broadcast(uint8_t *data, uint16_t length);
 
+/**
+ * @brief Scatter-gather broadcast - frame is formatted once by the
+ *        caller and written once per connected socket
+ * @param fragments Fragment list
+ * @param count Number of fragments
+ * @return Number of clients the frame was sent to
+ */
+uint8_t TCP_Server_BroadcastVectored(const w5500_tx_fragment_t *fragments, uint8_t count);
+
 /**
  * @brief Check if client is connected
  * @param client_id Client ID (0-3)
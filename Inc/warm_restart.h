@@ -0,0 +1,85 @@
+/**
+ * @file    warm_restart.h
+ * @brief   Warm-Restart State Preservation in Backup SRAM
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * A watchdog or commanded reset used to cold-start the plant: every
+ * compressor stopped, anti-short-cycle timers restarted, and the
+ * building lost cooling for minutes of restaging. The critical state
+ * vector (system state, per-compressor run state and timer remainders,
+ * active setpoint, fault latches) is mirrored once a second into a
+ * CRC32-checked block in the 4KB battery-backed SRAM, which survives
+ * every reset short of losing VBAT. When the reset-cause flags show a
+ * warm reset (software, IWDG, WWDG - not power-on or brownout) the
+ * block is at most one mirror period old, and boot resumes staging
+ * from it - each compressor re-validated through the safety system -
+ * instead of cold-starting.
+ */
+
+#ifndef WARM_RESTART_H
+#define WARM_RESTART_H
+
+#include "main.h"
+#include "equipment_config.h"
+#include <stdint.h>
+
+/* H7 backup SRAM: 4KB in the backup domain, retained across resets */
+#define WARM_RESTART_SRAM_BASE      0x38800000UL
+#define WARM_RESTART_MAGIC          0x57524D53UL    // "WRMS"
+
+/* Mirrored state vector - one block at the start of backup SRAM */
+typedef struct {
+    uint32_t magic;                     // WARM_RESTART_MAGIC
+    uint16_t length;                    // sizeof(block) - layout guard
+    uint16_t sequence;                  // Bumps every mirror pass
+    uint8_t system_state;               // ChillerSystemState_t
+    uint8_t capacity_mode;              // CapacityMode_t
+    uint8_t compressor_mask;            // Bit per running compressor
+    uint8_t condenser_mask;             // Bit per running condenser bank
+    uint16_t active_faults;             // Core fault latch bits
+    uint16_t fault_history;
+    float setpoint;                     // Active return-water setpoint
+    uint32_t comp_run_elapsed_ms[MAX_COMPRESSORS];      // Into minimum run time
+    uint32_t cond_run_elapsed_ms[MAX_CONDENSER_BANKS];
+    uint32_t since_comp_start_ms;       // Age of last compressor start
+    uint32_t since_comp_stop_ms;        // Age of last compressor stop
+    uint32_t save_uptime_ms;            // HAL tick at mirror time
+    uint32_t crc32;                     // Over everything above
+} WarmRestartBlock_t;
+
+/* Function Declarations */
+
+/**
+ * @brief Enable backup SRAM and latch the reset cause
+ * @note  Must run before Watchdog_Init, which clears the sticky
+ *        RCC reset-cause flags for its own post-mortem
+ */
+void WarmRestart_Init(void);
+
+/**
+ * @brief Resume plant state from the mirrored block when eligible
+ *
+ * Eligible means: the reset cause was warm, the block verifies, and
+ * the safety system is not locked out. Every compressor in the saved
+ * running set is re-validated individually before its relay closes;
+ * timer remainders carry over so minimum-run and stagger protection
+ * continue rather than restart.
+ *
+ * @return Number of compressors resumed (0 = cold start)
+ */
+uint8_t WarmRestart_TryRestore(void);
+
+/**
+ * @brief Mirror the live state vector into backup SRAM (1s periodic)
+ */
+void WarmRestart_Mirror(void);
+
+/**
+ * @brief Print block validity, reset cause and restore statistics
+ */
+void WarmRestart_PrintStatus(void);
+
+#endif /* WARM_RESTART_H */
@@ -0,0 +1,97 @@
+/**
+ * @file    watchdog.h
+ * @brief   Independent Watchdog with Task Aliveness Bitmap and Post-Mortem
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * IWDG supervision wired into the cooperative scheduler: every critical
+ * task sets its aliveness bit when it runs, and the watchdog is kicked
+ * only when the full critical set has checked in since the last kick.
+ * A wedge anywhere - one stuck task or the whole loop - stops the kicks
+ * and the IWDG resets the board within the timeout.
+ *
+ * Post-mortem: the last-run task id is mirrored into RTC backup RAM on
+ * every task entry, and the HardFault/MemManage/BusFault/UsageFault
+ * handlers store the fault type plus stacked PC/LR and the DWT cycle
+ * count there before waiting for the reset. Watchdog_Init() reads the
+ * reset cause and those registers on the next boot and logs the result
+ * through ChillerCore_LogFault() - a once-a-month field hang becomes a
+ * log read instead of a site visit.
+ *
+ * Backup register map (continues rtc_backup.h, registers 28-31):
+ *   28   marker: magic | fault type | last-run task id
+ *   29   stacked PC at fault (0 for a plain watchdog wedge)
+ *   30   stacked LR at fault
+ *   31   DWT cycle count at fault
+ */
+
+#ifndef WATCHDOG_H
+#define WATCHDOG_H
+
+#include "main.h"
+#include <stdint.h>
+
+/* Backup registers 28-31 (0-27 belong to rtc_backup) */
+#define WDG_BKP_MARKER              28
+#define WDG_BKP_PC                  29
+#define WDG_BKP_LR                  30
+#define WDG_BKP_CYCCNT              31
+
+/* Marker layout: magic (16) | fault type (8) | last task id (8) */
+#define WDG_MARKER_MAGIC            0x57440000UL    // "WD"
+#define WDG_MARKER_MAGIC_MASK       0xFFFF0000UL
+
+/* Fault types recorded in the marker */
+#define WDG_FAULT_NONE              0x00    // Running normally (wedge if seen after reset)
+#define WDG_FAULT_HARDFAULT         0x01
+#define WDG_FAULT_MEMMANAGE         0x02
+#define WDG_FAULT_BUSFAULT          0x03
+#define WDG_FAULT_USAGEFAULT        0x04
+
+/* Function Declarations */
+
+/**
+ * @brief Report any post-mortem left by the previous run, then start the
+ *        IWDG (~4 s timeout)
+ * @return 1 if the watchdog is running
+ * @note  Call after RTCBackup_Init() and ChillerCore_Init() so the
+ *        report can go through the fault log
+ */
+uint8_t Watchdog_Init(void);
+
+/**
+ * @brief Mark a scheduler task as part of the critical aliveness set
+ * @param task_id Scheduler task id
+ * @note  Called by the scheduler for SCHED_PRIO_CRITICAL registrations
+ */
+void Watchdog_ExpectTask(uint8_t task_id);
+
+/**
+ * @brief Record that a task is about to run: sets its aliveness bit and
+ *        mirrors the task id into backup RAM for post-mortem
+ * @param task_id Scheduler task id
+ */
+void Watchdog_TaskAlive(uint8_t task_id);
+
+/**
+ * @brief Kick the IWDG if every expected critical task has checked in
+ *        since the last kick - runs as its own scheduler task
+ */
+void Watchdog_Process(void);
+
+/**
+ * @brief Capture a fault frame into backup RAM and wait for the IWDG
+ *        reset - called from the fault handlers with the stacked frame
+ * @param stacked_frame Exception stack frame (r0-r3, r12, lr, pc, xpsr)
+ * @param fault_type WDG_FAULT_*
+ */
+void Watchdog_FaultCapture(uint32_t *stacked_frame, uint32_t fault_type);
+
+/**
+ * @brief Print supervision state (expected/alive masks, kick counts)
+ */
+void Watchdog_PrintStatus(void);
+
+#endif /* WATCHDOG_H */
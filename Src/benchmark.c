@@ -0,0 +1,368 @@
+/**
+ * @file    benchmark.c
+ * @brief   On-Target Microbenchmark Suite Implementation
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ */
+
+#include "benchmark.h"
+#include "crc_util.h"
+#include "control_algorithms.h"
+#include "fixed_point.h"
+#include "fmt_util.h"
+#include "spi_w5500.h"
+#include "w5500_driver.h"
+#include "flash_25q16.h"
+#include "sd_card.h"
+#include "uart_comm.h"
+#include <stdio.h>
+#include <string.h>
+
+/* ========================================================================== */
+/* CASE TABLE                                                                 */
+/* ========================================================================== */
+
+// A case function runs 'iterations' of its kernel and returns a checksum
+// so the compiler cannot discard the work. fn_b == NULL marks a
+// single-sided case (absolute cost, no comparison).
+typedef uint32_t (*bench_fn_t)(uint32_t iterations);
+
+typedef struct {
+    const char *name;                   // 'bench <name>' selector
+    const char *label_a;                // Baseline variant
+    const char *label_b;                // Optimized variant (NULL = none)
+    bench_fn_t fn_a;
+    bench_fn_t fn_b;
+    uint32_t warmup;                    // Unmeasured iterations
+    uint32_t iterations;                // Measured iterations
+    uint8_t (*available)(void);         // NULL = always runnable
+} BenchCase_t;
+
+static uint32_t Bench_CRC16_Bitwise(uint32_t iterations);
+static uint32_t Bench_CRC16_Table(uint32_t iterations);
+static uint32_t Bench_PID_Float(uint32_t iterations);
+static uint32_t Bench_PID_Q16(uint32_t iterations);
+static uint32_t Bench_Fmt_Snprintf(uint32_t iterations);
+static uint32_t Bench_Fmt_Append(uint32_t iterations);
+static uint32_t Bench_SPI_ByteReads(uint32_t iterations);
+static uint32_t Bench_SPI_BurstRead(uint32_t iterations);
+static uint32_t Bench_Flash_PageProgram(uint32_t iterations);
+static uint32_t Bench_SD_SingleBlock(uint32_t iterations);
+static uint32_t Bench_SD_MultiBlock(uint32_t iterations);
+static uint8_t Bench_W5500_Available(void);
+static uint8_t Bench_Flash_Available(void);
+static uint8_t Bench_SD_Available(void);
+
+static const BenchCase_t bench_cases[] = {
+    { "crc16", "bitwise",  "table",    Bench_CRC16_Bitwise, Bench_CRC16_Table,
+      BENCH_WARMUP_ITERATIONS, BENCH_MEASURED_ITERATIONS, NULL },
+    { "pid",   "float",    "q16",      Bench_PID_Float,     Bench_PID_Q16,
+      BENCH_WARMUP_ITERATIONS, BENCH_MEASURED_ITERATIONS, NULL },
+    { "fmt",   "snprintf", "append",   Bench_Fmt_Snprintf,  Bench_Fmt_Append,
+      BENCH_WARMUP_ITERATIONS, BENCH_MEASURED_ITERATIONS, NULL },
+    { "spi",   "16x byte", "1x burst", Bench_SPI_ByteReads, Bench_SPI_BurstRead,
+      8, 64, Bench_W5500_Available },
+    // One erase then 16 page programs per run - bounded wear per invocation
+    { "flash", "page pgm", NULL,       Bench_Flash_PageProgram, NULL,
+      0, 16, Bench_Flash_Available },
+    { "sd",    "8x1 blk",  "1x8 blk",  Bench_SD_SingleBlock, Bench_SD_MultiBlock,
+      1, 8, Bench_SD_Available },
+};
+#define BENCH_CASE_COUNT (sizeof(bench_cases) / sizeof(bench_cases[0]))
+
+/* Keeps checksums observable so the measured loops cannot be elided */
+static volatile uint32_t bench_sink = 0;
+
+/* ========================================================================== */
+/* CASE BODIES                                                                */
+/* ========================================================================== */
+
+/* ---- CRC16: the bit-by-bit loop crc_util.c replaced vs the table ---- */
+
+#define BENCH_CRC_FRAME_LEN     64
+static uint8_t bench_crc_frame[BENCH_CRC_FRAME_LEN];
+
+static void Bench_FillFrame(void)
+{
+    for (uint16_t i = 0; i < BENCH_CRC_FRAME_LEN; i++) {
+        bench_crc_frame[i] = (uint8_t)(i * 7 + 3);
+    }
+}
+
+static uint32_t Bench_CRC16_Bitwise(uint32_t iterations)
+{
+    uint32_t sum = 0;
+    Bench_FillFrame();
+
+    for (uint32_t it = 0; it < iterations; it++) {
+        uint16_t crc = 0xFFFF;
+        for (uint16_t i = 0; i < BENCH_CRC_FRAME_LEN; i++) {
+            crc ^= bench_crc_frame[i];
+            for (uint8_t b = 0; b < 8; b++) {
+                if (crc & 0x0001) {
+                    crc = (crc >> 1) ^ 0xA001;
+                } else {
+                    crc >>= 1;
+                }
+            }
+        }
+        sum += crc;
+    }
+    return sum;
+}
+
+static uint32_t Bench_CRC16_Table(uint32_t iterations)
+{
+    uint32_t sum = 0;
+    Bench_FillFrame();
+
+    for (uint32_t it = 0; it < iterations; it++) {
+        sum += CRC16_Modbus(bench_crc_frame, BENCH_CRC_FRAME_LEN);
+    }
+    return sum;
+}
+
+/* ---- PID: float loop vs Q16.16 loop on a staggered process value ---- */
+
+static uint32_t Bench_PID_Float(uint32_t iterations)
+{
+    PIDController_t pid;
+    PID_Init(&pid, 1.0f, 0.1f, 0.05f);
+    PID_Enable(&pid, true);
+
+    uint32_t sum = 0;
+    for (uint32_t it = 0; it < iterations; it++) {
+        float pv = 7.0f + (float)(it & 7) * 0.25f;
+        sum += (uint32_t)(PID_Update(&pid, pv, 7.0f) * 100.0f);
+    }
+    return sum;
+}
+
+static uint32_t Bench_PID_Q16(uint32_t iterations)
+{
+    PIDQ16_t pid;
+    PIDQ16_Init(&pid, 1.0f, 0.1f, 0.05f);
+
+    uint32_t sum = 0;
+    for (uint32_t it = 0; it < iterations; it++) {
+        q16_t pv = Q16_FROM_FLOAT(7.0f) + (q16_t)((it & 7) << 14);
+        sum += (uint32_t)PIDQ16_Update(&pid, pv, Q16_FROM_FLOAT(7.0f));
+    }
+    return sum;
+}
+
+/* ---- Formatter: a telemetry-shaped line through both paths ---- */
+
+static uint32_t Bench_Fmt_Snprintf(uint32_t iterations)
+{
+    char line[80];
+    uint32_t sum = 0;
+
+    for (uint32_t it = 0; it < iterations; it++) {
+        int len = snprintf(line, sizeof(line), "T1:%lu.%lu T2:%lu.%lu ST:%u\r\n",
+                           (unsigned long)(it / 10), (unsigned long)(it % 10),
+                           (unsigned long)(it / 7), (unsigned long)(it % 7),
+                           (unsigned)(it & 0xFF));
+        sum += (uint32_t)len + (uint8_t)line[0];
+    }
+    return sum;
+}
+
+static uint32_t Bench_Fmt_Append(uint32_t iterations)
+{
+    char line[80];
+    uint32_t sum = 0;
+
+    for (uint32_t it = 0; it < iterations; it++) {
+        char *p = line;
+        p = Fmt_Str(p, "T1:");
+        p = Fmt_Fixed(p, (int32_t)it, 1);
+        p = Fmt_Str(p, " T2:");
+        p = Fmt_Fixed(p, (int32_t)(it * 10 / 7), 1);
+        p = Fmt_Str(p, " ST:");
+        p = Fmt_U32(p, it & 0xFF);
+        p = Fmt_Str(p, "\r\n");
+        sum += (uint32_t)(p - line) + (uint8_t)line[0];
+    }
+    return sum;
+}
+
+/* ---- W5500 SPI: 16 single-byte register reads vs one 16-byte burst ---- */
+
+static uint8_t Bench_W5500_Available(void)
+{
+    return (W5500_GetVersion() == 0x04) ? 1 : 0;
+}
+
+static uint32_t Bench_SPI_ByteReads(uint32_t iterations)
+{
+    uint32_t sum = 0;
+    for (uint32_t it = 0; it < iterations; it++) {
+        for (uint16_t i = 0; i < 16; i++) {
+            sum += SPI_W5500_ReadRegByte(W5500_SHAR + (i % 6));
+        }
+    }
+    return sum;
+}
+
+static uint32_t Bench_SPI_BurstRead(uint32_t iterations)
+{
+    uint8_t buf[16];
+    uint32_t sum = 0;
+
+    for (uint32_t it = 0; it < iterations; it++) {
+        SPI_W5500_ReadReg(W5500_SHAR, buf, sizeof(buf));
+        sum += buf[0] + buf[15];
+    }
+    return sum;
+}
+
+/* ---- External flash: page program cost into a scratch sector ---- */
+
+// Top 4KB sector of the 25Q16 - above every config/journal region
+#define BENCH_FLASH_SCRATCH_ADDR    0x1FF000UL
+
+static uint8_t Bench_Flash_Available(void)
+{
+    uint8_t manufacturer = 0, device_id = 0;
+    return (Flash_ReadID(&manufacturer, &device_id) == 0) ? 1 : 0;
+}
+
+static uint32_t Bench_Flash_PageProgram(uint32_t iterations)
+{
+    static uint8_t page[256];
+    uint32_t sum = 0;
+
+    for (uint32_t it = 0; it < iterations; it++) {
+        // One erase per 16 pages keeps the sector writable and bounds wear
+        if ((it % 16) == 0) {
+            Flash_EraseSector(BENCH_FLASH_SCRATCH_ADDR);
+        }
+        memset(page, (uint8_t)it, sizeof(page));
+        sum += Flash_WritePage(BENCH_FLASH_SCRATCH_ADDR + (it % 16) * 256,
+                               page, sizeof(page));
+    }
+    return sum;
+}
+
+/* ---- SD card: eight CMD17 single reads vs one CMD18 multi read ---- */
+
+#define BENCH_SD_BLOCK          100000UL    // Ring log superblock region (reads only)
+#define BENCH_SD_BLOCK_COUNT    8
+
+static uint8_t bench_sd_buf[BENCH_SD_BLOCK_COUNT * 512];
+
+static uint8_t Bench_SD_Available(void)
+{
+    return SD_Card_Is_Initialized();
+}
+
+static uint32_t Bench_SD_SingleBlock(uint32_t iterations)
+{
+    uint32_t sum = 0;
+    for (uint32_t it = 0; it < iterations; it++) {
+        for (uint32_t b = 0; b < BENCH_SD_BLOCK_COUNT; b++) {
+            sum += SD_Card_ReadBlocks(bench_sd_buf + b * 512,
+                                      BENCH_SD_BLOCK + b, 1);
+        }
+    }
+    return sum;
+}
+
+static uint32_t Bench_SD_MultiBlock(uint32_t iterations)
+{
+    uint32_t sum = 0;
+    for (uint32_t it = 0; it < iterations; it++) {
+        sum += SD_Card_ReadBlocks(bench_sd_buf, BENCH_SD_BLOCK,
+                                  BENCH_SD_BLOCK_COUNT);
+    }
+    return sum;
+}
+
+/* ========================================================================== */
+/* HARNESS                                                                    */
+/* ========================================================================== */
+
+/**
+ * @brief Warmup then measure one variant, returning average cycles/iteration
+ */
+static uint32_t Benchmark_Measure(bench_fn_t fn, uint32_t warmup, uint32_t iterations)
+{
+    if (warmup > 0) {
+        bench_sink += fn(warmup);
+    }
+
+    uint32_t start = DWT->CYCCNT;
+    bench_sink += fn(iterations);
+    uint32_t elapsed = DWT->CYCCNT - start;
+
+    return elapsed / iterations;
+}
+
+/**
+ * @brief Run one case and print its table row
+ */
+static void Benchmark_RunCase(const BenchCase_t *bc)
+{
+    char msg[120];
+
+    if (bc->available != NULL && !bc->available()) {
+        snprintf(msg, sizeof(msg), "%-6s SKIPPED (hardware not ready)\r\n", bc->name);
+        Send_Debug_Data(msg);
+        return;
+    }
+
+    uint32_t cyc_a = Benchmark_Measure(bc->fn_a, bc->warmup, bc->iterations);
+
+    if (bc->fn_b == NULL) {
+        snprintf(msg, sizeof(msg), "%-6s %-9s %8lu c/it  (%lu iters)\r\n",
+                 bc->name, bc->label_a, (unsigned long)cyc_a,
+                 (unsigned long)bc->iterations);
+        Send_Debug_Data(msg);
+        return;
+    }
+
+    uint32_t cyc_b = Benchmark_Measure(bc->fn_b, bc->warmup, bc->iterations);
+    uint32_t ratio_x10 = (cyc_b > 0) ? (cyc_a * 10U / cyc_b) : 0;
+
+    snprintf(msg, sizeof(msg), "%-6s %-9s %8lu c/it | %-9s %8lu c/it | %lu.%lux\r\n",
+             bc->name, bc->label_a, (unsigned long)cyc_a,
+             bc->label_b, (unsigned long)cyc_b,
+             (unsigned long)(ratio_x10 / 10), (unsigned long)(ratio_x10 % 10));
+    Send_Debug_Data(msg);
+}
+
+void Benchmark_Run(const char *name)
+{
+    uint8_t ran = 0;
+
+    Send_Debug_Data("\r\n=== Microbenchmarks (DWT cycles/iteration) ===\r\n");
+
+    for (uint8_t i = 0; i < BENCH_CASE_COUNT; i++) {
+        if (name != NULL && name[0] != '\0' &&
+            strcmp(name, bench_cases[i].name) != 0) {
+            continue;
+        }
+        Benchmark_RunCase(&bench_cases[i]);
+        ran++;
+    }
+
+    if (ran == 0) {
+        Send_Debug_Data("No such case - 'bench' alone lists and runs all\r\n");
+        Benchmark_List();
+    }
+    Send_Debug_Data("==============================================\r\n\r\n");
+}
+
+void Benchmark_List(void)
+{
+    char msg[80];
+
+    Send_Debug_Data("Cases:");
+    for (uint8_t i = 0; i < BENCH_CASE_COUNT; i++) {
+        snprintf(msg, sizeof(msg), " %s", bench_cases[i].name);
+        Send_Debug_Data(msg);
+    }
+    Send_Debug_Data("\r\n");
+}
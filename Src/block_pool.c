@@ -0,0 +1,130 @@
+/**
+ * @file    block_pool.c
+ * @brief   Fixed-Block Pool Allocator Implementation
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ */
+
+#include "block_pool.h"
+#include "uart_comm.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Registry for the 'pools' stats report */
+static BlockPool_t *pool_registry[BLOCK_POOL_MAX_POOLS];
+static uint8_t pool_registry_count = 0;
+
+void BlockPool_Init(BlockPool_t *pool, const char *name, void *storage,
+                    uint8_t *next, uint16_t block_size, uint8_t block_count)
+{
+    if (pool == NULL || storage == NULL || next == NULL ||
+        block_count == 0 || block_count >= BLOCK_POOL_NONE) {
+        return;
+    }
+
+    pool->name = name;
+    pool->storage = (uint8_t*)storage;
+    pool->next = next;
+    pool->block_size = block_size;
+    pool->block_count = block_count;
+    pool->used = 0;
+    pool->high_water = 0;
+    pool->alloc_total = 0;
+    pool->alloc_failures = 0;
+
+    // Chain every block onto the freelist. The terminator is block_count
+    // (a non-index), leaving BLOCK_POOL_NONE free to mark allocated
+    // blocks so double frees can be detected.
+    for (uint8_t i = 0; i < block_count - 1; i++) {
+        next[i] = i + 1;
+    }
+    next[block_count - 1] = block_count;
+    pool->free_head = 0;
+
+    if (pool_registry_count < BLOCK_POOL_MAX_POOLS) {
+        pool_registry[pool_registry_count++] = pool;
+    }
+}
+
+void *BlockPool_Alloc(BlockPool_t *pool)
+{
+    if (pool == NULL) {
+        return NULL;
+    }
+    if (pool->free_head >= pool->block_count) {
+        pool->alloc_failures++;
+        return NULL;
+    }
+
+    uint8_t index = pool->free_head;
+    pool->free_head = pool->next[index];
+    pool->next[index] = BLOCK_POOL_NONE;    // Marks the block as allocated
+
+    pool->used++;
+    pool->alloc_total++;
+    if (pool->used > pool->high_water) {
+        pool->high_water = pool->used;
+    }
+
+    return &pool->storage[(uint32_t)index * pool->block_size];
+}
+
+void BlockPool_Free(BlockPool_t *pool, void *block)
+{
+    uint8_t index = BlockPool_IndexOf(pool, block);
+    if (index == BLOCK_POOL_NONE) {
+        return;
+    }
+    if (pool->next[index] != BLOCK_POOL_NONE) {
+        return;     // Not allocated (on the freelist) - ignore the double free
+    }
+
+    pool->next[index] = pool->free_head;
+    pool->free_head = index;
+    if (pool->used) {
+        pool->used--;
+    }
+}
+
+uint8_t BlockPool_IndexOf(const BlockPool_t *pool, const void *block)
+{
+    if (pool == NULL || block == NULL) {
+        return BLOCK_POOL_NONE;
+    }
+
+    uint32_t offset = (uint32_t)((const uint8_t*)block - pool->storage);
+    if ((const uint8_t*)block < pool->storage ||
+        offset % pool->block_size != 0 ||
+        offset / pool->block_size >= pool->block_count) {
+        return BLOCK_POOL_NONE;
+    }
+    return (uint8_t)(offset / pool->block_size);
+}
+
+uint8_t BlockPool_Used(const BlockPool_t *pool)
+{
+    return pool ? pool->used : 0;
+}
+
+void BlockPool_PrintStats(void)
+{
+    char msg[120];
+
+    Send_Debug_Data("\r\n=== Block Pools ===\r\n");
+    Send_Debug_Data("Name         Size  Used/Total  HighWater  Allocs     Failures\r\n");
+
+    for (uint8_t i = 0; i < pool_registry_count; i++) {
+        const BlockPool_t *pool = pool_registry[i];
+        snprintf(msg, sizeof(msg), "%-12s %-5u %u/%-9u %-10u %-10lu %lu\r\n",
+                 pool->name ? pool->name : "?", pool->block_size,
+                 pool->used, pool->block_count, pool->high_water,
+                 pool->alloc_total, pool->alloc_failures);
+        Send_Debug_Data(msg);
+    }
+
+    if (pool_registry_count == 0) {
+        Send_Debug_Data("(no pools registered)\r\n");
+    }
+    Send_Debug_Data("===================\r\n\r\n");
+}
@@ -9,6 +9,10 @@
   */
 
 #include "ch_control_core.h"
+#include "ch_control_path.h"
+#include "fault_intake.h"
+#include "mem_placement.h"
+#include "profiler.h"
 #include <stdio.h>
 #include <math.h>
 
@@ -26,7 +30,7 @@ static float load_demand_filtered = 0.0f;
 static float efficiency_filtered = 0.0f;
 
 /* Global Core Control System -----------------------------------------------*/
-ChillerControlCore_t g_chiller_core = {0};
+ChillerControlCore_t g_chiller_core DTCM_BSS;
 uint8_t g_chiller_core_initialized = 0;
 
 /* Private Function Prototypes -----------------------------------------------*/
@@ -139,8 +143,15 @@ ChillerFaultCode_t ChillerCore_InitializeSubsystems(void)
  */
 void ChillerCore_Process(void)
 {
+    static uint8_t prof_id = PROFILER_INVALID_SECTION;
+
     if (!g_chiller_core_initialized) return;
-    
+
+    if (prof_id == PROFILER_INVALID_SECTION) {
+        prof_id = Profiler_RegisterSection("ChillerCore_Process");
+    }
+    Profiler_Begin(prof_id);
+
     uint32_t current_time = HAL_GetTick();
     g_chiller_core.last_process_time = current_time;
     
@@ -177,6 +188,8 @@ void ChillerCore_Process(void)
     // Update subsystem integrations
     ChillerCore_CheckSubsystemStatus();
     ChillerCore_UpdateHMIRegisters();
+
+    Profiler_End(prof_id);
 }
 
 /**
@@ -236,7 +249,7 @@ ChillerFaultCode_t ChillerCore_ExecuteCommand(ChillerSystemCommand_t command)
 /**
  * @brief Main State Machine
  */
-void ChillerCore_StateMachine(void)
+ITCM_FUNC void ChillerCore_StateMachine(void)
 {
     ChillerSystemState_t current_state = g_chiller_core.status.current_state;
     uint32_t state_duration = HAL_GetTick() - g_chiller_core.status.state_enter_time;
@@ -508,8 +521,8 @@ ChillerFaultCode_t ChillerCore_CheckTemperatureFaults(void)
     float supply_setpoint, return_setpoint, tolerance;
     EquipmentConfig_GetTemperatureSetpoints(&supply_setpoint, &return_setpoint, &tolerance);
     
-    // Check if sensors are available for fault detection
-    if (g_equipment_config.sensor_config.supply_sensor_enabled) {
+    // Fault scans were bound in at the last control-path rebind
+    if (ControlPath_Get()->supply_fault_checks) {
         // Get supply temperature from Modbus (placeholder - implement actual sensor read)
         float supply_temp = 8.0f; // TODO: Get from Modbus system
         
@@ -521,8 +534,8 @@ ChillerFaultCode_t ChillerCore_CheckTemperatureFaults(void)
         }
     }
     
-    // Check ambient temperature if sensor available
-    if (g_equipment_config.sensor_config.ambient_sensor_enabled) {
+    // Check ambient temperature if the path bound the ambient scan
+    if (ControlPath_Get()->ambient_fault_checks) {
         float ambient_temp = 38.0f; // TODO: Get from Modbus system
         
         if (ambient_temp > g_equipment_config.high_ambient_alarm_limit) {
@@ -564,15 +577,18 @@ ChillerFaultCode_t ChillerCore_CheckEquipmentFaults(void)
  */
 void ChillerCore_ProcessFaults(ChillerFaultCode_t faults)
 {
+    // Report rising edges only - a fault held across passes is one
+    // event, and the intake's rate limiter handles one that flaps
+    ChillerFaultCode_t new_faults = faults & ~g_chiller_core.status.active_faults;
+
     // Update active faults
     g_chiller_core.status.active_faults = faults;
     g_chiller_core.status.fault_history |= faults;
-    
-    // Log faults to flash
-    if (faults & CH_FAULT_SUPPLY_TEMP_HIGH) {
+
+    if (new_faults & CH_FAULT_SUPPLY_TEMP_HIGH) {
         ChillerCore_LogFault(CH_FAULT_SUPPLY_TEMP_HIGH, "Supply temperature too high");
     }
-    if (faults & CH_FAULT_AMBIENT_TEMP_HIGH) {
+    if (new_faults & CH_FAULT_AMBIENT_TEMP_HIGH) {
         ChillerCore_LogFault(CH_FAULT_AMBIENT_TEMP_HIGH, "Ambient temperature too high");
     }
     // Add more fault logging as needed
@@ -803,13 +819,130 @@ void ChillerCore_CheckSubsystemStatus(void)
     g_chiller_core.equipment_config_ok = g_config_initialized;
 }
 
+/* === HMI VP SHADOW CACHE === */
+
+// One entry per pushed VP register: the last value written to the panel
+// plus the page it lives on. Each update tick transmits only registers
+// that are both on-screen and changed - at 9600 baud the panel link is
+// the narrowest pipe in the system, so a full refresh is multiple
+// seconds while a diff is a handful of frames.
+#define CH_HMI_UPDATE_INTERVAL_MS   250     // Shadow diff tick
+#define CH_HMI_MAX_FRAMES_PER_TICK  4       // Bound on link usage per tick
+
+typedef struct {
+    uint16_t vp_address;                // DWIN VP register
+    uint8_t page;                       // Page showing it (HMI_PAGE_ANY = all)
+    uint16_t value;                     // Freshly computed value
+    uint16_t last_written;              // Shadow of the panel's copy
+    uint8_t written;                    // Shadow valid (first pass writes)
+} HMIShadowEntry_t;
+
+static HMIShadowEntry_t hmi_shadow[] = {
+    { HMI_VP_TEMP,           HMI_PAGE_MAIN, 0, 0, 0 },
+    { HMI_VP_PRESSURE,       HMI_PAGE_MAIN, 0, 0, 0 },
+    { HMI_VP_FLOW,           HMI_PAGE_MAIN, 0, 0, 0 },
+    { HMI_VP_STATUS,         HMI_PAGE_ANY,  0, 0, 0 },
+    { HMI_VP_NETWORK_STATUS, HMI_PAGE_MAIN, 0, 0, 0 },
+    { HMI_VP_MODBUS_STATUS,  HMI_PAGE_MAIN, 0, 0, 0 },
+    { HMI_VP_RELAY_Q06,      HMI_PAGE_IO,   0, 0, 0 },
+    { HMI_VP_RELAY_Q07,      HMI_PAGE_IO,   0, 0, 0 },
+    { HMI_VP_SYSTEM_TIME,    HMI_PAGE_ANY,  0, 0, 0 },
+    { HMI_VP_MESSAGE_COUNT,  HMI_PAGE_IO,   0, 0, 0 },
+};
+#define CH_HMI_SHADOW_COUNT (sizeof(hmi_shadow) / sizeof(hmi_shadow[0]))
+
+static uint32_t hmi_shadow_last_tick = 0;
+static uint8_t hmi_shadow_cursor = 0;       // Round-robin fairness
+
+/**
+ * @brief Compute the current value for every shadowed VP register
+ */
+static void ChillerCore_RefreshHMIShadowValues(void)
+{
+    // Latest performance sample (circular buffer)
+    const ChillerPerformanceData_t* perf = NULL;
+    if (g_chiller_core.performance_count > 0) {
+        uint16_t last = (g_chiller_core.performance_index + CH_PERFORMANCE_HISTORY_SIZE - 1)
+                        % CH_PERFORMANCE_HISTORY_SIZE;
+        perf = &g_chiller_core.performance_history[last];
+    }
+
+    for (uint8_t i = 0; i < CH_HMI_SHADOW_COUNT; i++) {
+        HMIShadowEntry_t* entry = &hmi_shadow[i];
+
+        switch (entry->vp_address) {
+            case HMI_VP_TEMP:
+                // Return water temperature, fixed-point x10
+                entry->value = perf ? (uint16_t)(perf->return_temperature * 10.0f) : 0;
+                break;
+            case HMI_VP_PRESSURE:
+                entry->value = perf ? perf->system_pressure : 0;
+                break;
+            case HMI_VP_FLOW:
+                entry->value = perf ? perf->flow_rate : 0;
+                break;
+            case HMI_VP_STATUS:
+                entry->value = (uint16_t)g_chiller_core.status.current_state;
+                break;
+            case HMI_VP_NETWORK_STATUS:
+                entry->value = g_chiller_core.status.communication_ok ? 1 : 0;
+                break;
+            case HMI_VP_MODBUS_STATUS:
+                entry->value = g_chiller_core.modbus_system_ok ? 1 : 0;
+                break;
+            case HMI_VP_RELAY_Q06:
+                entry->value = Relay_Get(6);
+                break;
+            case HMI_VP_RELAY_Q07:
+                entry->value = Relay_Get(7);
+                break;
+            case HMI_VP_SYSTEM_TIME:
+                entry->value = (uint16_t)(HAL_GetTick() / 1000);
+                break;
+            case HMI_VP_MESSAGE_COUNT:
+                entry->value = (uint16_t)g_chiller_core.status.fault_count;
+                break;
+            default:
+                break;
+        }
+    }
+}
+
 /**
  * @brief Update HMI Registers
+ * @note  Dirty-diff shadow push: every tick, send only VP registers that
+ *        are on the operator's current page (or global) AND differ from
+ *        the last value written. DWIN VPs persist across page changes,
+ *        so returning to a page needs no refresh of unchanged values.
  */
 void ChillerCore_UpdateHMIRegisters(void)
 {
-    // TODO: Update HMI VP registers with current system status
-    // This will be implemented when HMI integration is enhanced
+    if (!g_chiller_core.hmi_system_ok) return;
+
+    uint32_t now = HAL_GetTick();
+    if ((now - hmi_shadow_last_tick) < CH_HMI_UPDATE_INTERVAL_MS) return;
+    hmi_shadow_last_tick = now;
+
+    ChillerCore_RefreshHMIShadowValues();
+
+    uint8_t current_page = HMI_GetCurrentPage();
+    uint8_t frames_sent = 0;
+
+    // Round-robin start point so a steadily changing VP (uptime) cannot
+    // starve the rest when the per-tick frame budget is exhausted
+    for (uint8_t n = 0; n < CH_HMI_SHADOW_COUNT && frames_sent < CH_HMI_MAX_FRAMES_PER_TICK; n++) {
+        uint8_t i = (hmi_shadow_cursor + n) % CH_HMI_SHADOW_COUNT;
+        HMIShadowEntry_t* entry = &hmi_shadow[i];
+
+        if (entry->page != HMI_PAGE_ANY && entry->page != current_page) continue;
+        if (entry->written && entry->value == entry->last_written) continue;
+
+        HMI_Write_VP_Register(entry->vp_address, entry->value);
+        entry->last_written = entry->value;
+        entry->written = 1;
+        frames_sent++;
+        hmi_shadow_cursor = (i + 1) % CH_HMI_SHADOW_COUNT;
+    }
 }
 
 /**
@@ -885,18 +1018,24 @@ ChillerFaultCode_t ChillerCore_ExitMaintenanceMode(void)
 }
 
 /**
- * @brief Log fault to flash configuration system
+ * @brief Report a fault into the central intake
  * @param fault_code: Fault code to log
- * @param description: Human-readable fault description
+ * @param description: Human-readable fault description (string literal)
+ *
+ * All downstream work (alarm record, debug line) happens from the
+ * intake's bounded drain, not here - a fault storm costs this caller
+ * one queue post per occurrence regardless of how fast it flaps.
  */
 void ChillerCore_LogFault(ChillerFaultCode_t fault_code, const char* description)
 {
-    // Use the flash configuration system to log the fault
-    FlashConfig_LogAlarm(fault_code, 1, 0, 0.0f, description);
-    
-    // Send debug message
-    char debug_msg[128];
-    snprintf(debug_msg, sizeof(debug_msg), "Chiller Core: Fault logged - %s (Code: 0x%04X)\r\n", 
-             description, fault_code);
-    Send_Debug_Data(debug_msg);
+    uint8_t severity = FAULT_SEV_HIGH;
+
+    if (fault_code & (CH_FAULT_EMERGENCY_STOP | CH_FAULT_CRITICAL_SYSTEM |
+                      CH_FAULT_FLOW_LOSS | CH_FAULT_POWER_PHASE_LOSS)) {
+        severity = FAULT_SEV_CRITICAL;
+    } else if (fault_code & (CH_FAULT_COMMUNICATION | CH_FAULT_CONFIGURATION)) {
+        severity = FAULT_SEV_WARNING;
+    }
+
+    FaultIntake_Report(fault_code, severity, 0.0f, description);
 }
@@ -0,0 +1,188 @@
+/**
+ * @file    ch_control_path.c
+ * @brief   Sensor-Tier Resolution Implementation
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ */
+
+#include "ch_control_path.h"
+#include "ch_temp_control.h"
+#include "equipment_config.h"
+#include "mem_placement.h"
+#include "uart_comm.h"
+#include <stdio.h>
+
+/* ========================================================================== */
+/* PRIVATE VARIABLES                                                          */
+/* ========================================================================== */
+
+/* Double-buffered descriptors: Rebind builds the inactive copy, then the
+ * pointer swap publishes it in one word write - the tick ISR never sees
+ * a half-built path. */
+static ControlPathDescriptor_t path_buffers[2];
+static ControlPathDescriptor_t * volatile active_path = &path_buffers[0];
+
+/* Design delta-T (return minus supply setpoint), evaluated at bind time
+ * so the estimated-return source is a single add in the tick */
+static float design_delta_t = 5.0f;
+
+/* Change detection and statistics */
+static uint16_t bound_signature = 0xFFFF;
+static uint32_t rebind_count = 0;
+static uint32_t last_rebind_time = 0;
+
+/* ========================================================================== */
+/* BOUND SOURCE AND COMPENSATION FUNCTIONS                                    */
+/* ========================================================================== */
+
+/**
+ * @brief Tier 2/3 temperature source - return water sensor direct
+ */
+ITCM_FUNC static float ControlPath_ReadReturnDirect(void)
+{
+    return temp_control_data.sensors[TEMP_SENSOR_RETURN_WATER].value;
+}
+
+/**
+ * @brief Tier 1 temperature source - supply sensor plus design delta-T
+ */
+ITCM_FUNC static float ControlPath_ReadReturnEstimated(void)
+{
+    return temp_control_data.sensors[TEMP_SENSOR_SUPPLY_WATER].value +
+           design_delta_t;
+}
+
+/**
+ * @brief Tier 0 temperature source - setpoint itself (zero error, PID
+ *        holds its output; never called since pid_enabled is clear, but
+ *        the slot is never left NULL)
+ */
+ITCM_FUNC static float ControlPath_ReadHold(void)
+{
+    return temp_control_data.pid.setpoint;
+}
+
+/**
+ * @brief No-compensation layer
+ */
+ITCM_FUNC static float ControlPath_CompensateNone(float setpoint)
+{
+    return setpoint;
+}
+
+/**
+ * @brief Ambient compensation layer (offset maintained by the 1s pass)
+ */
+ITCM_FUNC static float ControlPath_CompensateAmbient(float setpoint)
+{
+    return setpoint + temp_control_data.ambient_compensation_active;
+}
+
+/* ========================================================================== */
+/* TIER RESOLUTION                                                            */
+/* ========================================================================== */
+
+/**
+ * @brief Availability/mode/config bits that select the bound path
+ */
+static uint16_t ControlPath_Signature(void)
+{
+    uint16_t sig = 0;
+
+    if (temp_control_data.control_mode == TEMP_CONTROL_MODE_AUTO)  sig |= 0x01;
+    if (TempControl_IsSensorValid(TEMP_SENSOR_RETURN_WATER))       sig |= 0x02;
+    if (TempControl_IsSensorValid(TEMP_SENSOR_SUPPLY_WATER))       sig |= 0x04;
+    if (TempControl_IsSensorValid(TEMP_SENSOR_AMBIENT))            sig |= 0x08;
+    if (temp_control_config.auto_compensation_enable)              sig |= 0x10;
+    if (g_equipment_config.sensor_config.ambient_sensor_enabled)   sig |= 0x20;
+    if (g_equipment_config.sensor_config.supply_sensor_enabled)    sig |= 0x40;
+
+    return sig;
+}
+
+/* ========================================================================== */
+/* PUBLIC FUNCTIONS                                                           */
+/* ========================================================================== */
+
+void ControlPath_Init(void)
+{
+    ControlPath_Rebind();
+    Send_Debug_Data("Control Path: Initial tier bound\r\n");
+}
+
+void ControlPath_Rebind(void)
+{
+    ControlPathDescriptor_t *next = (active_path == &path_buffers[0])
+                                        ? &path_buffers[1] : &path_buffers[0];
+
+    uint8_t auto_mode  = (temp_control_data.control_mode == TEMP_CONTROL_MODE_AUTO);
+    uint8_t return_ok  = TempControl_IsSensorValid(TEMP_SENSOR_RETURN_WATER);
+    uint8_t supply_ok  = TempControl_IsSensorValid(TEMP_SENSOR_SUPPLY_WATER);
+    uint8_t ambient_ok = g_equipment_config.sensor_config.ambient_sensor_enabled &&
+                         temp_control_config.auto_compensation_enable &&
+                         TempControl_IsSensorValid(TEMP_SENSOR_AMBIENT);
+
+    // Refresh the design delta-T for the estimated-return source
+    float supply_sp, return_sp, tolerance;
+    EquipmentConfig_GetTemperatureSetpoints(&supply_sp, &return_sp, &tolerance);
+    design_delta_t = return_sp - supply_sp;
+
+    if (auto_mode && return_ok) {
+        next->tier = ambient_ok ? CONTROL_PATH_TIER_COMPENSATED
+                                : CONTROL_PATH_TIER_DIRECT;
+        next->pid_enabled = 1;
+        next->read_control_temp = ControlPath_ReadReturnDirect;
+    } else if (auto_mode && supply_ok) {
+        next->tier = CONTROL_PATH_TIER_ESTIMATED;
+        next->pid_enabled = 1;
+        next->read_control_temp = ControlPath_ReadReturnEstimated;
+    } else {
+        next->tier = CONTROL_PATH_TIER_HOLD;
+        next->pid_enabled = 0;
+        next->read_control_temp = ControlPath_ReadHold;
+    }
+
+    next->compensate_setpoint = ambient_ok ? ControlPath_CompensateAmbient
+                                           : ControlPath_CompensateNone;
+    next->supply_fault_checks  = supply_ok &&
+        g_equipment_config.sensor_config.supply_sensor_enabled;
+    next->ambient_fault_checks =
+        g_equipment_config.sensor_config.ambient_sensor_enabled;
+
+    active_path = next;                 // Single word write publishes it
+    bound_signature = ControlPath_Signature();
+    rebind_count++;
+    last_rebind_time = HAL_GetTick();
+}
+
+void ControlPath_Poll(void)
+{
+    if (ControlPath_Signature() != bound_signature) {
+        ControlPath_Rebind();
+    }
+}
+
+ITCM_FUNC const ControlPathDescriptor_t* ControlPath_Get(void)
+{
+    return active_path;
+}
+
+void ControlPath_PrintStatus(void)
+{
+    static const char *tier_names[] = {
+        "HOLD", "ESTIMATED", "DIRECT", "COMPENSATED"
+    };
+    char msg[120];
+    const ControlPathDescriptor_t *path = active_path;
+
+    Send_Debug_Data("\r\n=== Control Path ===\r\n");
+    snprintf(msg, sizeof(msg), "Tier: %s, PID: %s, delta-T: %.1f\r\n",
+             tier_names[path->tier], path->pid_enabled ? "enabled" : "held",
+             design_delta_t);
+    Send_Debug_Data(msg);
+    snprintf(msg, sizeof(msg), "Rebinds: %lu (last at %lu ms), signature: 0x%02X\r\n",
+             rebind_count, last_rebind_time, bound_signature);
+    Send_Debug_Data(msg);
+    Send_Debug_Data("====================\r\n\r\n");
+}
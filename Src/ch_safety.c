@@ -26,8 +26,12 @@
  */
 
  #include "ch_safety.h"
+ #include "mem_placement.h"
+ #include "profiler.h"
+ #include "event_queue.h"
  #include "hmi.h"
  #include "usart.h"
+ #include "fixed_point.h"
  #include <stdio.h>
  #include <string.h>
  #include <stdlib.h>
@@ -49,6 +53,30 @@
  // Alarm delay tracking
  static uint32_t alarm_delay_timers[SAFETY_ALARM_COUNT];
  static bool alarm_delay_active[SAFETY_ALARM_COUNT];
+
+ // Per-compressor oil thermal state, updated incrementally on each 1s
+ // sample: EMA temperature, filtered rate of rise and a leaky
+ // time-above-alarm integral. A fixed handful of Q16.16 ops per unit,
+ // no history recomputation - all 8 units fit in one normal-check pass.
+ typedef struct {
+     q16_t ema;                  // Filtered oil temperature (°C, Q16.16)
+     q16_t rate;                 // Filtered rate of rise (°C/s, Q16.16)
+     uint32_t above_alarm_ms;    // Leaky integral of time above alarm limit
+     uint32_t last_sample;       // Tick of the previous sample
+     bool derate;                // Staging derate latch
+     bool seeded;                // First sample taken
+ } OilThermal_t;
+
+ static OilThermal_t oil_thermal[SAFETY_MAX_COMPRESSORS];
+
+ // Control tick ISR trip latch: 0 = none, 1 = high pressure,
+ // 2 + n = compressor n discharge temperature. The ISR latches one cause
+ // and the safety task raises the matching alarm/shutdown in task context.
+ #define SAFETY_TICK_TRIP_NONE           0
+ #define SAFETY_TICK_TRIP_HIGH_PRESSURE  1
+ #define SAFETY_TICK_TRIP_COMP_TEMP      2
+ static volatile uint8_t tick_trip_cause = SAFETY_TICK_TRIP_NONE;
+ static volatile uint32_t tick_trip_count = 0;
  
  // ========================================================================
  // PRIVATE FUNCTION PROTOTYPES
@@ -77,6 +105,7 @@
      memset(&safety_config, 0, sizeof(Safety_Config_t));
      memset(alarm_delay_timers, 0, sizeof(alarm_delay_timers));
      memset(alarm_delay_active, 0, sizeof(alarm_delay_active));
+     memset(oil_thermal, 0, sizeof(oil_thermal));
      
      // Set default configuration
      Safety_SetDefaultConfiguration();
@@ -166,137 +195,348 @@
      memset(alarm_delay_active, false, sizeof(alarm_delay_active));
  }
  
+ // ========================================================================
+ // TIME-SLICED CHECK PIPELINE
+ // ========================================================================
+
+ // Every check is registered here with its own period and criticality.
+ // Critical interlocks run whenever due; normal/slow checks are
+ // time-sliced to one per pass, so slow-moving values stop being
+ // re-evaluated every cycle. Each check gets a DWT profiler section
+ // (runtime in the 'profile' report) and a missed-deadline counter
+ // ('safety_checks' console command).
+
+ typedef enum {
+     SAFETY_CHECK_CRITICAL = 0,          // Compressor-protecting interlocks
+     SAFETY_CHECK_NORMAL,                // Standard monitoring
+     SAFETY_CHECK_SLOW                   // Trends and housekeeping
+ } SafetyCheckClass_t;
+
+ typedef struct {
+     const char* name;                   // Profiler section name
+     void (*check_fn)(void);             // The check body
+     uint32_t period_ms;                 // 0 = every pass
+     SafetyCheckClass_t class_level;     // Scheduling class
+     uint32_t last_run;                  // Tick of last execution
+     uint32_t run_count;                 // Executions
+     uint32_t missed_deadlines;          // Ran > 1.5x period late
+     uint8_t prof_id;                    // DWT profiler section
+ } SafetyCheck_t;
+
+ static void Safety_CheckTask_EStopPhase(void);
+ static void Safety_CheckTask_CompTempTrip(void);
+ static void Safety_CheckTask_HighPressureTrip(void);
+ static void Safety_CheckTask_Temperatures(void);
+ static void Safety_CheckTask_Pressures(void);
+ static void Safety_CheckTask_DigitalInputs(void);
+ static void Safety_CheckTask_AmbientAdapt(void);
+ static void Safety_CheckTask_LockoutExpiry(void);
+
+ static SafetyCheck_t safety_checks[] = {
+     { "Saf_EStop",     Safety_CheckTask_EStopPhase,       0,    SAFETY_CHECK_CRITICAL, 0, 0, 0, PROFILER_INVALID_SECTION },
+     { "Saf_CompTrip",  Safety_CheckTask_CompTempTrip,     100,  SAFETY_CHECK_CRITICAL, 0, 0, 0, PROFILER_INVALID_SECTION },
+     { "Saf_HiPress",   Safety_CheckTask_HighPressureTrip, 100,  SAFETY_CHECK_CRITICAL, 0, 0, 0, PROFILER_INVALID_SECTION },
+     { "Saf_Temps",     Safety_CheckTask_Temperatures,     1000, SAFETY_CHECK_NORMAL,   0, 0, 0, PROFILER_INVALID_SECTION },
+     { "Saf_Press",     Safety_CheckTask_Pressures,        1000, SAFETY_CHECK_NORMAL,   0, 0, 0, PROFILER_INVALID_SECTION },
+     { "Saf_DigIn",     Safety_CheckTask_DigitalInputs,    1000, SAFETY_CHECK_NORMAL,   0, 0, 0, PROFILER_INVALID_SECTION },
+     { "Saf_Ambient",   Safety_CheckTask_AmbientAdapt,     5000, SAFETY_CHECK_SLOW,     0, 0, 0, PROFILER_INVALID_SECTION },
+     { "Saf_Lockout",   Safety_CheckTask_LockoutExpiry,    5000, SAFETY_CHECK_SLOW,     0, 0, 0, PROFILER_INVALID_SECTION },
+ };
+ #define SAFETY_CHECK_COUNT (sizeof(safety_checks) / sizeof(safety_checks[0]))
+
+ /**
+  * @brief Run one registered check with runtime and deadline accounting
+  */
+ static void Safety_RunCheck(SafetyCheck_t* check, uint32_t now)
+ {
+     if (check->prof_id == PROFILER_INVALID_SECTION) {
+         check->prof_id = Profiler_RegisterSection(check->name);
+     }
+
+     // Deadline monitoring: a periodic check arriving at more than 1.5x
+     // its period has been starved by something upstream
+     if (check->period_ms > 0 && check->run_count > 0 &&
+         (now - check->last_run) > (check->period_ms + check->period_ms / 2)) {
+         check->missed_deadlines++;
+     }
+
+     Profiler_Begin(check->prof_id);
+     check->check_fn();
+     Profiler_End(check->prof_id);
+
+     check->last_run = now;
+     check->run_count++;
+ }
+
+ /**
+  * @brief Print the check table ('safety_checks' console command)
+  */
+ void Safety_PrintCheckTable(void)
+ {
+     static const char* class_names[] = { "CRIT", "NORM", "SLOW" };
+     char msg[100];
+
+     Send_Debug_Data("=== Safety Check Pipeline ===\r\n");
+     Send_Debug_Data("Check         Class Period    Runs    Missed\r\n");
+
+     for (uint8_t i = 0; i < SAFETY_CHECK_COUNT; i++) {
+         const SafetyCheck_t* check = &safety_checks[i];
+         snprintf(msg, sizeof(msg), "%-13s %-5s %5lums %8lu %6lu\r\n",
+                  check->name, class_names[check->class_level],
+                  check->period_ms, check->run_count, check->missed_deadlines);
+         Send_Debug_Data(msg);
+     }
+     Send_Debug_Data("Per-check runtimes: see 'profile' report\r\n");
+ }
+
  // ========================================================================
  // MAIN PROCESSING FUNCTIONS
  // ========================================================================
- 
+
  /**
   * @brief Main safety system processing function
   * Call this from your main loop every 100ms or faster
+  * @note  Critical interlocks run whenever due; normal/slow checks are
+  *        time-sliced to one per pass to bound the pass runtime
   */
  void Safety_Process(void)
  {
      if (!safety_initialized) {
          return;
      }
-     
+
      uint32_t current_time = HAL_GetTick();
-     
+
+     // Consume a control-tick trip first: the ISR already dropped the
+     // relays, this does the shutdown/alarm bookkeeping it could not
+     uint8_t tick_trip = tick_trip_cause;
+     if (tick_trip != SAFETY_TICK_TRIP_NONE) {
+         if (tick_trip == SAFETY_TICK_TRIP_HIGH_PRESSURE) {
+             Safety_SystemShutdown("High pressure trip (control tick)");
+         } else {
+             snprintf(debug_buffer, sizeof(debug_buffer),
+                     "Compressor %d temperature trip (control tick)",
+                     tick_trip - SAFETY_TICK_TRIP_COMP_TEMP + 1);
+             Safety_SystemShutdown(debug_buffer);
+         }
+         tick_trip_cause = SAFETY_TICK_TRIP_NONE;
+     }
+
      // Process alarm delays
      Safety_ProcessAlarmDelays();
-     
-     // Fast checks (critical safety - every 100ms)
-     if (current_time - safety_system.last_fast_check >= SAFETY_FAST_CHECK_INTERVAL) {
-         Safety_ProcessFastChecks();
-         safety_system.last_fast_check = current_time;
-     }
-     
-     // Normal checks (standard monitoring - every 1 second)
-     if (current_time - safety_system.last_normal_check >= SAFETY_NORMAL_CHECK_INTERVAL) {
-         Safety_ProcessNormalChecks();
-         safety_system.last_normal_check = current_time;
+
+     // Critical interlocks: every one that is due runs, every pass
+     for (uint8_t i = 0; i < SAFETY_CHECK_COUNT; i++) {
+         SafetyCheck_t* check = &safety_checks[i];
+         if (check->class_level != SAFETY_CHECK_CRITICAL) continue;
+         if (check->period_ms == 0 ||
+             (current_time - check->last_run) >= check->period_ms) {
+             Safety_RunCheck(check, current_time);
+         }
      }
-     
-     // Slow checks (system health - every 5 seconds)
-     if (current_time - safety_system.last_slow_check >= SAFETY_SLOW_CHECK_INTERVAL) {
-         Safety_ProcessSlowChecks();
-         safety_system.last_slow_check = current_time;
+
+     // Normal/slow checks: one due check per pass (time slice)
+     for (uint8_t i = 0; i < SAFETY_CHECK_COUNT; i++) {
+         SafetyCheck_t* check = &safety_checks[i];
+         if (check->class_level == SAFETY_CHECK_CRITICAL) continue;
+         if ((current_time - check->last_run) >= check->period_ms) {
+             Safety_RunCheck(check, current_time);
+             break;
+         }
      }
-     
+
      // Update overall system state
      Safety_UpdateSystemState();
-     
+
      // Update HMI with current status
      Safety_UpdateHMI();
  }
  
  /**
-  * @brief Fast safety checks (100ms interval) - Critical safety functions
+  * @brief E-stop and phase interlock - runs every pass
   */
- void Safety_ProcessFastChecks(void)
+ ITCM_FUNC static void Safety_CheckTask_EStopPhase(void)
  {
+     // Consume EXTI fast-path trips first: the ISR already dropped the
+     // compressor relays, this raises the matching alarm in task context
+     uint16_t exti_trips = GPIO_GetAndClearSafetyTrips();
+     if (exti_trips & (1 << GPIO_INPUT_EMERGENCY_STOP)) {
+         safety_system.emergency_stop = true;
+         Safety_SetAlarm(SAFETY_ALARM_EMERGENCY_STOP, SAFETY_LEVEL_EMERGENCY,
+                        "Emergency stop (EXTI fast path)");
+         Safety_EmergencyStop("Emergency stop button pressed");
+         return;
+     }
+     if (exti_trips & (1 << GPIO_INPUT_PHASE_MONITOR)) {
+         Safety_SetAlarm(SAFETY_ALARM_PHASE_LOSS, SAFETY_LEVEL_CRITICAL,
+                        "Phase loss (EXTI fast path)");
+         Safety_SystemShutdown("Phase monitor trip");
+         return;
+     }
+
      // Emergency stop check (highest priority)
      if (safety_config.digital_input_monitoring_enable) {
          if (!Safety_CheckEmergencyStop()) {
              Safety_EmergencyStop("Emergency stop button pressed");
-             return;
          }
      }
-     
-     // Critical temperature checks
-     if (safety_config.temperature_protection_enable) {
-         for (uint8_t i = 0; i < SAFETY_MAX_COMPRESSORS; i++) {
-             if (EquipmentConfig_IsCompressorInstalled(i)) {
-                 // Check for trip-level temperatures
-                 bool temp_valid = false;
-                 float temp = Safety_GetSensorValue(MODBUS_SENSOR_COMP_TEMP_1 + i, &temp_valid);
-                 
-                 if (temp_valid && temp > safety_config.compressor_temp_trip_limit) {
-                     snprintf(debug_buffer, sizeof(debug_buffer), 
-                             "Compressor %d temperature trip: %.1f°C", i + 1, temp);
-                     Safety_SystemShutdown(debug_buffer);
-                     return;
-                 }
+ }
+
+ /**
+  * @brief Trip-level compressor temperature interlock (100ms)
+  */
+ ITCM_FUNC static void Safety_CheckTask_CompTempTrip(void)
+ {
+     if (!safety_config.temperature_protection_enable) return;
+
+     for (uint8_t i = 0; i < SAFETY_MAX_COMPRESSORS; i++) {
+         if (EquipmentConfig_IsCompressorInstalled(i)) {
+             // Check for trip-level temperatures
+             bool temp_valid = false;
+             float temp = Safety_GetSensorValue(MODBUS_SENSOR_COMP_TEMP_1 + i, &temp_valid);
+
+             if (temp_valid && temp > safety_config.compressor_temp_trip_limit) {
+                 snprintf(debug_buffer, sizeof(debug_buffer),
+                         "Compressor %d temperature trip: %.1f°C", i + 1, temp);
+                 Safety_SystemShutdown(debug_buffer);
+                 return;
              }
          }
      }
-     
-     // Critical pressure checks
+ }
+
+ /**
+  * @brief Trip-level high pressure interlock (100ms)
+  */
+ ITCM_FUNC static void Safety_CheckTask_HighPressureTrip(void)
+ {
+     if (!safety_config.pressure_protection_enable) return;
+
+     if (!Safety_CheckHighPressure()) {
+         Safety_SystemShutdown("High pressure trip");
+     }
+ }
+
+ /**
+  * @brief Trip scan for the 10ms control tick (control_tick.c)
+  * @note  Interrupt context - reads the published snapshot, drops the
+  *        compressor relays directly on a trip and latches one cause for
+  *        Safety_Process to turn into the alarm/lockout in task context.
+  *        No logging, no snprintf, no driver calls in here.
+  */
+ ITCM_FUNC void Safety_TickISR(void)
+ {
+     if (!safety_initialized || tick_trip_cause != SAFETY_TICK_TRIP_NONE) {
+         return;
+     }
+
+     bool valid = false;
+
      if (safety_config.pressure_protection_enable) {
-         if (!Safety_CheckHighPressure()) {
-             Safety_SystemShutdown("High pressure trip");
+         float pressure = Safety_GetSensorValue(MODBUS_SENSOR_HIGH_PRESSURE, &valid);
+         if (valid && pressure > safety_config.high_pressure_trip_limit) {
+             GPIO_FastTripDropCompressors();
+             tick_trip_cause = SAFETY_TICK_TRIP_HIGH_PRESSURE;
+             tick_trip_count++;
+             EventQueue_Post(EVENT_SAFETY_TRIP, tick_trip_cause, 0);
              return;
          }
      }
+
+     if (safety_config.temperature_protection_enable) {
+         for (uint8_t i = 0; i < SAFETY_MAX_COMPRESSORS; i++) {
+             if (!EquipmentConfig_IsCompressorInstalled(i)) continue;
+
+             float temp = Safety_GetSensorValue(MODBUS_SENSOR_COMP_TEMP_1 + i, &valid);
+             if (valid && temp > safety_config.compressor_temp_trip_limit) {
+                 GPIO_FastTripDropCompressors();
+                 tick_trip_cause = SAFETY_TICK_TRIP_COMP_TEMP + i;
+                 tick_trip_count++;
+                 EventQueue_Post(EVENT_SAFETY_TRIP, tick_trip_cause, 0);
+                 return;
+             }
+         }
+     }
  }
- 
- /**
-  * @brief Normal safety checks (1 second interval)
-  */
- void Safety_ProcessNormalChecks(void)
+
+ static void Safety_CheckTask_Temperatures(void)
  {
-     // Temperature monitoring
      if (safety_config.temperature_protection_enable) {
          Safety_CheckTemperatures();
      }
-     
-     // Pressure monitoring
+ }
+
+ static void Safety_CheckTask_Pressures(void)
+ {
      if (safety_config.pressure_protection_enable) {
          Safety_CheckPressures();
      }
-     
-     // Digital input monitoring
+ }
+
+ static void Safety_CheckTask_DigitalInputs(void)
+ {
      if (safety_config.digital_input_monitoring_enable) {
          Safety_CheckDigitalInputs();
      }
  }
- 
+
  /**
-  * @brief Slow safety checks (5 second interval)
+  * @brief Ambient trend monitoring and pressure limit adaptation (5s)
   */
- void Safety_ProcessSlowChecks(void)
+ static void Safety_CheckTask_AmbientAdapt(void)
  {
-     // Adapt pressure limits based on ambient temperature
      bool ambient_valid = false;
      float ambient_temp = Safety_GetSensorValue(MODBUS_SENSOR_AMBIENT_TEMP, &ambient_valid);
-     
+
      if (ambient_valid) {
          Safety_AdaptPressureLimitsForAmbient(ambient_temp);
          safety_system.ambient_temp = ambient_temp;
-         
+
          // Check for extreme ambient conditions
          if (ambient_temp > SAFETY_AMBIENT_CRITICAL) {
              Safety_SetAlarm(SAFETY_ALARM_HIGH_AMBIENT_TEMP, SAFETY_LEVEL_CRITICAL,
                            "Critical ambient temperature - system protection active");
          }
      }
-     
-     // Check for lockout expiration
+ }
+
+ static void Safety_CheckTask_LockoutExpiry(void)
+ {
      if (Safety_IsSystemLocked() && HAL_GetTick() > safety_system.lockout_end_time) {
          Safety_SendDebugMessage("Safety: Lockout period expired");
          Safety_LogEvent("Safety lockout expired", SAFETY_LEVEL_INFO);
      }
  }
+
+ /**
+  * @brief Fast safety checks - kept as a manual trigger; the scheduled
+  *        path runs these through the check table
+  */
+ ITCM_FUNC void Safety_ProcessFastChecks(void)
+ {
+     Safety_CheckTask_EStopPhase();
+     Safety_CheckTask_CompTempTrip();
+     Safety_CheckTask_HighPressureTrip();
+ }
+
+ /**
+  * @brief Normal safety checks - manual trigger for the 1s check group
+  */
+ ITCM_FUNC void Safety_ProcessNormalChecks(void)
+ {
+     Safety_CheckTask_Temperatures();
+     Safety_CheckTask_Pressures();
+     Safety_CheckTask_DigitalInputs();
+ }
+
+ /**
+  * @brief Slow safety checks - manual trigger for the 5s check group
+  */
+ void Safety_ProcessSlowChecks(void)
+ {
+     Safety_CheckTask_AmbientAdapt();
+     Safety_CheckTask_LockoutExpiry();
+ }
  
  // ========================================================================
  // TEMPERATURE MONITORING
@@ -350,22 +590,95 @@
      return true;
  }
  
+ /**
+  * @brief Incremental oil thermal state update - O(1) per sample
+  *
+  * The derate latch engages on a fast rise close to the alarm limit or a
+  * sustained excursion above it, and clears only once the unit has cooled
+  * out of the window and the excursion integral has drained.
+  */
+ static void Safety_UpdateOilThermal(uint8_t compressor_id, float temp)
+ {
+     OilThermal_t* ot = &oil_thermal[compressor_id];
+     uint32_t now = HAL_GetTick();
+     q16_t sample = Q16_FROM_FLOAT(temp);
+
+     if (!ot->seeded) {
+         ot->ema = sample;
+         ot->rate = 0;
+         ot->above_alarm_ms = 0;
+         ot->last_sample = now;
+         ot->derate = false;
+         ot->seeded = true;
+         return;
+     }
+
+     uint32_t dt_ms = now - ot->last_sample;
+     ot->last_sample = now;
+     if (dt_ms == 0) return;
+     if (dt_ms > 10000) dt_ms = 10000;   // Clamp after sensor gaps
+
+     // EMA of the oil temperature, then filtered rate of rise in °C/s
+     q16_t previous = ot->ema;
+     FilterQ16_Update(&ot->ema, sample, Q16_FROM_FLOAT(SAFETY_OIL_EMA_FACTOR));
+     q16_t rate_inst = (q16_t)(((int64_t)(ot->ema - previous) * 1000) / dt_ms);
+     FilterQ16_Update(&ot->rate, rate_inst, Q16_FROM_FLOAT(SAFETY_OIL_RATE_ALPHA));
+
+     // Leaky excursion integral: charges in real time above the alarm
+     // limit, drains at double rate below it
+     q16_t alarm_limit = Q16_FROM_FLOAT(safety_config.oil_temp_alarm_limit);
+     if (ot->ema > alarm_limit) {
+         ot->above_alarm_ms += dt_ms;
+         if (ot->above_alarm_ms > SAFETY_OIL_INTEGRAL_TRIP_MS) {
+             ot->above_alarm_ms = SAFETY_OIL_INTEGRAL_TRIP_MS;
+         }
+     } else if (ot->above_alarm_ms > 0) {
+         uint32_t drain = dt_ms * 2;
+         ot->above_alarm_ms = (ot->above_alarm_ms > drain) ? ot->above_alarm_ms - drain : 0;
+     }
+
+     bool near_alarm = ot->ema > (alarm_limit - Q16_FROM_FLOAT(SAFETY_OIL_DERATE_MARGIN));
+     if ((near_alarm && ot->rate > Q16_FROM_FLOAT(SAFETY_OIL_RATE_DERATE)) ||
+         ot->above_alarm_ms >= SAFETY_OIL_INTEGRAL_DERATE_MS) {
+         ot->derate = true;
+     } else if (!near_alarm && ot->above_alarm_ms == 0) {
+         ot->derate = false;
+     }
+ }
+
  /**
   * @brief Check oil temperature for specific compressor
   */
  bool Safety_CheckOilTemperature(uint8_t compressor_id)
  {
      if (compressor_id >= SAFETY_MAX_COMPRESSORS) return false;
-     
+
      bool temp_valid = false;
      float temp = Safety_GetSensorValue(MODBUS_SENSOR_OIL_TEMP_1 + compressor_id, &temp_valid);
-     
+
      if (!temp_valid) {
-         return false; // Oil temp sensors may not be installed on all units
+         // Oil temp sensors may not be installed on all units; drop the
+         // thermal state so a stale derate cannot block staging
+         oil_thermal[compressor_id].seeded = false;
+         oil_thermal[compressor_id].derate = false;
+         return false;
      }
-     
+
      safety_system.oil_temps[compressor_id] = temp;
-     
+
+     bool was_derated = oil_thermal[compressor_id].derate;
+     Safety_UpdateOilThermal(compressor_id, temp);
+
+     // Sustained excursion above the alarm limit trips before the oil
+     // ever reaches the instantaneous trip temperature
+     if (oil_thermal[compressor_id].above_alarm_ms >= SAFETY_OIL_INTEGRAL_TRIP_MS) {
+         snprintf(debug_buffer, sizeof(debug_buffer),
+                 "Compressor %d oil temperature sustained above %.0f°C",
+                 compressor_id + 1, safety_config.oil_temp_alarm_limit);
+         Safety_SystemShutdown(debug_buffer);
+         return false;
+     }
+
      // Check for trip level (critical)
      if (temp > safety_config.oil_temp_trip_limit) {
          snprintf(debug_buffer, sizeof(debug_buffer),
@@ -373,16 +686,42 @@
          Safety_SystemShutdown(debug_buffer);
          return false;
      }
-     
+
      // Check for alarm level
      if (temp > safety_config.oil_temp_alarm_limit) {
          snprintf(debug_buffer, sizeof(debug_buffer),
                  "Compressor %d oil temperature high: %.1f°C", compressor_id + 1, temp);
          Safety_SetAlarm(SAFETY_ALARM_COMPRESSOR_OIL_TEMP_HIGH, SAFETY_LEVEL_ALARM, debug_buffer);
      }
-     
+
+     // Announce staging derates as they engage
+     if (!was_derated && oil_thermal[compressor_id].derate) {
+         snprintf(debug_buffer, sizeof(debug_buffer),
+                 "Compressor %d oil thermal derate (%.1f°C, %+.2f°C/s)",
+                 compressor_id + 1, temp, Q16_TO_FLOAT(oil_thermal[compressor_id].rate));
+         Safety_SetAlarm(SAFETY_ALARM_COMPRESSOR_OIL_TEMP_HIGH, SAFETY_LEVEL_WARNING, debug_buffer);
+     }
+
      return true;
  }
+
+ /**
+  * @brief Is the compressor derated for staging by its oil thermal state?
+  */
+ bool Safety_GetOilDerate(uint8_t compressor_id)
+ {
+     if (compressor_id >= SAFETY_MAX_COMPRESSORS) return false;
+     return oil_thermal[compressor_id].derate;
+ }
+
+ /**
+  * @brief Filtered oil temperature rate of rise in °C/s
+  */
+ float Safety_GetOilTempRate(uint8_t compressor_id)
+ {
+     if (compressor_id >= SAFETY_MAX_COMPRESSORS) return 0.0f;
+     return Q16_TO_FLOAT(oil_thermal[compressor_id].rate);
+ }
  
  /**
   * @brief Check return water temperature
@@ -884,13 +1223,18 @@
   */
  static float Safety_GetSensorValue(uint8_t sensor_id, bool* is_valid)
  {
-     // Use modbus sensor system to read values
-     ModbusSensorData_t sensor_data;
-     if (ModbusSensor_GetSensorData(sensor_id, &sensor_data)) {
-         *is_valid = sensor_data.valid;
-         return sensor_data.value;
+     // Read from the published Modbus snapshot so every safety check in
+     // one pass sees the same dated view; stale snapshots age out to
+     // invalid instead of silently reusing old readings
+     if (sensor_id >= 1 && sensor_id <= 4 &&
+         Modbus_SnapshotAge() < MODBUS_SNAPSHOT_MAX_AGE_MS) {
+         const ModbusSnapshot_t* snap = Modbus_GetSnapshot();
+         uint8_t slot = sensor_id - 1;
+
+         *is_valid = (snap->valid_mask & (1 << slot)) ? true : false;
+         return snap->temperatures[slot];
      }
-     
+
      *is_valid = false;
      return 0.0f;
  }
@@ -986,9 +1330,19 @@
               safety_system.ambient_temp);
      Safety_SendDebugMessage(debug_buffer);
      
-     snprintf(debug_buffer, sizeof(debug_buffer), "Pressures: %.1f/%.1f bar", 
+     snprintf(debug_buffer, sizeof(debug_buffer), "Pressures: %.1f/%.1f bar",
               safety_system.high_pressure, safety_system.low_pressure);
      Safety_SendDebugMessage(debug_buffer);
+
+     for (uint8_t i = 0; i < SAFETY_MAX_COMPRESSORS; i++) {
+         if (!oil_thermal[i].seeded) continue;
+         snprintf(debug_buffer, sizeof(debug_buffer),
+                 "Oil %d: %.1f°C %+.2f°C/s above-alarm %lums%s", i + 1,
+                 Q16_TO_FLOAT(oil_thermal[i].ema), Q16_TO_FLOAT(oil_thermal[i].rate),
+                 oil_thermal[i].above_alarm_ms,
+                 oil_thermal[i].derate ? " DERATE" : "");
+         Safety_SendDebugMessage(debug_buffer);
+     }
  }
  
  /**
@@ -21,9 +21,12 @@
  */
 
  #include "ch_staging.h"
+ #include "mem_placement.h"
  #include "equipment_config.h"
  #include "flash_config.h"
+ #include "ch_safety.h"
  #include "gpio_manager.h"
+ #include "priority_index.h"
  #include "uart_comm.h"
  #include "main.h"
  #include <string.h>
@@ -35,7 +38,7 @@
  // ========================================================================
  
  // Main staging system structure
- ChillerStaging_t g_staging_system;
+ ChillerStaging_t g_staging_system DTCM_BSS;
  
  // Static variables for timing and control
  static uint32_t s_last_debug_time = 0;
@@ -61,8 +64,67 @@
      CONDENSER_BANK_4_RELAY   // 11 = PC1 (Relay11)
  };
  
+ // ========================================================================
+ // PRECOMPUTED STAGING SCHEDULE
+ // ========================================================================
+
+ // Flat per-mode decision table: one entry per demand band holding the
+ // target equipment counts and capacity tier. Rebuilt at init and when
+ // the capacity mode or available equipment changes, so the per-tick
+ // staging decision collapses to a band lookup plus edge hysteresis.
+ #define STAGING_DEMAND_BANDS        10      // 10% wide demand bands
+ #define STAGING_BAND_HYST_PCT       2.0f    // Band-edge hysteresis (%)
+
+ typedef struct {
+     uint8_t target_compressors;     // Compressors for this demand band
+     uint8_t target_condensers;      // Condenser banks for this band
+     uint8_t capacity_tier;          // Tier (1-4) this band lands in
+ } StagingScheduleEntry_t;
+
+ static StagingScheduleEntry_t s_staging_schedule[STAGING_DEMAND_BANDS + 1];
+ static CapacityMode_t s_schedule_mode = CAPACITY_MODE_NORMAL;
+ static uint8_t s_schedule_avail_comp = 0xFF;
+ static uint8_t s_schedule_avail_cond = 0xFF;
+ static uint8_t s_current_band = 0;
+
+ // Runtime-balancing priority indexes: ordered by runtime minutes and
+ // repositioned only when a unit's hours change, so the RUNTIME_BALANCED
+ // selection is a walk from one end of an already sorted array
+ static PriorityIndex_t s_comp_priority;
+ static PriorityIndex_t s_cond_priority;
+
+ // ========================================================================
+ // COMPRESSOR START STAGGER SEQUENCER
+ // ========================================================================
+
+ // When the staging target rises by N units, the N starts are laid out
+ // up front as a timed schedule, spaced by the active mode's staging
+ // delay, and executed from Staging_Process() as their due times
+ // arrive. Site breakers see one inrush at a time on a known cadence,
+ // the transition as a whole is visible (pending count, time to next
+ // start), and a target drop simply cancels queued starts from the
+ // tail before any running unit is stopped.
+
+ typedef struct {
+     uint8_t compressor_index;       // Unit booked for this start slot
+     uint32_t due_time;              // HAL tick when the start fires
+ } StaggerEntry_t;
+
+ static StaggerEntry_t s_stagger_queue[MAX_COMPRESSORS];
+ static uint8_t s_stagger_count = 0;     // Pending scheduled starts
+
  // Static function prototypes
  static void Staging_InitializeDefaults(void);
+ static void Staging_RebuildSchedule(void);
+ static void Staging_SeedPriorityIndexes(void);
+ static bool Staging_CompressorEligibleToStart(uint8_t index);
+ static bool Staging_CompressorEligibleToStop(uint8_t index);
+ static bool Staging_CompressorEligibleToSchedule(uint8_t index);
+ static bool Staging_CompressorIsQueued(uint8_t index);
+ static void Staging_BuildStaggerSchedule(uint8_t starts_needed);
+ static void Staging_ExecuteStaggerSchedule(void);
+ static bool Staging_CondenserEligibleToStart(uint8_t index);
+ static bool Staging_CondenserEligibleToStop(uint8_t index);
  static void Staging_UpdateEquipmentAvailability(void);
  static bool Staging_IsCompressorReadyToStart(uint8_t index);
  static bool Staging_IsCompressorReadyToStop(uint8_t index);
@@ -97,7 +159,13 @@
      
      // Update equipment availability based on equipment config
      Staging_UpdateEquipmentAvailability();
-     
+
+     // Build the per-mode staging schedule table
+     Staging_RebuildSchedule();
+
+     // Seed the runtime-balancing priority indexes from loaded counters
+     Staging_SeedPriorityIndexes();
+
      // Initialize timing
      g_staging_system.last_process_time = HAL_GetTick();
      s_last_debug_time = HAL_GetTick();
@@ -157,9 +225,6 @@
          g_staging_system.compressors[i].enabled = true;
          g_staging_system.compressors[i].available = true;
          g_staging_system.compressors[i].performance_rating = 1.0f;
-         
-         // Ensure relay is off
-         Relay_Set(compressor_relay_map[i], 0);
      }
      
      // Initialize all condensers
@@ -175,11 +240,19 @@
          g_staging_system.condensers[i].enabled = true;
          g_staging_system.condensers[i].available = true;
          g_staging_system.condensers[i].cooling_efficiency = 1.0f;
-         
-         // Ensure relay is off
-         Relay_Set(condenser_relay_map[i], 0);
      }
-     
+
+     // Ensure all equipment relays are off - one group commit instead of
+     // twelve individual relay writes
+     uint16_t desired_relays = Relay_GetAll();
+     for (uint8_t i = 0; i < MAX_COMPRESSORS; i++) {
+         desired_relays &= (uint16_t)~(1 << compressor_relay_map[i]);
+     }
+     for (uint8_t i = 0; i < MAX_CONDENSER_BANKS; i++) {
+         desired_relays &= (uint16_t)~(1 << condenser_relay_map[i]);
+     }
+     Relay_CommitGroup(desired_relays);
+
      // Initialize lead/lag rotation
      g_staging_system.next_compressor_to_start = 0;
      g_staging_system.next_compressor_to_stop = 0;
@@ -301,40 +374,131 @@
      return true;
  }
  
+ /**
+  * Rebuild the flat decision table for the active capacity mode.
+  * Each demand band is evaluated once through the four-tier calculation
+  * and clamped to the mode limits from equipment_config, so the per-tick
+  * path never re-runs the mode/tier branching.
+  */
+ static void Staging_RebuildSchedule(void)
+ {
+     CapacityMode_t mode = EquipmentConfig_GetCapacityMode();
+     const CapacityModeConfig_t* mode_cfg = &g_equipment_config.mode_configs[mode];
+     float band_width = 100.0f / STAGING_DEMAND_BANDS;
+
+     for (uint8_t band = 0; band <= STAGING_DEMAND_BANDS; band++) {
+         StagingScheduleEntry_t* entry = &s_staging_schedule[band];
+         float band_capacity = (float)band * band_width;
+
+         uint8_t compressors = Staging_CalculateRequiredCompressors(band_capacity);
+         if (compressors > mode_cfg->max_compressors) {
+             compressors = mode_cfg->max_compressors;
+         }
+
+         uint8_t condensers = Staging_CalculateRequiredCondensers(compressors);
+         if (condensers > mode_cfg->max_condenser_banks) {
+             condensers = mode_cfg->max_condenser_banks;
+         }
+
+         entry->target_compressors = compressors;
+         entry->target_condensers = condensers;
+
+         if (compressors <= CAPACITY_TIER_1) {
+             entry->capacity_tier = 1;
+         } else if (compressors <= CAPACITY_TIER_2) {
+             entry->capacity_tier = 2;
+         } else if (compressors <= CAPACITY_TIER_3) {
+             entry->capacity_tier = 3;
+         } else {
+             entry->capacity_tier = 4;
+         }
+     }
+
+     // Minimum dwell between stage moves comes from the mode config
+     g_staging_system.control.staging_delay_compressor = mode_cfg->staging_delay_ms;
+
+     s_schedule_mode = mode;
+     s_schedule_avail_comp = g_staging_system.status.available_compressor_count;
+     s_schedule_avail_cond = g_staging_system.status.available_condenser_count;
+
+     char debug_msg[100];
+     snprintf(debug_msg, sizeof(debug_msg),
+              "STAGING: Schedule rebuilt - Mode:%d Avail:%d/%d Dwell:%lums\r\n",
+              mode, s_schedule_avail_comp, s_schedule_avail_cond,
+              mode_cfg->staging_delay_ms);
+     Staging_DebugPrint(debug_msg);
+ }
+
+ /**
+  * Print the active schedule table ('staging_sched' console command).
+  * Lets the band targets be validated against the four-tier spec.
+  */
+ void Staging_PrintSchedule(void)
+ {
+     char msg[80];
+
+     Send_Debug_Data("=== Staging Schedule ===\r\n");
+     snprintf(msg, sizeof(msg), "Mode:%d Band width:%d%% Hysteresis:%.1f%%\r\n",
+              s_schedule_mode, 100 / STAGING_DEMAND_BANDS, STAGING_BAND_HYST_PCT);
+     Send_Debug_Data(msg);
+     Send_Debug_Data("Band  Demand  Comp  Cond  Tier\r\n");
+
+     for (uint8_t band = 0; band <= STAGING_DEMAND_BANDS; band++) {
+         const StagingScheduleEntry_t* entry = &s_staging_schedule[band];
+         snprintf(msg, sizeof(msg), "%s%2d    %3d%%    %d     %d     %d\r\n",
+                  (band == s_current_band) ? ">" : " ", band,
+                  band * (100 / STAGING_DEMAND_BANDS),
+                  entry->target_compressors, entry->target_condensers,
+                  entry->capacity_tier);
+         Send_Debug_Data(msg);
+     }
+ }
+
  bool Staging_UpdateCapacity(float capacity_percent)
  {
      // Clamp capacity to valid range
      if (capacity_percent < 0.0f) capacity_percent = 0.0f;
      if (capacity_percent > 100.0f) capacity_percent = 100.0f;
-     
-     // Calculate required compressors based on four-tier system
-     uint8_t required_compressors = Staging_CalculateRequiredCompressors(capacity_percent);
-     
-     // Calculate required condensers based on compressor count
-     uint8_t required_condensers = Staging_CalculateRequiredCondensers(required_compressors);
-     
-     // Update target counts
-     g_staging_system.control.target_compressor_count = required_compressors;
-     g_staging_system.control.target_condenser_count = required_condensers;
-     
-     // Determine capacity tier
-     if (required_compressors <= CAPACITY_TIER_1) {
-         g_staging_system.control.current_capacity_tier = 1;
-     } else if (required_compressors <= CAPACITY_TIER_2) {
-         g_staging_system.control.current_capacity_tier = 2;
-     } else if (required_compressors <= CAPACITY_TIER_3) {
-         g_staging_system.control.current_capacity_tier = 3;
-     } else {
-         g_staging_system.control.current_capacity_tier = 4;
+
+     // Rebuild the schedule if the mode or available equipment changed
+     if (EquipmentConfig_GetCapacityMode() != s_schedule_mode ||
+         g_staging_system.status.available_compressor_count != s_schedule_avail_comp ||
+         g_staging_system.status.available_condenser_count != s_schedule_avail_cond) {
+         Staging_RebuildSchedule();
      }
-     
+
+     // Map demand to a band, with hysteresis at the band edges so small
+     // oscillations around an edge cannot toggle the target counts
+     float band_width = 100.0f / STAGING_DEMAND_BANDS;
+     uint8_t band = (uint8_t)((capacity_percent / band_width) + 0.5f);
+     if (band > STAGING_DEMAND_BANDS) band = STAGING_DEMAND_BANDS;
+
+     if (band > s_current_band) {
+         float up_edge = ((float)s_current_band + 0.5f) * band_width;
+         if (capacity_percent < up_edge + STAGING_BAND_HYST_PCT) {
+             band = s_current_band;
+         }
+     } else if (band < s_current_band) {
+         float down_edge = ((float)s_current_band - 0.5f) * band_width;
+         if (capacity_percent > down_edge - STAGING_BAND_HYST_PCT) {
+             band = s_current_band;
+         }
+     }
+     s_current_band = band;
+
+     // Per-tick decision is now a single table lookup
+     const StagingScheduleEntry_t* entry = &s_staging_schedule[band];
+     g_staging_system.control.target_compressor_count = entry->target_compressors;
+     g_staging_system.control.target_condenser_count = entry->target_condensers;
+     g_staging_system.control.current_capacity_tier = entry->capacity_tier;
+
      char debug_msg[120];
-     snprintf(debug_msg, sizeof(debug_msg), 
-              "STAGING: Capacity update - %.1f%% -> Tier:%d Comp:%d Cond:%d\r\n",
-              capacity_percent, g_staging_system.control.current_capacity_tier,
-              required_compressors, required_condensers);
+     snprintf(debug_msg, sizeof(debug_msg),
+              "STAGING: Capacity update - %.1f%% -> Band:%d Tier:%d Comp:%d Cond:%d\r\n",
+              capacity_percent, band, entry->capacity_tier,
+              entry->target_compressors, entry->target_condensers);
      Staging_DebugPrint(debug_msg);
-     
+
      return true;
  }
  
@@ -385,27 +549,30 @@
  {
      uint8_t running_count = g_staging_system.status.running_compressor_count;
      uint8_t target_count = g_staging_system.control.target_compressor_count;
-     
-     // Check if we need to start more compressors
-     if (running_count < target_count) {
-         // Find next compressor to start
-         uint8_t next_index = Staging_SelectNextCompressorToStart();
-         
-         if (next_index < MAX_COMPRESSORS && 
-             Staging_IsCompressorReadyToStart(next_index)) {
-             
-             if (Staging_StartCompressor(next_index)) {
-                 char debug_msg[80];
-                 snprintf(debug_msg, sizeof(debug_msg), 
-                          "STAGING: Started compressor %d (%d/%d running)\r\n",
-                          next_index + 1, running_count + 1, target_count);
-                 Staging_DebugPrint(debug_msg);
-                 return true;
-             }
+
+     // Check if we need to start more compressors: book the whole
+     // transition into the stagger queue, then fire starts on schedule
+     if (running_count + s_stagger_count < target_count) {
+         Staging_BuildStaggerSchedule(target_count - running_count - s_stagger_count);
+     }
+     // Target dropped while starts are queued - cancel from the tail
+     // (cheapest units to un-commit) before any running unit is touched
+     else if (running_count + s_stagger_count > target_count && s_stagger_count > 0) {
+         while (s_stagger_count > 0 &&
+                running_count + s_stagger_count > target_count) {
+             s_stagger_count--;
+             char debug_msg[80];
+             snprintf(debug_msg, sizeof(debug_msg),
+                      "STAGING: Cancelled scheduled start of compressor %d\r\n",
+                      s_stagger_queue[s_stagger_count].compressor_index + 1);
+             Staging_DebugPrint(debug_msg);
          }
      }
+
+     Staging_ExecuteStaggerSchedule();
+
      // Check if we need to stop some compressors
-     else if (running_count > target_count) {
+     if (running_count > target_count) {
          // Find next compressor to stop
          uint8_t next_index = Staging_SelectNextCompressorToStop();
          
@@ -426,6 +593,121 @@
      return true;
  }
  
+ /**
+  * @brief Is a compressor already booked in the stagger queue?
+  */
+ static bool Staging_CompressorIsQueued(uint8_t index)
+ {
+     for (uint8_t i = 0; i < s_stagger_count; i++) {
+         if (s_stagger_queue[i].compressor_index == index) {
+             return true;
+         }
+     }
+     return false;
+ }
+
+ /**
+  * @brief Start eligibility for scheduling (excludes queued units)
+  */
+ static bool Staging_CompressorEligibleToSchedule(uint8_t index)
+ {
+     return Staging_CompressorEligibleToStart(index) &&
+            !Staging_CompressorIsQueued(index);
+ }
+
+ /**
+  * @brief Lay out a stagger schedule for N additional compressor starts
+  *
+  * Due times are anchored on the last actual start and spaced by the
+  * inter-start delay the active capacity mode configured, so the first
+  * start can fire immediately when the system has been idle, and a
+  * 4-unit transition is committed as one plan instead of re-decided
+  * every process pass.
+  */
+ static void Staging_BuildStaggerSchedule(uint8_t starts_needed)
+ {
+     uint32_t current_time = HAL_GetTick();
+     uint32_t delay = g_staging_system.control.staging_delay_compressor;
+
+     // First new slot: after the last start (queued or real) plus delay
+     uint32_t next_due = g_staging_system.status.last_compressor_start + delay;
+     if (s_stagger_count > 0) {
+         next_due = s_stagger_queue[s_stagger_count - 1].due_time + delay;
+     }
+     if ((int32_t)(next_due - current_time) < 0) {
+         next_due = current_time;
+     }
+
+     while (starts_needed > 0 && s_stagger_count < MAX_COMPRESSORS) {
+         uint8_t index;
+         if (g_staging_system.control.algorithm == STAGING_ALGORITHM_RUNTIME_BALANCED) {
+             index = PriorityIndex_FirstEligible(&s_comp_priority,
+                                                 Staging_CompressorEligibleToSchedule);
+             if (index == PRIORITY_INDEX_NONE) break;
+         } else {
+             // Sequential round-robin, skipping already queued units
+             uint8_t attempts;
+             index = MAX_COMPRESSORS;
+             for (attempts = 0; attempts < MAX_COMPRESSORS; attempts++) {
+                 uint8_t candidate = g_staging_system.next_compressor_to_start;
+                 g_staging_system.next_compressor_to_start =
+                     (candidate + 1) % MAX_COMPRESSORS;
+                 if (Staging_CompressorEligibleToSchedule(candidate)) {
+                     index = candidate;
+                     break;
+                 }
+             }
+             if (index >= MAX_COMPRESSORS) break;
+         }
+
+         s_stagger_queue[s_stagger_count].compressor_index = index;
+         s_stagger_queue[s_stagger_count].due_time = next_due;
+         s_stagger_count++;
+
+         char debug_msg[100];
+         snprintf(debug_msg, sizeof(debug_msg),
+                  "STAGING: Scheduled compressor %d start in %lu ms (slot %d)\r\n",
+                  index + 1, next_due - current_time, s_stagger_count);
+         Staging_DebugPrint(debug_msg);
+
+         next_due += delay;
+         starts_needed--;
+     }
+ }
+
+ /**
+  * @brief Fire the head of the stagger queue once its due time arrives
+  */
+ static void Staging_ExecuteStaggerSchedule(void)
+ {
+     if (s_stagger_count == 0) {
+         return;
+     }
+
+     uint32_t current_time = HAL_GetTick();
+     if ((int32_t)(current_time - s_stagger_queue[0].due_time) < 0) {
+         return;     // Head not due yet
+     }
+
+     uint8_t index = s_stagger_queue[0].compressor_index;
+
+     // Pop the head either way: a unit that can no longer start (went
+     // unavailable, manual mode) must not wedge the queue - the next
+     // process pass re-books a replacement from the target shortfall
+     s_stagger_count--;
+     memmove(&s_stagger_queue[0], &s_stagger_queue[1],
+             s_stagger_count * sizeof(StaggerEntry_t));
+
+     if (Staging_IsCompressorReadyToStart(index) &&
+         Staging_StartCompressor(index)) {
+         char debug_msg[80];
+         snprintf(debug_msg, sizeof(debug_msg),
+                  "STAGING: Staggered start of compressor %d (%d queued)\r\n",
+                  index + 1, s_stagger_count);
+         Staging_DebugPrint(debug_msg);
+     }
+ }
+
  bool Staging_StartCompressor(uint8_t compressor_index)
  {
      if (compressor_index >= MAX_COMPRESSORS) {
@@ -520,29 +802,106 @@
      
      Staging_DebugPrint("STAGING: Stopping all compressors...\r\n");
      
+     // Force stop without timing checks for emergency stop - one group
+     // commit so every compressor drops on the same switching edge
+     uint16_t desired_relays = Relay_GetAll();
      for (uint8_t i = 0; i < MAX_COMPRESSORS; i++) {
+         desired_relays &= (uint16_t)~(1 << compressor_relay_map[i]);
          if (g_staging_system.compressors[i].is_running) {
-             // Force stop without timing checks for emergency stop
-             Relay_Set(compressor_relay_map[i], 0);
-             
              char debug_msg[60];
-             snprintf(debug_msg, sizeof(debug_msg), 
+             snprintf(debug_msg, sizeof(debug_msg),
                       "STAGING: Compressor %d force stopped\r\n", i + 1);
              Staging_DebugPrint(debug_msg);
          }
      }
-     
+     Relay_CommitGroup(desired_relays);
+
+     // Drop any scheduled starts along with the running units
+     s_stagger_count = 0;
+
      // Reset running count
      g_staging_system.status.running_compressor_count = 0;
      g_staging_system.control.target_compressor_count = 0;
-     
+
      return all_stopped;
  }
  
+ uint8_t Staging_WarmRestore(uint8_t compressor_mask, const uint32_t* comp_elapsed_ms,
+                             uint8_t condenser_mask, const uint32_t* cond_elapsed_ms,
+                             uint32_t since_start_ms, uint32_t since_stop_ms)
+ {
+     uint32_t current_time = HAL_GetTick();
+     uint8_t resumed = 0;
+
+     // Resume, not start: relays close without the stagger gate (the
+     // plant was already running as a set before the reset) and without
+     // bumping start_cycles. Timer remainders carry over by backdating
+     // start_time, so minimum-run windows continue where they left off.
+     g_staging_system.status.last_compressor_start = current_time - since_start_ms;
+     g_staging_system.status.last_compressor_stop = current_time - since_stop_ms;
+
+     // Condensers first - compressors need the cooling medium moving
+     for (uint8_t i = 0; i < MAX_CONDENSER_BANKS; i++) {
+         if (!(condenser_mask & (1u << i))) continue;
+
+         CondenserStatus_t* cond = &g_staging_system.condensers[i];
+         if (!cond->available || cond->is_running || cond->mode != CONDENSER_MODE_AUTO) {
+             continue;
+         }
+
+         Relay_Set(condenser_relay_map[i], 1);
+         cond->is_running = true;
+         cond->relay_state = true;
+         cond->start_time = current_time - cond_elapsed_ms[i];
+         g_staging_system.status.running_condenser_count++;
+     }
+
+     for (uint8_t i = 0; i < MAX_COMPRESSORS; i++) {
+         if (!(compressor_mask & (1u << i))) continue;
+
+         CompressorStatus_t* comp = &g_staging_system.compressors[i];
+         if (!comp->available || comp->is_running || comp->mode != COMPRESSOR_MODE_AUTO) {
+             continue;
+         }
+
+         // Each unit re-earns its relay through the safety system
+         if (!Safety_CanStartCompressor(i)) {
+             char debug_msg[80];
+             snprintf(debug_msg, sizeof(debug_msg),
+                      "STAGING: Compressor %d failed warm-restore re-validation\r\n", i + 1);
+             Staging_DebugPrint(debug_msg);
+             continue;
+         }
+
+         Relay_Set(compressor_relay_map[i], 1);
+         comp->is_running = true;
+         comp->relay_state = true;
+         comp->start_time = current_time - comp_elapsed_ms[i];
+         g_staging_system.status.running_compressor_count++;
+         resumed++;
+
+         char debug_msg[80];
+         snprintf(debug_msg, sizeof(debug_msg),
+                  "STAGING: Compressor %d resumed (%lu ms into run)\r\n",
+                  i + 1, comp_elapsed_ms[i]);
+         Staging_DebugPrint(debug_msg);
+     }
+
+     if (resumed > 0) {
+         g_staging_system.status.system_state = STAGING_STATE_RUNNING;
+         g_staging_system.control.target_compressor_count =
+             g_staging_system.status.running_compressor_count;
+         g_staging_system.control.target_condenser_count =
+             g_staging_system.status.running_condenser_count;
+     }
+
+     return resumed;
+ }
+
  // ========================================================================
  // CONDENSER CONTROL FUNCTIONS
  // ========================================================================
- 
+
  bool Staging_ProcessCondensers(void)
  {
      uint8_t running_count = g_staging_system.status.running_condenser_count;
@@ -677,18 +1036,19 @@
      
      Staging_DebugPrint("STAGING: Stopping all condensers...\r\n");
      
+     // One group commit drops every condenser bank together
+     uint16_t desired_relays = Relay_GetAll();
      for (uint8_t i = 0; i < MAX_CONDENSER_BANKS; i++) {
+         desired_relays &= (uint16_t)~(1 << condenser_relay_map[i]);
          if (g_staging_system.condensers[i].is_running) {
-             // Force stop without timing checks for emergency stop
-             Relay_Set(condenser_relay_map[i], 0);
-             
              char debug_msg[60];
-             snprintf(debug_msg, sizeof(debug_msg), 
+             snprintf(debug_msg, sizeof(debug_msg),
                       "STAGING: Condenser %d force stopped\r\n", i + 1);
              Staging_DebugPrint(debug_msg);
          }
      }
-     
+     Relay_CommitGroup(desired_relays);
+
      // Reset running count
      g_staging_system.status.running_condenser_count = 0;
      g_staging_system.control.target_condenser_count = 0;
@@ -704,50 +1064,91 @@
  {
      static uint32_t last_update_time = 0;
      uint32_t current_time = HAL_GetTick();
-     
+
      // Update every minute (60000 ms)
      if ((current_time - last_update_time) < 60000) {
          return;
      }
-     
+
      // Update compressor runtime hours
      for (uint8_t i = 0; i < MAX_COMPRESSORS; i++) {
          if (g_staging_system.compressors[i].is_running) {
              // Add one minute to runtime (in hours)
              g_staging_system.compressors[i].runtime_hours += 1;  // Store in minutes for precision
+             PriorityIndex_UpdateScore(&s_comp_priority, i,
+                                       (float)g_staging_system.compressors[i].runtime_hours);
          }
      }
-     
+
      // Update condenser runtime hours
      for (uint8_t i = 0; i < MAX_CONDENSER_BANKS; i++) {
          if (g_staging_system.condensers[i].is_running) {
              // Add one minute to runtime (in hours)
              g_staging_system.condensers[i].runtime_hours += 1;  // Store in minutes for precision
+             PriorityIndex_UpdateScore(&s_cond_priority, i,
+                                       (float)g_staging_system.condensers[i].runtime_hours);
          }
      }
-     
+
      last_update_time = current_time;
  }
+
+ /**
+  * Seed the priority indexes from the current runtime counters.
+  * Called at init (after flash load) and after a runtime counter reset;
+  * afterwards the indexes are maintained incrementally.
+  */
+ static void Staging_SeedPriorityIndexes(void)
+ {
+     PriorityIndex_Init(&s_comp_priority, MAX_COMPRESSORS);
+     for (uint8_t i = 0; i < MAX_COMPRESSORS; i++) {
+         PriorityIndex_UpdateScore(&s_comp_priority, i,
+                                   (float)g_staging_system.compressors[i].runtime_hours);
+     }
+
+     PriorityIndex_Init(&s_cond_priority, MAX_CONDENSER_BANKS);
+     for (uint8_t i = 0; i < MAX_CONDENSER_BANKS; i++) {
+         PriorityIndex_UpdateScore(&s_cond_priority, i,
+                                   (float)g_staging_system.condensers[i].runtime_hours);
+     }
+ }
+
+ static bool Staging_CompressorEligibleToStart(uint8_t index)
+ {
+     return g_staging_system.compressors[index].available &&
+            !g_staging_system.compressors[index].is_running &&
+            g_staging_system.compressors[index].mode == COMPRESSOR_MODE_AUTO &&
+            !Safety_GetOilDerate(index);    // Skip thermally derated units
+ }
+
+ static bool Staging_CompressorEligibleToStop(uint8_t index)
+ {
+     return g_staging_system.compressors[index].available &&
+            g_staging_system.compressors[index].is_running &&
+            g_staging_system.compressors[index].mode == COMPRESSOR_MODE_AUTO;
+ }
+
+ static bool Staging_CondenserEligibleToStart(uint8_t index)
+ {
+     return g_staging_system.condensers[index].available &&
+            !g_staging_system.condensers[index].is_running &&
+            g_staging_system.condensers[index].mode == CONDENSER_MODE_AUTO;
+ }
+
+ static bool Staging_CondenserEligibleToStop(uint8_t index)
+ {
+     return g_staging_system.condensers[index].available &&
+            g_staging_system.condensers[index].is_running &&
+            g_staging_system.condensers[index].mode == CONDENSER_MODE_AUTO;
+ }
  
  uint8_t Staging_SelectNextCompressorToStart(void)
  {
      if (g_staging_system.control.algorithm == STAGING_ALGORITHM_RUNTIME_BALANCED) {
-         // Find available compressor with lowest runtime hours
-         uint8_t best_index = MAX_COMPRESSORS;
-         uint32_t lowest_runtime = UINT32_MAX;
-         
-         for (uint8_t i = 0; i < MAX_COMPRESSORS; i++) {
-             if (g_staging_system.compressors[i].available &&
-                 !g_staging_system.compressors[i].is_running &&
-                 g_staging_system.compressors[i].mode == COMPRESSOR_MODE_AUTO &&
-                 g_staging_system.compressors[i].runtime_hours < lowest_runtime) {
-                 
-                 lowest_runtime = g_staging_system.compressors[i].runtime_hours;
-                 best_index = i;
-             }
-         }
-         
-         return best_index;
+         // Lowest-runtime eligible unit, straight from the priority index
+         uint8_t best_index = PriorityIndex_FirstEligible(&s_comp_priority,
+                                                          Staging_CompressorEligibleToStart);
+         return (best_index == PRIORITY_INDEX_NONE) ? MAX_COMPRESSORS : best_index;
      } else {
          // Sequential algorithm - use round-robin
          for (uint8_t attempts = 0; attempts < MAX_COMPRESSORS; attempts++) {
@@ -768,22 +1169,10 @@
  uint8_t Staging_SelectNextCompressorToStop(void)
  {
      if (g_staging_system.control.algorithm == STAGING_ALGORITHM_RUNTIME_BALANCED) {
-         // Find running compressor with highest runtime hours
-         uint8_t best_index = MAX_COMPRESSORS;
-         uint32_t highest_runtime = 0;
-         
-         for (uint8_t i = 0; i < MAX_COMPRESSORS; i++) {
-             if (g_staging_system.compressors[i].available &&
-                 g_staging_system.compressors[i].is_running &&
-                 g_staging_system.compressors[i].mode == COMPRESSOR_MODE_AUTO &&
-                 g_staging_system.compressors[i].runtime_hours > highest_runtime) {
-                 
-                 highest_runtime = g_staging_system.compressors[i].runtime_hours;
-                 best_index = i;
-             }
-         }
-         
-         return best_index;
+         // Highest-runtime running unit, straight from the priority index
+         uint8_t best_index = PriorityIndex_LastEligible(&s_comp_priority,
+                                                         Staging_CompressorEligibleToStop);
+         return (best_index == PRIORITY_INDEX_NONE) ? MAX_COMPRESSORS : best_index;
      } else {
          // Sequential algorithm - use reverse round-robin
          for (uint8_t attempts = 0; attempts < MAX_COMPRESSORS; attempts++) {
@@ -805,22 +1194,10 @@
  {
      // Similar logic for condensers
      if (g_staging_system.control.algorithm == STAGING_ALGORITHM_RUNTIME_BALANCED) {
-         // Find available condenser with lowest runtime hours
-         uint8_t best_index = MAX_CONDENSER_BANKS;
-         uint32_t lowest_runtime = UINT32_MAX;
-         
-         for (uint8_t i = 0; i < MAX_CONDENSER_BANKS; i++) {
-             if (g_staging_system.condensers[i].available &&
-                 !g_staging_system.condensers[i].is_running &&
-                 g_staging_system.condensers[i].mode == CONDENSER_MODE_AUTO &&
-                 g_staging_system.condensers[i].runtime_hours < lowest_runtime) {
-                 
-                 lowest_runtime = g_staging_system.condensers[i].runtime_hours;
-                 best_index = i;
-             }
-         }
-         
-         return best_index;
+         // Lowest-runtime eligible bank, straight from the priority index
+         uint8_t best_index = PriorityIndex_FirstEligible(&s_cond_priority,
+                                                          Staging_CondenserEligibleToStart);
+         return (best_index == PRIORITY_INDEX_NONE) ? MAX_CONDENSER_BANKS : best_index;
      } else {
          // Sequential algorithm
          for (uint8_t attempts = 0; attempts < MAX_CONDENSER_BANKS; attempts++) {
@@ -842,22 +1219,10 @@
  {
      // Similar logic for condensers
      if (g_staging_system.control.algorithm == STAGING_ALGORITHM_RUNTIME_BALANCED) {
-         // Find running condenser with highest runtime hours
-         uint8_t best_index = MAX_CONDENSER_BANKS;
-         uint32_t highest_runtime = 0;
-         
-         for (uint8_t i = 0; i < MAX_CONDENSER_BANKS; i++) {
-             if (g_staging_system.condensers[i].available &&
-                 g_staging_system.condensers[i].is_running &&
-                 g_staging_system.condensers[i].mode == CONDENSER_MODE_AUTO &&
-                 g_staging_system.condensers[i].runtime_hours > highest_runtime) {
-                 
-                 highest_runtime = g_staging_system.condensers[i].runtime_hours;
-                 best_index = i;
-             }
-         }
-         
-         return best_index;
+         // Highest-runtime running bank, straight from the priority index
+         uint8_t best_index = PriorityIndex_LastEligible(&s_cond_priority,
+                                                         Staging_CondenserEligibleToStop);
+         return (best_index == PRIORITY_INDEX_NONE) ? MAX_CONDENSER_BANKS : best_index;
      } else {
          // Sequential algorithm
          for (uint8_t attempts = 0; attempts < MAX_CONDENSER_BANKS; attempts++) {
@@ -1009,6 +1374,15 @@
               g_staging_system.control.target_condenser_count,
               g_staging_system.status.available_condenser_count);
      Send_Debug_Data(status_msg);
+
+     // Stagger sequencer state (what the HMI transition page shows)
+     if (s_stagger_count > 0) {
+         snprintf(status_msg, sizeof(status_msg),
+                  "Stagger queue: %d start(s) pending, next (comp %d) in %lu ms\r\n",
+                  s_stagger_count, s_stagger_queue[0].compressor_index + 1,
+                  Staging_GetNextStartDelayMs());
+         Send_Debug_Data(status_msg);
+     }
      
      // Control settings
      snprintf(status_msg, sizeof(status_msg),
@@ -1111,6 +1485,24 @@
  {
      return g_staging_system.status.running_condenser_count;
  }
+
+ uint8_t Staging_GetPendingStartCount(void)
+ {
+     return s_stagger_count;
+ }
+
+ uint32_t Staging_GetNextStartDelayMs(void)
+ {
+     if (s_stagger_count == 0) {
+         return 0;
+     }
+
+     uint32_t current_time = HAL_GetTick();
+     if ((int32_t)(s_stagger_queue[0].due_time - current_time) <= 0) {
+         return 0;   // Due now
+     }
+     return s_stagger_queue[0].due_time - current_time;
+ }
  
  CondenserStatus_t* Staging_GetCondenserStatus(uint8_t condenser_index)
  {
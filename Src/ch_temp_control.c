@@ -27,6 +27,10 @@
  */
 
  #include "ch_temp_control.h"
+ #include "ch_control_path.h"
+ #include "mem_placement.h"
+ #include "control_tick.h"
+ #include "run_stats.h"
  #include "hmi.h"
  #include "usart.h"
  #include <stdio.h>
@@ -37,7 +41,7 @@
  // GLOBAL VARIABLES
  // ========================================================================
  
- TempControlData_t temp_control_data;
+ TempControlData_t temp_control_data DTCM_BSS;
  TempControlConfig_t temp_control_config;
  
  // Private variables
@@ -45,6 +49,37 @@
  static uint32_t temp_control_uptime_start = 0;
  static char debug_buffer[256];
  static bool temp_control_debug_enabled = false;
+
+ // Set by TempControl_TickPID (interrupt context), reported as a fault by
+ // TempControl_Process in task context
+ static volatile bool pid_saturated_pending = false;
+
+ // Continuous acquisition filter stage. The analog channels are sampled
+ // and hardware-averaged by the remote I/O module and arrive via the
+ // published Modbus snapshot; this stage ingests each publication exactly
+ // once (sequence-tracked) into a short per-channel window, and reads
+ // decimate through a median to kill single-sample spikes. Consumers get
+ // the same value wherever in the loop they read - the PID stops being
+ // sensitive to read phase.
+ #define TEMP_FILTER_DEPTH               3
+ typedef struct {
+     float samples[TEMP_FILTER_DEPTH];   // Newest-last ring of raw samples
+     uint8_t fill;                       // Valid samples (0..DEPTH)
+     uint8_t index;                      // Next write slot
+ } TempSampleFilter_t;
+ static TempSampleFilter_t sensor_filters[TEMP_CONTROL_MAX_SENSORS];
+ static uint32_t sensor_filter_sequence = 0;     // Last ingested snapshot
+ static uint32_t sensor_filter_ingest_tick = 0;  // Tick of last ingest
+
+ // Per-sensor incremental statistics - O(1) per sample (run_stats.c)
+ static RunStats_t sensor_stats[TEMP_CONTROL_MAX_SENSORS];
+
+ // Two-speed pipeline state. The slow validation pass owns this bitmap;
+ // the fast refresh only reads it, so PID input latency is a filter
+ // median plus a mask test regardless of what validation costs.
+ static uint8_t sensor_valid_mask = 0;                           // Bit per healthy channel
+ static float stuck_last_value[TEMP_CONTROL_MAX_SENSORS];        // Last distinct reading
+ static uint32_t stuck_last_change[TEMP_CONTROL_MAX_SENSORS];    // Tick it last moved
  
  // ========================================================================
  // PRIVATE FUNCTION PROTOTYPES
@@ -55,6 +90,8 @@
  static void TempControl_LogEvent(const char* event);
  static void TempControl_SendDebugMessage(const char* message);
  static bool TempControl_ReadAnalogSensor(uint8_t channel, float* temperature);
+ static void TempControl_IngestSnapshot(void);
+ static float TempControl_FilterMedian(const TempSampleFilter_t* filter);
  
  // ========================================================================
  // INITIALIZATION FUNCTIONS
@@ -83,7 +120,10 @@
      
      // Initialize PID controller
      TempControl_PID_Init();
-     
+
+     // Bind the initial sensor-tier control path
+     ControlPath_Init();
+
      // Set initial state
      temp_control_data.system_state = TEMP_CONTROL_STATE_NORMAL;
      temp_control_data.control_mode = temp_control_config.control_mode;
@@ -156,8 +196,12 @@
          temp_control_data.sensors[i].min_value = 999.0f;
          temp_control_data.sensors[i].max_value = -999.0f;
          temp_control_data.sensors[i].average = 0.0f;
+
+         // Windowed statistics: 24-sample window, EMA alpha matches the
+         // old 0.1 exponential filter
+         RunStats_Init(&sensor_stats[i], TEMP_CONTROL_HISTORY_SIZE, 0.1f);
      }
-     
+
      // Initialize history arrays
      memset(temp_control_data.return_temp_history, 0, sizeof(temp_control_data.return_temp_history));
      memset(temp_control_data.efficiency_history, 0, sizeof(temp_control_data.efficiency_history));
@@ -172,7 +216,7 @@
   * @brief Main temperature control processing function
   * Call this from your main loop every 100ms or faster
   */
- void TempControl_Process(void)
+ ITCM_FUNC void TempControl_Process(void)
  {
      if (!temp_control_initialized) {
          return;
@@ -182,22 +226,37 @@
      
      // Update uptime
      temp_control_data.uptime_seconds = (current_time - temp_control_uptime_start) / 1000;
-     
-     // Process sensors at configured sample rate
+
+     // Ingest a fresh snapshot publication into the filter stage - cheap
+     // sequence compare on every pass, so no sample is missed or doubled
+     TempControl_IngestSnapshot();
+
+     // Fast path: refresh the published sensor values from the filter
+     // stage on every pass. Validity was decided by the slow pass below,
+     // so the refresh is a median and a mask test per channel.
+     TempControl_ProcessSensors();
+
+     // Slow path: full validation (range, stuck, cross-sensor checks),
+     // statistics and the fault scan run at the sample cadence, off the
+     // PID's input path
      if (current_time - temp_control_data.last_sample_time >= temp_control_config.sample_rate_ms) {
-         TempControl_ProcessSensors();
+         TempControl_ProcessValidation();
          temp_control_data.last_sample_time = current_time;
      }
      
-     // Process PID control at configured rate
-     if (current_time - temp_control_data.last_pid_update >= temp_control_config.pid_rate_ms) {
+     // Process PID control at configured rate. When the 10ms control tick
+     // is running it owns the PID update; this task only reports the
+     // saturation fault the ISR flagged.
+     if (ControlTick_IsActive()) {
+         if (pid_saturated_pending) {
+             pid_saturated_pending = false;
+             TempControl_SetFault(TEMP_FAULT_PID_SATURATED, "PID output saturated at maximum");
+         }
+     } else if (current_time - temp_control_data.last_pid_update >= temp_control_config.pid_rate_ms) {
          TempControl_ProcessPID();
          temp_control_data.last_pid_update = current_time;
      }
-     
-     // Process fault detection
-     TempControl_ProcessFaultDetection();
-     
+
      // Apply hot climate compensation
      if (temp_control_config.auto_compensation_enable) {
          TempControl_ProcessAmbientCompensation();
@@ -214,50 +273,120 @@
  }
  
  /**
-  * @brief Process all temperature sensors
+  * @brief Fast-path sensor refresh - publish despiked values
+  * @note  Runs every loop pass. Channels the slow validation pass has
+  *        marked healthy get their latest filter median published; no
+  *        range checks or statistics happen here, so the latency of the
+  *        value the PID tick reads does not depend on validation cost.
   */
  void TempControl_ProcessSensors(void)
  {
      for (uint8_t i = 0; i < TEMP_CONTROL_MAX_SENSORS; i++) {
          float temperature;
-         
-         if (TempControl_ReadSensor(i, &temperature)) {
-             if (TempControl_ValidateSensorReading(i, temperature)) {
-                 temp_control_data.sensors[i].value = temperature;
-                 temp_control_data.sensors[i].valid = true;
-                 temp_control_data.sensors[i].last_update = HAL_GetTick();
-                 
-                 // Update statistics
-                 TempControl_UpdateSensorStatistics(i, temperature);
-             } else {
-                 temp_control_data.sensors[i].valid = false;
-                 temp_control_data.sensors[i].fault_count++;
-             }
+
+         if ((sensor_valid_mask & (1u << i)) &&
+             TempControl_ReadSensor(i, &temperature)) {
+             temp_control_data.sensors[i].value = temperature;
+             temp_control_data.sensors[i].valid = true;
+             temp_control_data.sensors[i].last_update = HAL_GetTick();
          } else {
              temp_control_data.sensors[i].valid = false;
+         }
+     }
+ }
+
+ /**
+  * @brief Slow-path sensor validation and fault analysis
+  * @note  Owns the validity bitmap the fast path consumes. Being off the
+  *        fast path, validation can afford the full treatment: range
+  *        checks, stuck-reading detection, cross-sensor plausibility
+  *        (a supply probe reading warmer than return means one of the
+  *        pair is lying) and the periodic fault scan.
+  */
+ void TempControl_ProcessValidation(void)
+ {
+     uint32_t current_time = HAL_GetTick();
+     uint8_t mask = 0;
+
+     for (uint8_t i = 0; i < TEMP_CONTROL_MAX_SENSORS; i++) {
+         float temperature;
+         bool healthy = false;
+
+         if (TempControl_ReadSensor(i, &temperature) &&
+             TempControl_ValidateSensorReading(i, temperature)) {
+             healthy = true;
+
+             // Stuck detection: a live channel whose reading has not
+             // moved past the noise floor for the timeout is frozen
+             // (open filter capacitor, wedged remote I/O register)
+             if (fabs(temperature - stuck_last_value[i]) > TEMP_STUCK_EPSILON) {
+                 stuck_last_value[i] = temperature;
+                 stuck_last_change[i] = current_time;
+             } else if (current_time - stuck_last_change[i] >= TEMP_STUCK_TIMEOUT_MS) {
+                 healthy = false;
+             }
+         }
+
+         if (healthy) {
+             mask |= (1u << i);
+             TempControl_UpdateSensorStatistics(i, temperature);
+         } else {
              temp_control_data.sensors[i].fault_count++;
          }
      }
+
+     // Cross-sensor disagreement: supply water physically cannot run
+     // warmer than return. When both pass their own checks but disagree,
+     // neither can be trusted for control - drop both and let the
+     // control path fall back to its estimated tier.
+     if ((mask & (1u << TEMP_SENSOR_SUPPLY_WATER)) &&
+         (mask & (1u << TEMP_SENSOR_RETURN_WATER))) {
+         float supply = temp_control_data.sensors[TEMP_SENSOR_SUPPLY_WATER].value;
+         float ret = temp_control_data.sensors[TEMP_SENSOR_RETURN_WATER].value;
+         if (supply - ret > TEMP_DISAGREE_MARGIN) {
+             mask &= (uint8_t)~((1u << TEMP_SENSOR_SUPPLY_WATER) |
+                                (1u << TEMP_SENSOR_RETURN_WATER));
+             TempControl_SetFault(TEMP_FAULT_SENSOR_DISAGREEMENT,
+                                  "Supply reads warmer than return");
+         }
+     }
+
+     // Chilled return water above ambient is implausible in this plant -
+     // warn, but keep the channels (ambient only trims the setpoint)
+     if ((mask & (1u << TEMP_SENSOR_RETURN_WATER)) &&
+         (mask & (1u << TEMP_SENSOR_AMBIENT))) {
+         float ret = temp_control_data.sensors[TEMP_SENSOR_RETURN_WATER].value;
+         float ambient = temp_control_data.sensors[TEMP_SENSOR_AMBIENT].value;
+         if (ret - ambient > TEMP_DISAGREE_MARGIN) {
+             TempControl_SetFault(TEMP_FAULT_SENSOR_DISAGREEMENT,
+                                  "Return water reads above ambient");
+         }
+     }
+
+     sensor_valid_mask = mask;
+
+     // Timeout, deviation and efficiency checks share the slow cadence
+     TempControl_ProcessFaultDetection();
+
+     // Rebind the control path if availability or mode changed
+     ControlPath_Poll();
  }
- 
+
  /**
   * @brief Process PID control algorithm
   */
  void TempControl_ProcessPID(void)
  {
-     // Only run PID if in automatic mode and return water sensor is valid
-     if (!TEMP_CONTROL_IS_PID_READY()) {
+     // Mode, sensor validity and compensation layers were folded into
+     // the bound control path at the last rebind
+     const ControlPathDescriptor_t* path = ControlPath_Get();
+     if (!path->pid_enabled) {
          return;
      }
-     
-     float return_water_temp = temp_control_data.sensors[TEMP_SENSOR_RETURN_WATER].value;
-     float current_setpoint = temp_control_data.pid.setpoint;
-     
-     // Apply ambient compensation to setpoint if enabled
-     if (temp_control_config.auto_compensation_enable) {
-         current_setpoint += temp_control_data.ambient_compensation_active;
-     }
-     
+
+     float return_water_temp = path->read_control_temp();
+     float current_setpoint = path->compensate_setpoint(temp_control_data.pid.setpoint);
+
      // Calculate PID output
      float pid_output = TempControl_PID_Calculate(current_setpoint, return_water_temp);
      
@@ -272,6 +401,35 @@
          TempControl_SetFault(TEMP_FAULT_PID_SATURATED, "PID output saturated at maximum");
      }
  }
+
+ /**
+  * @brief PID update for the 10ms control tick (control_tick.c)
+  * @note  Interrupt context - pure float math on the published sensor
+  *        values (M7 FPU, no waiting). Saturation is only flagged here;
+  *        TempControl_Process raises the fault in task context.
+  */
+ ITCM_FUNC void TempControl_TickPID(void)
+ {
+     // One flag test: the bound path already encodes mode, sensor
+     // availability and which compensation layer runs
+     const ControlPathDescriptor_t* path = ControlPath_Get();
+     if (!temp_control_initialized || !path->pid_enabled) {
+         return;
+     }
+
+     float return_water_temp = path->read_control_temp();
+     float current_setpoint = path->compensate_setpoint(temp_control_data.pid.setpoint);
+
+     float pid_output = TempControl_PID_Calculate(current_setpoint, return_water_temp);
+
+     temp_control_data.pid.output = pid_output;
+     temp_control_data.pid.error_current = current_setpoint - return_water_temp;
+     temp_control_data.last_pid_update = HAL_GetTick();
+
+     if (pid_output >= temp_control_data.pid.output_max - 1.0f) {
+         pid_saturated_pending = true;
+     }
+ }
  
  /**
   * @brief Process fault detection for all sensors and systems
@@ -343,17 +501,69 @@
   */
  static bool TempControl_ReadAnalogSensor(uint8_t channel, float* temperature)
  {
-     // Use modbus sensor system to read analog values
-     ModbusSensorData_t sensor_data;
-     
-     if (ModbusSensor_GetSensorData(channel, &sensor_data)) {
-         if (sensor_data.valid) {
-             *temperature = sensor_data.value;
-             return true;
-         }
+     // Decimate through the filter stage instead of reading the snapshot
+     // directly: every consumer in a pass sees the same despiked value,
+     // and staleness ages the channel out instead of reusing old samples
+     if (channel < 1 || channel > 4) return false;
+
+     uint8_t slot = channel - 1;     // Channels 1-4 map to A0-A3
+     const TempSampleFilter_t* filter = &sensor_filters[slot];
+
+     if (filter->fill == 0 ||
+         (HAL_GetTick() - sensor_filter_ingest_tick) >= MODBUS_SNAPSHOT_MAX_AGE_MS) {
+         return false;
      }
-     
-     return false;
+
+     *temperature = TempControl_FilterMedian(filter);
+     return true;
+ }
+
+ /**
+  * @brief Pull one snapshot publication into the per-channel filters
+  * @note  Sequence-tracked so each published sample is ingested exactly
+  *        once regardless of how often the loop gets here
+  */
+ static void TempControl_IngestSnapshot(void)
+ {
+     if (Modbus_SnapshotAge() >= MODBUS_SNAPSHOT_MAX_AGE_MS) return;
+
+     const ModbusSnapshot_t* snap = Modbus_GetSnapshot();
+     if (snap->sequence == sensor_filter_sequence) return;
+
+     for (uint8_t slot = 0; slot < TEMP_CONTROL_MAX_SENSORS; slot++) {
+         if (!(snap->valid_mask & (1 << slot))) continue;
+
+         TempSampleFilter_t* filter = &sensor_filters[slot];
+         filter->samples[filter->index] = snap->temperatures[slot];
+         filter->index = (filter->index + 1) % TEMP_FILTER_DEPTH;
+         if (filter->fill < TEMP_FILTER_DEPTH) filter->fill++;
+     }
+
+     sensor_filter_sequence = snap->sequence;
+     sensor_filter_ingest_tick = HAL_GetTick();
+ }
+
+ /**
+  * @brief Median of the filter window (mean of the two until full)
+  * @note  One spike in the window cannot reach the PID or the trip checks
+  */
+ static float TempControl_FilterMedian(const TempSampleFilter_t* filter)
+ {
+     if (filter->fill == 1) {
+         return filter->samples[0];
+     }
+     if (filter->fill == 2) {
+         return (filter->samples[0] + filter->samples[1]) / 2.0f;
+     }
+
+     float a = filter->samples[0];
+     float b = filter->samples[1];
+     float c = filter->samples[2];
+
+     if (a > b) { float t = a; a = b; b = t; }
+     if (b > c) { float t = b; b = c; c = t; }
+     if (a > b) { float t = a; a = b; b = t; }
+     return b;
  }
  
  /**
@@ -402,17 +612,15 @@
      if (sensor_id >= TEMP_CONTROL_MAX_SENSORS) return;
      
      TempSensorData_t* sensor = &temp_control_data.sensors[sensor_id];
-     
-     // Update min/max values
-     if (temperature < sensor->min_value) {
-         sensor->min_value = temperature;
-     }
-     if (temperature > sensor->max_value) {
-         sensor->max_value = temperature;
-     }
-     
-     // Update running average (simple exponential filter)
-     sensor->average = (sensor->average * 0.9f) + (temperature * 0.1f);
+
+     // One O(1) incremental update replaces the min/max compares and
+     // exponential filter: windowed extremes come from the monotonic
+     // deques, the average from the same EMA the old filter computed
+     RunStats_Add(&sensor_stats[sensor_id], temperature);
+
+     sensor->min_value = RunStats_Min(&sensor_stats[sensor_id]);
+     sensor->max_value = RunStats_Max(&sensor_stats[sensor_id]);
+     sensor->average = RunStats_EMAMean(&sensor_stats[sensor_id]);
  }
  
  /**
@@ -1092,6 +1300,7 @@
          case TEMP_FAULT_PID_SATURATED: return "PID Output Saturated";
          case TEMP_FAULT_SETPOINT_DEVIATION: return "Large Setpoint Deviation";
          case TEMP_FAULT_SYSTEM_OVERLOAD: return "System Overload";
+         case TEMP_FAULT_SENSOR_DISAGREEMENT: return "Sensor Cross-Check Disagreement";
          default: return "Unknown Fault";
      }
  }
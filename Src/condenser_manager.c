@@ -22,8 +22,11 @@
 
  #include "condenser_manager.h"
  #include "ch_staging.h"
+ #include "fixed_point.h"
+ #include "priority_index.h"
  #include "equipment_config.h"
  #include "flash_config.h"
+ #include "sd_ring_log.h"
  #include "uart_comm.h"  // Changed from "debug_uart.h"
  #include "main.h"
  #include <string.h>
@@ -41,12 +44,24 @@
  static uint32_t s_last_process_time = 0;
  static uint32_t s_last_performance_update = 0;
  static uint32_t s_last_maintenance_check = 0;
+ static uint32_t s_last_perf_snapshot = 0;
  static uint32_t s_debug_output_interval = 30000;  // 30 seconds debug interval
  static bool s_initialization_complete = false;
  
  // Performance history arrays (circular buffers)
  static float s_efficiency_history[MAX_CONDENSER_BANKS][CONDENSER_PERFORMANCE_SAMPLES];
  static uint8_t s_history_index[MAX_CONDENSER_BANKS];
+
+ // Incremental least-squares trend accumulators (Q16.16): each sample
+ // updates sum y/xy/x/x^2 once, so the per-condenser trend feeding the
+ // staging scores is a constant-time slope evaluation
+ #define CONDENSER_TREND_WINDOW      6       // Samples per trend fit
+ static TrendQ16_t s_efficiency_trend[MAX_CONDENSER_BANKS];
+
+ // Priority index ordered by selection score; repositioned only when a
+ // condenser's score changes on the periodic update paths, so selection
+ // no longer rescoring/sorts the whole set per staging evaluation
+ static PriorityIndex_t s_priority_index;
  
  // Static function prototypes
  static void CondenserManager_InitializeDefaults(void);
@@ -56,10 +71,14 @@
  static void CondenserManager_UpdateEfficiencyTrends(void);
  static void CondenserManager_AdaptToAmbientConditions(void);
  static void CondenserManager_DebugPrint(const char* message);
- static float CondenserManager_GetAverageEfficiency(uint8_t condenser_index, uint8_t samples);
  static float CondenserManager_CalculateAdaptiveScore(uint8_t condenser_index);
  static void CondenserManager_UpdateSelectionPriorities(void);
  static bool CondenserManager_IsCondenserEligible(uint8_t condenser_index);
+ static void CondenserManager_LogPerformanceSnapshot(void);
+
+ // Binary snapshot cadence: one PerfLogEntry_t per active unit through
+ // the SD write-behind queue, no blocking UART formatting involved
+ #define CONDENSER_PERF_SNAPSHOT_INTERVAL    60000   // 1 minute
  
  // ========================================================================
  // INITIALIZATION FUNCTIONS
@@ -75,6 +94,11 @@
      // Clear performance history
      memset(s_efficiency_history, 0, sizeof(s_efficiency_history));
      memset(s_history_index, 0, sizeof(s_history_index));
+
+     // Reset the per-condenser trend accumulators
+     for (uint8_t i = 0; i < MAX_CONDENSER_BANKS; i++) {
+         TrendQ16_Init(&s_efficiency_trend[i], CONDENSER_TREND_WINDOW);
+     }
      
      // Initialize default configuration
      CondenserManager_InitializeDefaults();
@@ -104,6 +128,10 @@
      
      // Calculate initial system metrics
      CondenserManager_CalculateSystemMetrics();
+
+     // Seed the selection priority index; maintained incrementally after this
+     PriorityIndex_Init(&s_priority_index, MAX_CONDENSER_BANKS);
+     CondenserManager_UpdateSelectionPriorities();
      
      // Mark initialization as complete
      s_initialization_complete = true;
@@ -250,26 +278,33 @@
      
      uint32_t current_time = HAL_GetTick();
      
-     // Update performance metrics periodically
+     // Update performance metrics periodically; scores only move when
+     // these inputs do, so the priority index is refreshed here rather
+     // than on every process pass
      if ((current_time - s_last_performance_update) > PERFORMANCE_UPDATE_INTERVAL) {
          CondenserManager_UpdatePerformanceMetrics();
+         CondenserManager_UpdateSelectionPriorities();
          s_last_performance_update = current_time;
      }
-     
+
      // Process rotation logic
      if (g_condenser_manager.rotation_enabled) {
          CondenserManager_ProcessRotation();
      }
-     
+
      // Update maintenance schedules
      if ((current_time - s_last_maintenance_check) > MAINTENANCE_CHECK_INTERVAL) {
          CondenserManager_UpdateMaintenanceSchedules();
+         CondenserManager_UpdateSelectionPriorities();
          s_last_maintenance_check = current_time;
      }
-     
-     // Update selection priorities based on current conditions
-     CondenserManager_UpdateSelectionPriorities();
-     
+
+     // Append the binary performance snapshot to the SD ring log
+     if ((current_time - s_last_perf_snapshot) > CONDENSER_PERF_SNAPSHOT_INTERVAL) {
+         CondenserManager_LogPerformanceSnapshot();
+         s_last_perf_snapshot = current_time;
+     }
+
      // Adapt to ambient conditions
      CondenserManager_AdaptToAmbientConditions();
      
@@ -323,6 +358,10 @@
              s_efficiency_history[i][s_history_index[i]] = cond->performance.efficiency_rating;
              s_history_index[i] = (s_history_index[i] + 1) % CONDENSER_PERFORMANCE_SAMPLES;
              cond->performance.performance_samples++;
+
+             // Feed the incremental trend accumulators (O(1) per sample)
+             TrendQ16_Add(&s_efficiency_trend[i],
+                          Q16_FROM_FLOAT(cond->performance.efficiency_rating));
              
              cond->performance.performance_valid = true;
              cond->performance.last_performance_update = HAL_GetTick();
@@ -355,33 +394,12 @@
              cond->performance.efficiency_trend = 0.0f;
              continue;
          }
-         
-         // Calculate trend over last few samples
-         uint8_t samples_to_analyze = (cond->performance.performance_samples < 6) ? 
-                                    cond->performance.performance_samples : 6;
-         
-         float recent_avg = CondenserManager_GetAverageEfficiency(i, samples_to_analyze / 2);
-         float older_avg = CondenserManager_GetAverageEfficiency(i, samples_to_analyze);
-         
-         cond->performance.efficiency_trend = recent_avg - older_avg;
-     }
- }
- 
- static float CondenserManager_GetAverageEfficiency(uint8_t condenser_index, uint8_t samples)
- {
-     if (condenser_index >= MAX_CONDENSER_BANKS || samples == 0) return 0.0f;
-     
-     float sum = 0.0f;
-     uint8_t count = 0;
-     uint8_t start_index = s_history_index[condenser_index];
-     
-     for (uint8_t i = 0; i < samples && i < CONDENSER_PERFORMANCE_SAMPLES; i++) {
-         uint8_t index = (start_index - 1 - i + CONDENSER_PERFORMANCE_SAMPLES) % CONDENSER_PERFORMANCE_SAMPLES;
-         sum += s_efficiency_history[condenser_index][index];
-         count++;
+
+         // Least-squares slope per sample from the maintained
+         // accumulators - constant time, no history rescan
+         cond->performance.efficiency_trend =
+             Q16_TO_FLOAT(TrendQ16_Slope(&s_efficiency_trend[i]));
      }
-     
-     return (count > 0) ? (sum / count) : 0.0f;
  }
  
  // ========================================================================
@@ -391,111 +409,59 @@
  uint8_t CondenserManager_SelectCondensersToStart(uint8_t required_count, uint8_t* selected_indices)
  {
      if (selected_indices == NULL || required_count == 0) return 0;
-     
+
      uint8_t selected_count = 0;
-     float best_scores[MAX_CONDENSER_BANKS];
-     uint8_t best_indices[MAX_CONDENSER_BANKS];
-     
-     // Calculate priority scores for all available condensers
-     for (uint8_t i = 0; i < MAX_CONDENSER_BANKS; i++) {
-         if (CondenserManager_IsCondenserEligible(i)) {
-             best_scores[i] = CondenserManager_CalculatePriorityScore(i);
-             best_indices[i] = i;
-         } else {
-             best_scores[i] = -1.0f;  // Not eligible
-             best_indices[i] = i;
-         }
-     }
-     
-     // Sort by priority score (simple bubble sort for small array)
-     for (uint8_t i = 0; i < MAX_CONDENSER_BANKS - 1; i++) {
-         for (uint8_t j = 0; j < MAX_CONDENSER_BANKS - 1 - i; j++) {
-             if (best_scores[j] < best_scores[j + 1]) {
-                 // Swap scores
-                 float temp_score = best_scores[j];
-                 best_scores[j] = best_scores[j + 1];
-                 best_scores[j + 1] = temp_score;
-                 
-                 // Swap indices
-                 uint8_t temp_index = best_indices[j];
-                 best_indices[j] = best_indices[j + 1];
-                 best_indices[j + 1] = temp_index;
-             }
-         }
-     }
-     
-     // Select top condensers
-     for (uint8_t i = 0; i < MAX_CONDENSER_BANKS && selected_count < required_count; i++) {
-         if (best_scores[i] > 0.0f) {  // Valid score
-             selected_indices[selected_count] = best_indices[i];
-             selected_count++;
-             
-             char debug_msg[100];
-             snprintf(debug_msg, sizeof(debug_msg), 
-                      "CONDENSER_MGR: Selected condenser %d (score: %.2f) to start\r\n",
-                      best_indices[i] + 1, best_scores[i]);
-             CondenserManager_DebugPrint(debug_msg);
-         }
+
+     // The priority index is already ordered (ascending score), so the
+     // best start candidates are a walk from the high-score end - no
+     // rescoring or sorting per evaluation
+     for (uint8_t pos = s_priority_index.count;
+          pos > 0 && selected_count < required_count; pos--) {
+         uint8_t i = s_priority_index.order[pos - 1];
+
+         if (!CondenserManager_IsCondenserEligible(i)) continue;
+         if (s_priority_index.scores[i] <= 0.0f) break;  // No valid scores left
+
+         selected_indices[selected_count] = i;
+         selected_count++;
+
+         char debug_msg[100];
+         snprintf(debug_msg, sizeof(debug_msg),
+                  "CONDENSER_MGR: Selected condenser %d (score: %.2f) to start\r\n",
+                  i + 1, s_priority_index.scores[i]);
+         CondenserManager_DebugPrint(debug_msg);
      }
-     
+
      return selected_count;
  }
- 
+
  uint8_t CondenserManager_SelectCondensersToStop(uint8_t stop_count, uint8_t* selected_indices)
  {
      if (selected_indices == NULL || stop_count == 0) return 0;
-     
+
      uint8_t selected_count = 0;
-     float stop_scores[MAX_CONDENSER_BANKS];
-     uint8_t stop_indices[MAX_CONDENSER_BANKS];
-     
-     // Calculate stop priority scores (lower is better for stopping)
-     for (uint8_t i = 0; i < MAX_CONDENSER_BANKS; i++) {
+
+     // Stopping wants the least optimal units first: walk the same
+     // ordering from the low-score end, filtering to running banks
+     for (uint8_t pos = 0;
+          pos < s_priority_index.count && selected_count < stop_count; pos++) {
+         uint8_t i = s_priority_index.order[pos];
          CondenserStatus_t* staging_status = Staging_GetCondenserStatus(i);
-         
-         if (staging_status != NULL && staging_status->is_running && 
-             g_condenser_manager.condensers[i].is_managed) {
-             
-             // For stopping, we want to stop the least optimal condensers
-             stop_scores[i] = 1.0f / CondenserManager_CalculatePriorityScore(i);
-             stop_indices[i] = i;
-         } else {
-             stop_scores[i] = -1.0f;  // Not running or not available
-             stop_indices[i] = i;
-         }
-     }
-     
-     // Sort by stop priority (higher score = better candidate to stop)
-     for (uint8_t i = 0; i < MAX_CONDENSER_BANKS - 1; i++) {
-         for (uint8_t j = 0; j < MAX_CONDENSER_BANKS - 1 - i; j++) {
-             if (stop_scores[j] < stop_scores[j + 1]) {
-                 // Swap scores
-                 float temp_score = stop_scores[j];
-                 stop_scores[j] = stop_scores[j + 1];
-                 stop_scores[j + 1] = temp_score;
-                 
-                 // Swap indices
-                 uint8_t temp_index = stop_indices[j];
-                 stop_indices[j] = stop_indices[j + 1];
-                 stop_indices[j + 1] = temp_index;
-             }
-         }
-     }
-     
-     // Select condensers to stop
-     for (uint8_t i = 0; i < MAX_CONDENSER_BANKS && selected_count < stop_count; i++) {
-         if (stop_scores[i] > 0.0f) {  // Valid score
-             selected_indices[selected_count] = stop_indices[i];
-             selected_count++;
-             
-             char debug_msg[100];
-             snprintf(debug_msg, sizeof(debug_msg), 
-                      "CONDENSER_MGR: Selected condenser %d to stop\r\n",
-                      stop_indices[i] + 1);
-             CondenserManager_DebugPrint(debug_msg);
+
+         if (staging_status == NULL || !staging_status->is_running ||
+             !g_condenser_manager.condensers[i].is_managed) {
+             continue;
          }
+
+         selected_indices[selected_count] = i;
+         selected_count++;
+
+         char debug_msg[100];
+         snprintf(debug_msg, sizeof(debug_msg),
+                  "CONDENSER_MGR: Selected condenser %d to stop\r\n", i + 1);
+         CondenserManager_DebugPrint(debug_msg);
      }
-     
+
      return selected_count;
  }
  
@@ -814,10 +780,59 @@
  {
      for (uint8_t i = 0; i < MAX_CONDENSER_BANKS; i++) {
          if (g_condenser_manager.condensers[i].is_managed) {
-             CondenserManager_CalculatePriorityScore(i);
+             // The index repositions only when the score actually moved
+             PriorityIndex_UpdateScore(&s_priority_index, i,
+                                       CondenserManager_CalculatePriorityScore(i));
          }
      }
  }
+
+ /**
+  * Capture one binary PerfLogEntry_t per installed unit into the SD ring
+  * log. Records land in the RAM sector and reach the card through the
+  * write-behind queue, so continuous capture costs the control loop a
+  * few memcpy calls - the 'perf_dump' command streams them back out.
+  */
+ static void CondenserManager_LogPerformanceSnapshot(void)
+ {
+     if (!SDLog_IsReady()) return;
+
+     PerfLogEntry_t entry;
+     uint32_t timestamp = HAL_GetTick() / 1000;
+
+     // Compressor counters come from the staging system
+     for (uint8_t i = 0; i < MAX_COMPRESSORS; i++) {
+         CompressorStatus_t* comp = Staging_GetCompressorStatus(i);
+         if (comp == NULL || !comp->available) continue;
+
+         entry.timestamp = timestamp;
+         entry.unit_type = SDLOG_PERF_UNIT_COMPRESSOR;
+         entry.unit_index = i;
+         entry.fault_count = comp->fault_count;
+         entry.runtime_hours = comp->runtime_hours;
+         entry.start_cycles = comp->start_cycles;
+         entry.efficiency_q16 = Q16_FROM_FLOAT(comp->performance_rating);
+         entry.trend_q16 = 0;
+         SDLog_AppendPerf(&entry);
+     }
+
+     // Condenser counters and trend slopes from the managed data
+     for (uint8_t i = 0; i < MAX_CONDENSER_BANKS; i++) {
+         CondenserManagedData_t* cond = &g_condenser_manager.condensers[i];
+         CondenserStatus_t* staging_status = Staging_GetCondenserStatus(i);
+         if (!cond->is_managed || staging_status == NULL) continue;
+
+         entry.timestamp = timestamp;
+         entry.unit_type = SDLOG_PERF_UNIT_CONDENSER;
+         entry.unit_index = i;
+         entry.fault_count = staging_status->fault_count;
+         entry.runtime_hours = cond->total_runtime_hours;
+         entry.start_cycles = cond->total_start_cycles;
+         entry.efficiency_q16 = Q16_FROM_FLOAT(cond->performance.efficiency_rating);
+         entry.trend_q16 = TrendQ16_Slope(&s_efficiency_trend[i]);
+         SDLog_AppendPerf(&entry);
+     }
+ }
  
  // ========================================================================
  // DEBUG AND DIAGNOSTICS FUNCTIONS
@@ -19,6 +19,8 @@
 /* USER CODE END Header */
 /* Includes ------------------------------------------------------------------*/
 #include "control_algorithms.h"
+#include "mem_placement.h"
+#include "run_stats.h"
 
 /* USER CODE BEGIN 0 */
 #include <string.h>
@@ -49,7 +51,7 @@ static SystemOptimization_t g_optimization_data;
 static PerformanceAnalytics_t g_performance_analytics;
 
 // PID Controllers array
-static PIDController_t g_pid_controllers[PID_MAX_CONTROLLERS];
+static PIDController_t g_pid_controllers[PID_MAX_CONTROLLERS] DTCM_BSS;
 
 // Control algorithm state variables
 static bool s_system_initialized = false;
@@ -63,6 +65,18 @@ static float s_load_prediction_buffer[LOAD_PREDICTION_HORIZON];
 static uint16_t s_prediction_buffer_index = 0;
 static float s_ambient_compensation_factor = 1.0f;
 
+// Incremental analytics statistics - O(1) per sample (run_stats.c)
+static RunStats_t s_efficiency_stats;
+static RunStats_t s_power_stats;
+static RunStats_t s_load_stats;
+
+// Incremental least-squares trend accumulators (fixed_point.c); the
+// trend query becomes a constant-time slope evaluation
+#define ANALYTICS_TREND_WINDOW  10      // Matches the old 10-sample fit
+static TrendQ16_t s_efficiency_trend_acc;
+static TrendQ16_t s_power_trend_acc;
+static TrendQ16_t s_load_trend_acc;
+
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -71,7 +85,6 @@ static float s_ambient_compensation_factor = 1.0f;
 // Internal utility functions
 static void ControlAlgorithms_InitializeDefaults(void);
 static void ControlAlgorithms_UpdatePerformanceMetrics(void);
-static float ControlAlgorithms_CalculateMovingAverage(float* buffer, uint8_t size, uint8_t index);
 static bool ControlAlgorithms_ValidateParameters(void);
 static void ControlAlgorithms_DebugPrint(const char* message);
 
@@ -217,7 +230,8 @@ bool PID_Init(PIDController_t* pid, float kp, float ki, float kd)
     pid->output_max = PID_OUTPUT_MAX;
     pid->last_update_time = HAL_GetTick();
     pid->enabled = false;
-    
+    pid->use_fixed_point = false;
+
     // Clear error history
     memset(pid->error_history, 0, sizeof(pid->error_history));
     pid->history_index = 0;
@@ -225,10 +239,20 @@ bool PID_Init(PIDController_t* pid, float kp, float ki, float kd)
     return true;
 }
 
-float PID_Update(PIDController_t* pid, float process_value, float setpoint)
+ITCM_FUNC float PID_Update(PIDController_t* pid, float process_value, float setpoint)
 {
     if (pid == NULL || !pid->enabled) return 0.0f;
-    
+
+    // Fixed-point path: deterministic Q16.16 kernel (fixed_point.c)
+    if (pid->use_fixed_point) {
+        q16_t out = PIDQ16_Update(&pid->q16,
+                                  Q16_FROM_FLOAT(process_value),
+                                  Q16_FROM_FLOAT(setpoint));
+        pid->setpoint = setpoint;
+        pid->output = Q16_TO_FLOAT(out);
+        return pid->output;
+    }
+
     uint32_t current_time = HAL_GetTick();
     float dt = (float)(current_time - pid->last_update_time) / 1000.0f;  // Convert to seconds
     
@@ -283,7 +307,14 @@ void PID_SetTunings(PIDController_t* pid, float kp, float ki, float kd)
     pid->kp = kp;
     pid->ki = ki;
     pid->kd = kd;
-    
+
+    // Keep the fixed-point mirror in sync
+    if (pid->use_fixed_point) {
+        pid->q16.kp = Q16_FROM_FLOAT(kp);
+        pid->q16.ki = Q16_FROM_FLOAT(ki);
+        pid->q16.kd = Q16_FROM_FLOAT(kd);
+    }
+
     char debug_msg[100];
     snprintf(debug_msg, sizeof(debug_msg), 
              "PID: Tunings updated - Kp:%.3f Ki:%.3f Kd:%.3f\r\n", kp, ki, kd);
@@ -313,7 +344,11 @@ void PID_Reset(PIDController_t* pid)
     // Clear error history
     memset(pid->error_history, 0, sizeof(pid->error_history));
     pid->history_index = 0;
-    
+
+    if (pid->use_fixed_point) {
+        PIDQ16_Reset(&pid->q16);
+    }
+
     pid->last_update_time = HAL_GetTick();
 }
 
@@ -325,10 +360,23 @@ void PID_Enable(PIDController_t* pid, bool enabled)
         // Reset PID when enabling
         PID_Reset(pid);
     }
-    
+
     pid->enabled = enabled;
 }
 
+void PID_EnableFixedPoint(PIDController_t* pid, bool enabled)
+{
+    if (pid == NULL) return;
+
+    if (enabled) {
+        // Mirror the float tunings and limits into the Q16.16 state
+        PIDQ16_Init(&pid->q16, pid->kp, pid->ki, pid->kd);
+        PIDQ16_SetOutputLimits(&pid->q16, pid->output_min, pid->output_max);
+    }
+
+    pid->use_fixed_point = enabled;
+}
+
 // ========================================================================
 // ADVANCED CONTROL FUNCTIONS
 // ========================================================================
@@ -530,7 +578,18 @@ bool PerformanceAnalytics_Init(PerformanceAnalytics_t* analytics)
     analytics->efficiency_trend = 0.0f;
     analytics->power_trend = 0.0f;
     analytics->data_valid = false;
-    
+
+    // Reset the incremental averages (windowed mean tracks the history
+    // buffers without rescanning them)
+    RunStats_Init(&s_efficiency_stats, PERFORMANCE_WINDOW_SIZE, 0.1f);
+    RunStats_Init(&s_power_stats, PERFORMANCE_WINDOW_SIZE, 0.1f);
+    RunStats_Init(&s_load_stats, PERFORMANCE_WINDOW_SIZE, 0.1f);
+
+    // Reset the incremental trend accumulators
+    TrendQ16_Init(&s_efficiency_trend_acc, ANALYTICS_TREND_WINDOW);
+    TrendQ16_Init(&s_power_trend_acc, ANALYTICS_TREND_WINDOW);
+    TrendQ16_Init(&s_load_trend_acc, ANALYTICS_TREND_WINDOW);
+
     return true;
 }
 
@@ -545,15 +604,22 @@ void PerformanceAnalytics_UpdateData(PerformanceAnalytics_t* analytics,
     analytics->load_history[analytics->history_index] = load;
     
     analytics->history_index = (analytics->history_index + 1) % PERFORMANCE_WINDOW_SIZE;
-    
-    // Calculate averages
-    analytics->average_efficiency = ControlAlgorithms_CalculateMovingAverage(
-        analytics->efficiency_history, PERFORMANCE_WINDOW_SIZE, analytics->history_index);
-    analytics->average_power = ControlAlgorithms_CalculateMovingAverage(
-        analytics->power_history, PERFORMANCE_WINDOW_SIZE, analytics->history_index);
-    analytics->average_load = ControlAlgorithms_CalculateMovingAverage(
-        analytics->load_history, PERFORMANCE_WINDOW_SIZE, analytics->history_index);
-    
+
+    // Update averages incrementally - O(1) per sample instead of a
+    // full history-buffer walk per metric
+    RunStats_Add(&s_efficiency_stats, efficiency);
+    RunStats_Add(&s_power_stats, power);
+    RunStats_Add(&s_load_stats, load);
+
+    // Feed the trend accumulators (O(1) per sample)
+    TrendQ16_Add(&s_efficiency_trend_acc, Q16_FROM_FLOAT(efficiency));
+    TrendQ16_Add(&s_power_trend_acc, Q16_FROM_FLOAT(power));
+    TrendQ16_Add(&s_load_trend_acc, Q16_FROM_FLOAT(load));
+
+    analytics->average_efficiency = RunStats_Mean(&s_efficiency_stats);
+    analytics->average_power = RunStats_Mean(&s_power_stats);
+    analytics->average_load = RunStats_Mean(&s_load_stats);
+
     // Calculate trends (simple linear trend)
     analytics->efficiency_trend = PerformanceAnalytics_GetTrend(analytics, 0);
     analytics->power_trend = PerformanceAnalytics_GetTrend(analytics, 1);
@@ -564,40 +630,15 @@ void PerformanceAnalytics_UpdateData(PerformanceAnalytics_t* analytics,
 float PerformanceAnalytics_GetTrend(PerformanceAnalytics_t* analytics, uint8_t metric_type)
 {
     if (analytics == NULL || !analytics->data_valid) return 0.0f;
-    
-    float* data_array;
-    
+
+    // The least-squares sums are maintained incrementally as samples
+    // arrive, so the slope is a constant-time formula evaluation
     switch (metric_type) {
-        case 0: data_array = analytics->efficiency_history; break;
-        case 1: data_array = analytics->power_history; break;
-        case 2: data_array = analytics->load_history; break;
+        case 0: return Q16_TO_FLOAT(TrendQ16_Slope(&s_efficiency_trend_acc));
+        case 1: return Q16_TO_FLOAT(TrendQ16_Slope(&s_power_trend_acc));
+        case 2: return Q16_TO_FLOAT(TrendQ16_Slope(&s_load_trend_acc));
         default: return 0.0f;
     }
-    
-    // Simple trend calculation (last 10 samples)
-    uint8_t trend_samples = 10;
-    if (trend_samples > PERFORMANCE_WINDOW_SIZE) trend_samples = PERFORMANCE_WINDOW_SIZE;
-    
-    float sum_x = 0.0f, sum_y = 0.0f, sum_xy = 0.0f, sum_x2 = 0.0f;
-    
-    for (uint8_t i = 0; i < trend_samples; i++) {
-        uint8_t index = (analytics->history_index - trend_samples + i + PERFORMANCE_WINDOW_SIZE) % PERFORMANCE_WINDOW_SIZE;
-        float x = (float)i;
-        float y = data_array[index];
-        
-        sum_x += x;
-        sum_y += y;
-        sum_xy += x * y;
-        sum_x2 += x * x;
-    }
-    
-    // Calculate slope (trend)
-    float denominator = trend_samples * sum_x2 - sum_x * sum_x;
-    if (fabsf(denominator) > 0.001f) {
-        return (trend_samples * sum_xy - sum_x * sum_y) / denominator;
-    }
-    
-    return 0.0f;
 }
 
 // ========================================================================
@@ -651,15 +692,6 @@ static void ControlAlgorithms_UpdatePerformanceMetrics(void)
                                    g_control_params.load_factor);
 }
 
-static float ControlAlgorithms_CalculateMovingAverage(float* buffer, uint8_t size, uint8_t index)
-{
-    float sum = 0.0f;
-    for (uint8_t i = 0; i < size; i++) {
-        sum += buffer[i];
-    }
-    return sum / size;
-}
-
 float ControlAlgorithms_LimitOutput(float output, float min, float max)
 {
     if (output > max) return max;
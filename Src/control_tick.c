@@ -0,0 +1,120 @@
+/**
+ * @file    control_tick.c
+ * @brief   10 ms Hardware Control Tick Implementation
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ */
+
+#include "control_tick.h"
+#include "ch_safety.h"
+#include "ch_temp_control.h"
+#include "mem_placement.h"
+#include "uart_comm.h"
+#include <stdio.h>
+
+static TIM_HandleTypeDef htim7;
+
+static uint8_t tick_active = 0;
+static volatile uint32_t tick_count = 0;
+
+/* Jitter/runtime statistics in DWT cycles (converted to us on print) */
+static uint32_t tick_last_entry = 0;
+static uint32_t tick_period_min = 0xFFFFFFFF;
+static uint32_t tick_period_max = 0;
+static uint32_t tick_exec_max = 0;
+
+/**
+ * @brief One control tick: jitter accounting, trip scan, PID update
+ * @note  Interrupt context, ITCM - no logging, no drivers, no waiting
+ */
+ITCM_FUNC static void ControlTick_Run(void)
+{
+    uint32_t entry = DWT->CYCCNT;
+
+    if (tick_count > 0) {
+        uint32_t period = entry - tick_last_entry;
+        if (period < tick_period_min) tick_period_min = period;
+        if (period > tick_period_max) tick_period_max = period;
+    }
+    tick_last_entry = entry;
+    tick_count++;
+
+    // Deterministic kernels: analog trip detection (drops compressor
+    // relays directly on a trip) and the PID update on the snapshot
+    Safety_TickISR();
+    TempControl_TickPID();
+
+    uint32_t exec = DWT->CYCCNT - entry;
+    if (exec > tick_exec_max) tick_exec_max = exec;
+}
+
+ITCM_FUNC void ControlTick_IRQHandler(void)
+{
+    if (TIM7->SR & TIM_SR_UIF) {
+        TIM7->SR = ~TIM_SR_UIF;
+        ControlTick_Run();
+    }
+}
+
+uint8_t ControlTick_Init(void)
+{
+    __HAL_RCC_TIM7_CLK_ENABLE();
+
+    // APB1 timer clock (PCLK1 x2 when the APB prescaler divides).
+    // Prescale to 10 kHz, count 100 -> 10 ms update rate.
+    uint32_t timer_clock = HAL_RCC_GetPCLK1Freq();
+    if ((RCC->D2CFGR & RCC_D2CFGR_D2PPRE1) != RCC_D2CFGR_D2PPRE1_DIV1) {
+        timer_clock *= 2;
+    }
+
+    htim7.Instance = TIM7;
+    htim7.Init.Prescaler = (timer_clock / 10000U) - 1U;
+    htim7.Init.CounterMode = TIM_COUNTERMODE_UP;
+    htim7.Init.Period = (10U * CONTROL_TICK_PERIOD_MS) - 1U;
+    htim7.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;
+
+    if (HAL_TIM_Base_Init(&htim7) != HAL_OK) {
+        Send_Debug_Data("Control tick: TIM7 init FAILED\r\n");
+        return 0;
+    }
+
+    HAL_NVIC_SetPriority(TIM7_IRQn, CONTROL_TICK_IRQ_PRIORITY, 0);
+    HAL_NVIC_EnableIRQ(TIM7_IRQn);
+
+    tick_active = 1;
+    if (HAL_TIM_Base_Start_IT(&htim7) != HAL_OK) {
+        tick_active = 0;
+        Send_Debug_Data("Control tick: TIM7 start FAILED\r\n");
+        return 0;
+    }
+
+    Send_Debug_Data("Control tick: TIM7 armed (10ms, PID + trip scan in ISR)\r\n");
+    return 1;
+}
+
+uint8_t ControlTick_IsActive(void)
+{
+    return tick_active;
+}
+
+void ControlTick_PrintStats(void)
+{
+    char msg[140];
+    uint32_t cycles_per_us = SystemCoreClock / 1000000U;
+    if (cycles_per_us == 0) cycles_per_us = 1;
+
+    Send_Debug_Data("\r\n=== Control Tick ===\r\n");
+    snprintf(msg, sizeof(msg), "State: %s, ticks=%lu\r\n",
+             tick_active ? "RUNNING" : "OFF", tick_count);
+    Send_Debug_Data(msg);
+
+    if (tick_count > 1) {
+        snprintf(msg, sizeof(msg),
+                 "Period: %lu..%lu us (nominal %u ms), worst ISR %lu us\r\n",
+                 tick_period_min / cycles_per_us, tick_period_max / cycles_per_us,
+                 CONTROL_TICK_PERIOD_MS, tick_exec_max / cycles_per_us);
+        Send_Debug_Data(msg);
+    }
+    Send_Debug_Data("====================\r\n\r\n");
+}
@@ -0,0 +1,146 @@
+/**
+ * @file    cpu_load.c
+ * @brief   CPU Load Monitor Implementation
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ */
+
+#include "cpu_load.h"
+#include "scheduler.h"
+#include "mem_placement.h"
+#include "uart_comm.h"
+#include <stdio.h>
+#include <string.h>
+
+/* ========================================================================== */
+/* PRIVATE VARIABLES                                                          */
+/* ========================================================================== */
+
+/* Idle accounting. The baseline is iterations of the empty scheduler
+ * loop per window, measured at boot; a live window that falls short has
+ * spent the difference in tasks and interrupts. */
+static uint32_t idle_baseline = 0;          // Iterations per window, unloaded
+static uint32_t idle_counter = 0;           // Iterations this window
+static uint32_t window_start = 0;
+static uint8_t load_percent = 0;            // Last completed window
+static uint8_t load_peak = 0;
+static uint32_t load_avg_x10 = 0;           // EMA, 1/8 weight, tenths
+
+/* Per-IRQ statistics - written only from handler context */
+typedef struct {
+    uint32_t count;
+    uint32_t max_cycles;
+    uint64_t total_cycles;
+} IrqStat_t;
+
+static IrqStat_t irq_stats[CPU_IRQ_SLOT_COUNT];
+
+static const char *irq_names[CPU_IRQ_SLOT_COUNT] = {
+    "SysTick", "EXTI0", "EXTI9_5", "UART4", "UART8", "UART7",
+    "DMA-U8RX", "DMA-U7TX", "SPI4", "DMA-S4TX", "DMA-S4RX",
+    "DMA-U4RX", "SDMMC1", "TIM7"
+};
+
+/* ========================================================================== */
+/* PUBLIC FUNCTIONS                                                           */
+/* ========================================================================== */
+
+void CpuLoad_Calibrate(void)
+{
+    char msg[80];
+    uint32_t start = HAL_GetTick();
+    uint32_t iterations = 0;
+
+    // Same loop shape as main's superloop, before any task exists -
+    // whatever rate we see here is 0% load by definition
+    while ((HAL_GetTick() - start) < CPU_LOAD_CAL_MS) {
+        Scheduler_Process();
+        iterations++;
+    }
+
+    idle_baseline = (iterations * CPU_LOAD_WINDOW_MS) / CPU_LOAD_CAL_MS;
+    idle_counter = 0;
+    window_start = HAL_GetTick();
+    memset(irq_stats, 0, sizeof(irq_stats));
+
+    snprintf(msg, sizeof(msg), "CPU Load: Calibrated, %lu idle iters/s\r\n",
+             idle_baseline);
+    Send_Debug_Data(msg);
+}
+
+void CpuLoad_IdleHook(void)
+{
+    idle_counter++;
+
+    uint32_t now = HAL_GetTick();
+    if ((now - window_start) < CPU_LOAD_WINDOW_MS || idle_baseline == 0) {
+        return;
+    }
+
+    uint32_t idle_pct = (idle_counter * 100u) / idle_baseline;
+    if (idle_pct > 100u) idle_pct = 100u;   // Calibration jitter
+    load_percent = (uint8_t)(100u - idle_pct);
+
+    if (load_percent > load_peak) {
+        load_peak = load_percent;
+    }
+    load_avg_x10 = load_avg_x10 - (load_avg_x10 >> 3) +
+                   ((uint32_t)load_percent * 10u >> 3);
+
+    idle_counter = 0;
+    window_start = now;
+}
+
+uint8_t CpuLoad_GetPercent(void)
+{
+    return load_percent;
+}
+
+ITCM_FUNC uint32_t CpuLoad_IrqEnter(void)
+{
+    return DWT->CYCCNT;
+}
+
+ITCM_FUNC void CpuLoad_IrqExit(uint8_t slot, uint32_t entry_cycles)
+{
+    if (slot >= CPU_IRQ_SLOT_COUNT) return;
+
+    // CYCCNT wraps every ~15s at 280MHz; unsigned subtraction stays correct
+    uint32_t elapsed = DWT->CYCCNT - entry_cycles;
+    IrqStat_t *stat = &irq_stats[slot];
+
+    stat->count++;
+    stat->total_cycles += elapsed;
+    if (elapsed > stat->max_cycles) {
+        stat->max_cycles = elapsed;
+    }
+}
+
+void CpuLoad_PrintStatus(void)
+{
+    char msg[120];
+    uint32_t mhz = HAL_RCC_GetSysClockFreq() / 1000000u;
+    if (mhz == 0) mhz = 1;
+
+    Send_Debug_Data("\r\n=== CPU Load ===\r\n");
+    snprintf(msg, sizeof(msg), "Load: %u%% (avg %lu.%lu%%, peak %u%%)\r\n",
+             load_percent, load_avg_x10 / 10, load_avg_x10 % 10, load_peak);
+    Send_Debug_Data(msg);
+    snprintf(msg, sizeof(msg), "Idle baseline: %lu iters/s, current window: %lu\r\n",
+             idle_baseline, idle_counter);
+    Send_Debug_Data(msg);
+
+    Send_Debug_Data("IRQ       Count      Max us   Avg us\r\n");
+    for (uint8_t i = 0; i < CPU_IRQ_SLOT_COUNT; i++) {
+        IrqStat_t *stat = &irq_stats[i];
+        if (stat->count == 0) continue;
+
+        uint32_t max_us = stat->max_cycles / mhz;
+        uint32_t avg_us = (uint32_t)(stat->total_cycles / stat->count) / mhz;
+        snprintf(msg, sizeof(msg), "%-9s %-10lu %-8lu %lu\r\n",
+                 irq_names[i], stat->count, max_us, avg_us);
+        Send_Debug_Data(msg);
+    }
+    Send_Debug_Data("================\r\n\r\n");
+}
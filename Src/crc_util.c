@@ -0,0 +1,145 @@
+/**
+ * @file    crc_util.c
+ * @brief   Shared CRC Kernel Implementation
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ */
+
+#include "crc_util.h"
+
+/* ========================================================================== */
+/* PRIVATE VARIABLES                                                          */
+/* ========================================================================== */
+
+/* Lookup tables are generated on first use - 8 iterations per table entry
+ * once, instead of 8 iterations per data byte forever. */
+static uint16_t crc16_table[256];
+static uint8_t crc16_table_ready = 0;
+
+static uint8_t crc8_table[256];
+static uint8_t crc8_table_ready = 0;
+
+static uint32_t crc32_table[256];
+static uint8_t crc32_table_ready = 0;
+
+#ifdef HAL_CRC_MODULE_ENABLED
+static CRC_HandleTypeDef hcrc_util;
+static uint8_t crc32_hw_ready = 0;
+static uint8_t crc32_hw_probed = 0;
+#endif
+
+/* ========================================================================== */
+/* PRIVATE FUNCTIONS                                                          */
+/* ========================================================================== */
+
+static void CRC16_BuildTable(void) {
+    for (uint16_t i = 0; i < 256; i++) {
+        uint16_t crc = i;
+        for (uint8_t j = 0; j < 8; j++) {
+            if (crc & 0x0001) {
+                crc = (crc >> 1) ^ 0xA001;
+            } else {
+                crc >>= 1;
+            }
+        }
+        crc16_table[i] = crc;
+    }
+    crc16_table_ready = 1;
+}
+
+static void CRC8_BuildTable(void) {
+    for (uint16_t i = 0; i < 256; i++) {
+        uint8_t crc = (uint8_t)i;
+        for (uint8_t j = 0; j < 8; j++) {
+            if (crc & 0x80) {
+                crc = (uint8_t)((crc << 1) ^ 0x07);
+            } else {
+                crc = (uint8_t)(crc << 1);
+            }
+        }
+        crc8_table[i] = crc;
+    }
+    crc8_table_ready = 1;
+}
+
+static void CRC32_BuildTable(void) {
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t crc = i;
+        for (uint8_t j = 0; j < 8; j++) {
+            if (crc & 1) {
+                crc = (crc >> 1) ^ 0xEDB88320;
+            } else {
+                crc >>= 1;
+            }
+        }
+        crc32_table[i] = crc;
+    }
+    crc32_table_ready = 1;
+}
+
+#ifdef HAL_CRC_MODULE_ENABLED
+/**
+ * @brief One-time hardware CRC unit setup for standard (reflected) CRC32
+ */
+static void CRC32_HwProbe(void) {
+    crc32_hw_probed = 1;
+
+    __HAL_RCC_CRC_CLK_ENABLE();
+
+    hcrc_util.Instance = CRC;
+    hcrc_util.Init.DefaultPolynomialUse = DEFAULT_POLYNOMIAL_ENABLE;
+    hcrc_util.Init.DefaultInitValueUse = DEFAULT_INIT_VALUE_ENABLE;
+    hcrc_util.Init.InputDataInversionMode = CRC_INPUTDATA_INVERSION_BYTE;
+    hcrc_util.Init.OutputDataInversionMode = CRC_OUTPUTDATA_INVERSION_ENABLE;
+    hcrc_util.InputDataFormat = CRC_INPUTDATA_FORMAT_BYTES;
+
+    if (HAL_CRC_Init(&hcrc_util) == HAL_OK) {
+        crc32_hw_ready = 1;
+    }
+}
+#endif
+
+/* ========================================================================== */
+/* PUBLIC FUNCTIONS                                                           */
+/* ========================================================================== */
+
+uint16_t CRC16_Modbus(const uint8_t *data, uint16_t length) {
+    if (!crc16_table_ready) CRC16_BuildTable();
+
+    uint16_t crc = 0xFFFF;
+    for (uint16_t i = 0; i < length; i++) {
+        crc = (crc >> 8) ^ crc16_table[(crc ^ data[i]) & 0xFF];
+    }
+    return crc;
+}
+
+uint8_t CRC8_Calculate(const uint8_t *data, uint16_t length) {
+    if (!crc8_table_ready) CRC8_BuildTable();
+
+    uint8_t crc = 0x00;
+    for (uint16_t i = 0; i < length; i++) {
+        crc = crc8_table[crc ^ data[i]];
+    }
+    return crc;
+}
+
+uint32_t CRC32_Calculate(const uint8_t *data, uint32_t length) {
+#ifdef HAL_CRC_MODULE_ENABLED
+    if (!crc32_hw_probed) CRC32_HwProbe();
+    if (crc32_hw_ready) {
+        // Hardware unit with byte-reversed input and reversed output gives
+        // the standard CRC32 after the final XOR
+        uint32_t crc = HAL_CRC_Calculate(&hcrc_util, (uint32_t*)(uintptr_t)data, length);
+        return crc ^ 0xFFFFFFFF;
+    }
+#endif
+
+    if (!crc32_table_ready) CRC32_BuildTable();
+
+    uint32_t crc = 0xFFFFFFFF;
+    for (uint32_t i = 0; i < length; i++) {
+        crc = (crc >> 8) ^ crc32_table[(crc ^ data[i]) & 0xFF];
+    }
+    return ~crc;
+}
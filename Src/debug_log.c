@@ -0,0 +1,189 @@
+/**
+ * @file    debug_log.c
+ * @brief   Logging Facade Implementation
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ */
+
+#include "debug_log.h"
+#include "timebase.h"
+#include "uart_comm.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <stdlib.h>
+
+/* ========================================================================== */
+/* PRIVATE TYPES AND VARIABLES                                                */
+/* ========================================================================== */
+
+/* One deferred entry: the format pointer (literal) plus raw words. The
+ * pump always passes all three words to snprintf - surplus varargs are
+ * harmless, the format consumes what it names. */
+typedef struct {
+    const char *format;
+    uint32_t args[LOG_DEFER_MAX_ARGS];
+    uint32_t t_us;                      // Capture time, microseconds (low word)
+} log_defer_entry_t;
+
+/* Ring follows the event_queue idiom: head written under a short
+ * PRIMASK guard (multiple producers, some in ISRs), tail owned by the
+ * single-consumer pump. */
+static log_defer_entry_t defer_ring[LOG_DEFER_RING_SIZE];
+static volatile uint8_t defer_head = 0;
+static volatile uint8_t defer_tail = 0;
+
+/* Runtime per-module levels */
+static uint8_t runtime_level[LOG_MOD_COUNT];
+
+static const char *module_names[LOG_MOD_COUNT] = {
+    "sys", "gpio", "safety", "ctrl", "flash", "net"
+};
+
+/* Statistics */
+static uint32_t log_sent = 0;
+static uint32_t log_suppressed = 0;         // Runtime gate rejections
+static uint32_t defer_posted = 0;
+static uint32_t defer_dropped = 0;          // Ring-full drops
+
+/* ========================================================================== */
+/* PUBLIC FUNCTIONS                                                           */
+/* ========================================================================== */
+
+void DebugLog_Init(void)
+{
+    defer_head = 0;
+    defer_tail = 0;
+    for (uint8_t i = 0; i < LOG_MOD_COUNT; i++) {
+        runtime_level[i] = LOG_LEVEL_INFO;
+    }
+
+    Send_Debug_Data("DebugLog: Facade ready (default level INFO)\r\n");
+}
+
+uint8_t DebugLog_Enabled(uint8_t module, uint8_t level)
+{
+    if (module >= LOG_MOD_COUNT) return 0;
+    return level <= runtime_level[module];
+}
+
+void DebugLog_SetLevel(uint8_t module, uint8_t level)
+{
+    if (module >= LOG_MOD_COUNT || level > LOG_LEVEL_DEBUG) return;
+    runtime_level[module] = level;
+}
+
+void DebugLog_Printf(uint8_t module, uint8_t level, const char *format, ...)
+{
+    char msg[160];
+    va_list args;
+
+    // The runtime gate sits before the formatting, not after it
+    if (!DebugLog_Enabled(module, level)) {
+        log_suppressed++;
+        return;
+    }
+
+    va_start(args, format);
+    vsnprintf(msg, sizeof(msg), format, args);
+    va_end(args);
+
+    Send_Debug_Data(msg);
+    log_sent++;
+}
+
+uint8_t DebugLog_Defer(uint8_t module, uint8_t level, const char *format,
+                       uint32_t a0, uint32_t a1, uint32_t a2)
+{
+    if (!DebugLog_Enabled(module, level)) {
+        log_suppressed++;
+        return 0;
+    }
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    uint8_t next_head = (defer_head + 1) & (LOG_DEFER_RING_SIZE - 1);
+    if (next_head == defer_tail) {
+        defer_dropped++;
+        if (!primask) __enable_irq();
+        return 0;
+    }
+
+    log_defer_entry_t *slot = &defer_ring[defer_head];
+    slot->format = format;
+    slot->args[0] = a0;
+    slot->args[1] = a1;
+    slot->args[2] = a2;
+    slot->t_us = (uint32_t)Timebase_Micros64();
+    defer_head = next_head;
+    defer_posted++;
+
+    if (!primask) __enable_irq();
+    return 1;
+}
+
+void DebugLog_Pump(void)
+{
+    char msg[160];
+
+    for (uint8_t i = 0; i < LOG_PUMP_BATCH; i++) {
+        if (defer_head == defer_tail) {
+            return;
+        }
+
+        /* Single consumer - tail only moves here, no masking needed */
+        log_defer_entry_t entry = defer_ring[defer_tail];
+        defer_tail = (defer_tail + 1) & (LOG_DEFER_RING_SIZE - 1);
+
+        // Timestamp reflects capture time, not drain time - the whole
+        // point of deferring is that those can be far apart
+        snprintf(msg, sizeof(msg), "[%lu.%06lu] ",
+                 entry.t_us / 1000000u, entry.t_us % 1000000u);
+        Send_Debug_Data(msg);
+        snprintf(msg, sizeof(msg), entry.format,
+                 entry.args[0], entry.args[1], entry.args[2]);
+        Send_Debug_Data(msg);
+        log_sent++;
+    }
+}
+
+void DebugLog_PrintStatus(void)
+{
+    char msg[120];
+
+    Send_Debug_Data("\r\n=== Debug Log ===\r\n");
+    for (uint8_t i = 0; i < LOG_MOD_COUNT; i++) {
+        snprintf(msg, sizeof(msg), "%-8s level %u\r\n",
+                 module_names[i], runtime_level[i]);
+        Send_Debug_Data(msg);
+    }
+    snprintf(msg, sizeof(msg),
+             "Sent: %lu, suppressed: %lu, deferred: %lu, dropped: %lu\r\n",
+             log_sent, log_suppressed, defer_posted, defer_dropped);
+    Send_Debug_Data(msg);
+    Send_Debug_Data("=================\r\n\r\n");
+}
+
+void DebugLog_HandleCommand(const char *args)
+{
+    // Expected: "<module> <level>", e.g. "loglevel net 1"
+    char name[12];
+    int level;
+
+    if (args == NULL || sscanf(args, "%11s %d", name, &level) != 2) {
+        Send_Debug_Data("Usage: loglevel <sys|gpio|safety|ctrl|flash|net> <0-4>\r\n");
+        return;
+    }
+
+    for (uint8_t i = 0; i < LOG_MOD_COUNT; i++) {
+        if (strcmp(name, module_names[i]) == 0) {
+            DebugLog_SetLevel(i, (uint8_t)level);
+            DebugLog_Printf(LOG_MOD_SYS, LOG_LEVEL_ERROR,
+                            "DebugLog: %s -> level %d\r\n", name, level);
+            return;
+        }
+    }
+    Send_Debug_Data("DebugLog: Unknown module\r\n");
+}
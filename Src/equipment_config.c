@@ -9,11 +9,11 @@
   */
 
 #include "equipment_config.h"
+#include "crc_util.h"
 #include <stdio.h>
 
 /* Private Constants ---------------------------------------------------------*/
 #define CONFIG_MAGIC_NUMBER             0xCH1LL3R   // Magic number for config validation
-#define CONFIG_CRC32_POLYNOMIAL         0xEDB88320  // Standard CRC32 polynomial
 #define CONFIG_DEFAULT_UPDATE_COUNT     10          // Flash update after 10 changes
 
 /* Private Variables ---------------------------------------------------------*/
@@ -501,20 +501,8 @@ uint32_t EquipmentConfig_CalculateCRC32(void)
  */
 static uint32_t Config_CalculateCRC32(const uint8_t *data, uint32_t length)
 {
-    uint32_t crc = 0xFFFFFFFF;
-    
-    for (uint32_t i = 0; i < length; i++) {
-        crc ^= data[i];
-        for (int j = 0; j < 8; j++) {
-            if (crc & 1) {
-                crc = (crc >> 1) ^ CONFIG_CRC32_POLYNOMIAL;
-            } else {
-                crc >>= 1;
-            }
-        }
-    }
-    
-    return ~crc;
+    // Shared kernel - hardware CRC unit when available, table-driven otherwise
+    return CRC32_Calculate(data, length);
 }
 
 /**
@@ -0,0 +1,108 @@
+/**
+ * @file    event_queue.c
+ * @brief   Lock-Free Event Queue Implementation
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ */
+
+#include "event_queue.h"
+#include "uart_comm.h"
+#include <string.h>
+#include <stdio.h>
+
+/* Ring storage. Head is written by ISRs, tail by the main loop; the
+ * short PRIMASK guard in Post covers the multiple interrupt sources
+ * (UART, SDMMC, SPI) that would otherwise race on the head index. */
+static event_t event_ring[EVENT_QUEUE_SIZE];
+static volatile uint8_t event_head = 0;     // Write index (producer: ISRs)
+static volatile uint8_t event_tail = 0;     // Read index (consumer: main loop)
+
+/* Statistics */
+static uint32_t events_posted = 0;
+static uint32_t events_dropped = 0;
+static uint32_t events_popped = 0;
+static uint8_t depth_high_water = 0;
+static uint32_t latency_max_ms = 0;
+static uint32_t latency_avg_ms = 0;         // EMA, 1/8 weight
+
+void EventQueue_Init(void) {
+    event_head = 0;
+    event_tail = 0;
+    events_posted = 0;
+    events_dropped = 0;
+    events_popped = 0;
+    depth_high_water = 0;
+    latency_max_ms = 0;
+    latency_avg_ms = 0;
+
+    Send_Debug_Data("EventQueue: Initialized\r\n");
+}
+
+uint8_t EventQueue_Post(event_type_t type, uint8_t param, uint16_t value) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    uint8_t next_head = (event_head + 1) & (EVENT_QUEUE_SIZE - 1);
+    if (next_head == event_tail) {
+        events_dropped++;
+        if (!primask) __enable_irq();
+        return 0;
+    }
+
+    event_t *slot = &event_ring[event_head];
+    slot->type = (uint8_t)type;
+    slot->param = param;
+    slot->value = value;
+    slot->post_time = HAL_GetTick();
+    event_head = next_head;
+    events_posted++;
+
+    uint8_t depth = (event_head - event_tail) & (EVENT_QUEUE_SIZE - 1);
+    if (depth > depth_high_water) {
+        depth_high_water = depth;
+    }
+
+    if (!primask) __enable_irq();
+    return 1;
+}
+
+uint8_t EventQueue_Pop(event_t *event) {
+    if (event == NULL || event_head == event_tail) {
+        return 0;
+    }
+
+    /* Single consumer - tail only moves here, so no masking needed */
+    *event = event_ring[event_tail];
+    event_tail = (event_tail + 1) & (EVENT_QUEUE_SIZE - 1);
+    events_popped++;
+
+    /* Post-to-dispatch latency: the one number that shows whether the
+     * main loop is keeping up with its interrupt sources */
+    uint32_t latency = HAL_GetTick() - event->post_time;
+    if (latency > latency_max_ms) {
+        latency_max_ms = latency;
+    }
+    latency_avg_ms = latency_avg_ms - (latency_avg_ms >> 3) + (latency >> 3);
+
+    return 1;
+}
+
+uint8_t EventQueue_Pending(void) {
+    return (event_head - event_tail) & (EVENT_QUEUE_SIZE - 1);
+}
+
+void EventQueue_PrintStatus(void) {
+    char msg[100];
+
+    Send_Debug_Data("=== EVENT QUEUE STATUS ===\r\n");
+    snprintf(msg, sizeof(msg), "Posted: %lu, Popped: %lu, Dropped: %lu\r\n",
+             events_posted, events_popped, events_dropped);
+    Send_Debug_Data(msg);
+    snprintf(msg, sizeof(msg), "Depth: %u now, %u high water (of %u)\r\n",
+             EventQueue_Pending(), depth_high_water, EVENT_QUEUE_SIZE - 1);
+    Send_Debug_Data(msg);
+    snprintf(msg, sizeof(msg), "Dispatch latency: %lums avg, %lums max\r\n",
+             latency_avg_ms, latency_max_ms);
+    Send_Debug_Data(msg);
+}
@@ -0,0 +1,253 @@
+/**
+ * @file    fault_intake.c
+ * @brief   Central Fault Intake Implementation
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ */
+
+#include "fault_intake.h"
+#include "flash_config.h"
+#include "uart_comm.h"
+#include <stdio.h>
+#include <string.h>
+
+/* ========================================================================== */
+/* PRIVATE TYPES AND VARIABLES                                                */
+/* ========================================================================== */
+
+/* One queued fault. Descriptions are string literals at every call
+ * site, so storing the pointer is safe and keeps the entry small. */
+typedef struct {
+    uint16_t code;
+    uint8_t severity;
+    uint8_t used;
+    uint16_t occurrences;               // Coalesced repeats while queued
+    uint32_t first_tick;                // Oldest occurrence (drain tiebreak)
+    float value;
+    const char *description;
+} fault_entry_t;
+
+/* Token bucket for one fault code. Slots are recycled least-recently-
+ * refilled when a storm involves more distinct codes than slots. */
+typedef struct {
+    uint16_t code;
+    uint8_t in_use;
+    uint8_t tokens;
+    uint32_t last_refill;
+    uint32_t suppressed;
+} fault_bucket_t;
+
+static fault_entry_t fault_queue[FAULT_QUEUE_SIZE];
+static fault_bucket_t buckets[FAULT_BUCKET_SLOTS];
+
+/* Statistics */
+static uint32_t faults_reported = 0;
+static uint32_t faults_retired = 0;
+static uint32_t faults_coalesced = 0;
+static uint32_t faults_suppressed = 0;      // Bucket empty, nothing queued
+static uint32_t faults_evicted = 0;         // Lower severity pushed out
+static uint32_t faults_dropped = 0;         // Queue full of higher severity
+static uint8_t queue_high_water = 0;
+
+/* ========================================================================== */
+/* PRIVATE FUNCTIONS                                                          */
+/* ========================================================================== */
+
+/**
+ * @brief Find or allocate the token bucket for a code, refilled to now
+ */
+static fault_bucket_t* FaultIntake_GetBucket(uint16_t code, uint32_t now)
+{
+    fault_bucket_t *oldest = &buckets[0];
+
+    for (uint8_t i = 0; i < FAULT_BUCKET_SLOTS; i++) {
+        if (buckets[i].in_use && buckets[i].code == code) {
+            // Lazy refill - no periodic bucket maintenance needed
+            uint32_t earned = (now - buckets[i].last_refill) / FAULT_BUCKET_REFILL_MS;
+            if (earned > 0) {
+                buckets[i].tokens = (buckets[i].tokens + earned > FAULT_BUCKET_TOKENS)
+                                    ? FAULT_BUCKET_TOKENS
+                                    : (uint8_t)(buckets[i].tokens + earned);
+                buckets[i].last_refill = now;
+            }
+            return &buckets[i];
+        }
+        if (!buckets[i].in_use) {
+            oldest = &buckets[i];
+        } else if (oldest->in_use &&
+                   (int32_t)(buckets[i].last_refill - oldest->last_refill) < 0) {
+            oldest = &buckets[i];
+        }
+    }
+
+    // New code: recycle the least-recently-refilled slot with a full burst
+    oldest->code = code;
+    oldest->in_use = 1;
+    oldest->tokens = FAULT_BUCKET_TOKENS;
+    oldest->last_refill = now;
+    oldest->suppressed = 0;
+    return oldest;
+}
+
+/* ========================================================================== */
+/* PUBLIC FUNCTIONS                                                           */
+/* ========================================================================== */
+
+void FaultIntake_Init(void)
+{
+    memset(fault_queue, 0, sizeof(fault_queue));
+    memset(buckets, 0, sizeof(buckets));
+
+    Send_Debug_Data("Fault Intake: Ready (queue 16, burst 4 per code)\r\n");
+}
+
+uint8_t FaultIntake_Report(uint16_t code, uint8_t severity, float value,
+                           const char *description)
+{
+    uint32_t now = HAL_GetTick();
+    uint8_t result = 1;
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    faults_reported++;
+
+    // Coalesce onto an already-queued entry first - a storm of one code
+    // occupies one slot and one token however fast it flaps
+    fault_entry_t *queued = NULL;
+    fault_entry_t *free_slot = NULL;
+    fault_entry_t *lowest = NULL;
+    uint8_t depth = 0;
+    for (uint8_t i = 0; i < FAULT_QUEUE_SIZE; i++) {
+        if (!fault_queue[i].used) {
+            if (free_slot == NULL) free_slot = &fault_queue[i];
+            continue;
+        }
+        depth++;
+        if (fault_queue[i].code == code) queued = &fault_queue[i];
+        if (lowest == NULL || fault_queue[i].severity < lowest->severity) {
+            lowest = &fault_queue[i];
+        }
+    }
+
+    if (queued != NULL) {
+        if (queued->occurrences < 0xFFFF) queued->occurrences++;
+        queued->value = value;
+        faults_coalesced++;
+    } else {
+        fault_bucket_t *bucket = FaultIntake_GetBucket(code, now);
+        if (bucket->tokens == 0) {
+            // Rate-limited and nothing queued to fold into: count and drop
+            bucket->suppressed++;
+            faults_suppressed++;
+            result = 0;
+        } else {
+            if (free_slot == NULL) {
+                // Full queue: a critical fault preempts an informational
+                // one, never the other way around
+                if (lowest != NULL && lowest->severity < severity) {
+                    free_slot = lowest;
+                    faults_evicted++;
+                    depth--;
+                } else {
+                    faults_dropped++;
+                    result = 0;
+                }
+            }
+            if (free_slot != NULL) {
+                bucket->tokens--;
+                free_slot->code = code;
+                free_slot->severity = severity;
+                free_slot->occurrences = 1;
+                free_slot->first_tick = now;
+                free_slot->value = value;
+                free_slot->description = description;
+                free_slot->used = 1;
+                depth++;
+                if (depth > queue_high_water) queue_high_water = depth;
+            }
+        }
+    }
+
+    if (!primask) __enable_irq();
+    return result;
+}
+
+void FaultIntake_Process(void)
+{
+    char msg[128];
+
+    for (uint8_t n = 0; n < FAULT_DRAIN_BATCH; n++) {
+        // Highest severity first, oldest first within a severity
+        fault_entry_t entry;
+        fault_entry_t *best = NULL;
+
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+        for (uint8_t i = 0; i < FAULT_QUEUE_SIZE; i++) {
+            if (!fault_queue[i].used) continue;
+            if (best == NULL ||
+                fault_queue[i].severity > best->severity ||
+                (fault_queue[i].severity == best->severity &&
+                 (int32_t)(fault_queue[i].first_tick - best->first_tick) < 0)) {
+                best = &fault_queue[i];
+            }
+        }
+        if (best != NULL) {
+            entry = *best;
+            best->used = 0;
+        }
+        if (!primask) __enable_irq();
+
+        if (best == NULL) {
+            return;
+        }
+
+        // Batched fan-out: one alarm record and one debug line per
+        // entry, coalesced repeats folded in. LogAlarm's own dedup
+        // collapses the flash side further across drain passes.
+        FlashConfig_LogAlarm(entry.code, entry.severity, 1,
+                             entry.value, entry.description);
+
+        snprintf(msg, sizeof(msg),
+                 "FAULT: 0x%04X sev %u - %s (x%u)\r\n",
+                 entry.code, entry.severity,
+                 entry.description ? entry.description : "?",
+                 entry.occurrences);
+        Send_Debug_Data(msg);
+        faults_retired++;
+    }
+}
+
+void FaultIntake_PrintStatus(void)
+{
+    char msg[128];
+    uint8_t depth = 0;
+
+    for (uint8_t i = 0; i < FAULT_QUEUE_SIZE; i++) {
+        if (fault_queue[i].used) depth++;
+    }
+
+    Send_Debug_Data("\r\n=== Fault Intake ===\r\n");
+    snprintf(msg, sizeof(msg),
+             "Queue: %u pending, high water %u/%u\r\n",
+             depth, queue_high_water, FAULT_QUEUE_SIZE);
+    Send_Debug_Data(msg);
+    snprintf(msg, sizeof(msg),
+             "Reported: %lu, retired: %lu, coalesced: %lu\r\n",
+             faults_reported, faults_retired, faults_coalesced);
+    Send_Debug_Data(msg);
+    snprintf(msg, sizeof(msg),
+             "Suppressed: %lu, evicted: %lu, dropped: %lu\r\n",
+             faults_suppressed, faults_evicted, faults_dropped);
+    Send_Debug_Data(msg);
+    for (uint8_t i = 0; i < FAULT_BUCKET_SLOTS; i++) {
+        if (!buckets[i].in_use) continue;
+        snprintf(msg, sizeof(msg),
+                 "  code 0x%04X: %u token(s), %lu suppressed\r\n",
+                 buckets[i].code, buckets[i].tokens, buckets[i].suppressed);
+        Send_Debug_Data(msg);
+    }
+    Send_Debug_Data("====================\r\n\r\n");
+}
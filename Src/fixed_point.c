@@ -0,0 +1,283 @@
+/**
+ * @file    fixed_point.c
+ * @brief   Q16.16 Fixed-Point Control Kernel Implementation
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * Saturating Q16.16 arithmetic plus integer PID, low-pass filter and
+ * moving-average kernels mirroring the float versions in
+ * control_algorithms.c. Intermediate products run in 64 bits so gains
+ * and accumulators cannot wrap; every result clamps to the Q16.16
+ * range. The update kernels are placed in ITCM for deterministic
+ * single-cycle fetch on the 10 ms control tick.
+ */
+
+#include "fixed_point.h"
+#include "mem_placement.h"
+#include "profiler.h"
+#include "control_algorithms.h"
+#include "uart_comm.h"
+#include <string.h>
+
+/* Derivative filter factor, mirrors PID_DERIVATIVE_FILTER (0.1) */
+#define PIDQ16_DERIV_FILTER     Q16_FROM_FLOAT(0.1f)
+
+// ========================================================================
+// SATURATING Q16.16 ARITHMETIC
+// ========================================================================
+
+q16_t Q16_SatAdd(q16_t a, q16_t b)
+{
+    int64_t sum = (int64_t)a + (int64_t)b;
+    if (sum > Q16_MAX) return Q16_MAX;
+    if (sum < Q16_MIN) return Q16_MIN;
+    return (q16_t)sum;
+}
+
+q16_t Q16_Mul(q16_t a, q16_t b)
+{
+    int64_t product = ((int64_t)a * (int64_t)b) >> Q16_SHIFT;
+    if (product > Q16_MAX) return Q16_MAX;
+    if (product < Q16_MIN) return Q16_MIN;
+    return (q16_t)product;
+}
+
+q16_t Q16_Div(q16_t a, q16_t b)
+{
+    if (b == 0) return (a >= 0) ? Q16_MAX : Q16_MIN;
+
+    int64_t quotient = ((int64_t)a << Q16_SHIFT) / (int64_t)b;
+    if (quotient > Q16_MAX) return Q16_MAX;
+    if (quotient < Q16_MIN) return Q16_MIN;
+    return (q16_t)quotient;
+}
+
+// ========================================================================
+// FIXED-POINT PID CONTROLLER
+// ========================================================================
+
+void PIDQ16_Init(PIDQ16_t* pid, float kp, float ki, float kd)
+{
+    if (pid == NULL) return;
+
+    pid->kp = Q16_FROM_FLOAT(kp);
+    pid->ki = Q16_FROM_FLOAT(ki);
+    pid->kd = Q16_FROM_FLOAT(kd);
+    pid->integral = 0;
+    pid->previous_error = 0;
+    pid->derivative = 0;
+    pid->output = 0;
+    pid->output_min = Q16_FROM_FLOAT(PID_OUTPUT_MIN);
+    pid->output_max = Q16_FROM_FLOAT(PID_OUTPUT_MAX);
+    pid->last_update_time = HAL_GetTick();
+}
+
+void PIDQ16_SetOutputLimits(PIDQ16_t* pid, float min, float max)
+{
+    if (pid == NULL || min >= max) return;
+
+    pid->output_min = Q16_FROM_FLOAT(min);
+    pid->output_max = Q16_FROM_FLOAT(max);
+}
+
+void PIDQ16_Reset(PIDQ16_t* pid)
+{
+    if (pid == NULL) return;
+
+    pid->integral = 0;
+    pid->previous_error = 0;
+    pid->derivative = 0;
+    pid->output = 0;
+    pid->last_update_time = HAL_GetTick();
+}
+
+ITCM_FUNC q16_t PIDQ16_Update(PIDQ16_t* pid, q16_t process_value, q16_t setpoint)
+{
+    uint32_t current_time = HAL_GetTick();
+    uint32_t dt_ms = current_time - pid->last_update_time;
+
+    if (dt_ms == 0) return pid->output;     // Same tick - keep last output
+
+    // dt in seconds: dt_ms * (65536 / 1000), exact in 64-bit intermediate
+    q16_t dt = (q16_t)(((int64_t)dt_ms << Q16_SHIFT) / 1000);
+
+    q16_t error = Q16_SatAdd(setpoint, -process_value);
+
+    // Proportional term
+    q16_t proportional = Q16_Mul(pid->kp, error);
+
+    // Integral term with windup protection (same clamp as the float path)
+    pid->integral = Q16_SatAdd(pid->integral, Q16_Mul(error, dt));
+
+    if (pid->ki != 0) {
+        q16_t max_integral = Q16_Div(Q16_SatAdd(pid->output_max, -proportional), pid->ki);
+        q16_t min_integral = Q16_Div(Q16_SatAdd(pid->output_min, -proportional), pid->ki);
+
+        if (pid->integral > max_integral) pid->integral = max_integral;
+        if (pid->integral < min_integral) pid->integral = min_integral;
+    }
+
+    q16_t integral = Q16_Mul(pid->ki, pid->integral);
+
+    // Derivative term with filtering
+    q16_t derivative_raw = Q16_Div(Q16_SatAdd(error, -pid->previous_error), dt);
+    pid->derivative = Q16_SatAdd(
+        Q16_Mul(pid->derivative, Q16_ONE - PIDQ16_DERIV_FILTER),
+        Q16_Mul(derivative_raw, PIDQ16_DERIV_FILTER));
+    q16_t derivative = Q16_Mul(pid->kd, pid->derivative);
+
+    // Calculate and clamp output
+    q16_t output = Q16_SatAdd(Q16_SatAdd(proportional, integral), derivative);
+    if (output > pid->output_max) output = pid->output_max;
+    if (output < pid->output_min) output = pid->output_min;
+    pid->output = output;
+
+    // Update for next iteration
+    pid->previous_error = error;
+    pid->last_update_time = current_time;
+
+    return pid->output;
+}
+
+// ========================================================================
+// FIXED-POINT FILTER AND MOVING AVERAGE
+// ========================================================================
+
+ITCM_FUNC q16_t FilterQ16_Update(q16_t* state, q16_t input, q16_t filter_factor)
+{
+    // y += factor * (x - y), single multiply per sample
+    *state = Q16_SatAdd(*state,
+                        Q16_Mul(filter_factor, Q16_SatAdd(input, -*state)));
+    return *state;
+}
+
+void MovAvgQ16_Init(MovAvgQ16_t* avg)
+{
+    if (avg == NULL) return;
+
+    memset(avg->buffer, 0, sizeof(avg->buffer));
+    avg->running_sum = 0;
+    avg->index = 0;
+    avg->count = 0;
+}
+
+ITCM_FUNC q16_t MovAvgQ16_Update(MovAvgQ16_t* avg, q16_t sample)
+{
+    // Running sum: subtract the evicted sample, add the new one - O(1)
+    avg->running_sum -= avg->buffer[avg->index];
+    avg->running_sum += sample;
+    avg->buffer[avg->index] = sample;
+    avg->index = (avg->index + 1) & 15;
+
+    if (avg->count < 16) avg->count++;
+
+    return (q16_t)(avg->running_sum / avg->count);
+}
+
+void TrendQ16_Init(TrendQ16_t* trend, uint8_t window_size)
+{
+    if (trend == NULL) return;
+
+    if (window_size < 2) window_size = 2;
+    if (window_size > TRENDQ16_MAX_WINDOW) window_size = TRENDQ16_MAX_WINDOW;
+
+    memset(trend, 0, sizeof(TrendQ16_t));
+    trend->window_size = window_size;
+}
+
+ITCM_FUNC void TrendQ16_Add(TrendQ16_t* trend, q16_t sample)
+{
+    uint8_t n = trend->window_size;
+
+    if (trend->count < n) {
+        // Ramp-up: append at x = count, extend the x-axis sums
+        trend->sum_y += sample;
+        trend->sum_xy += (int64_t)trend->count * sample;
+        trend->sum_x += trend->count;
+        trend->sum_x2 += (int32_t)trend->count * trend->count;
+        trend->count++;
+    } else {
+        // Full window: the oldest sample (x = 0) leaves, every survivor
+        // shifts one position left, the new sample enters at x = n-1
+        q16_t oldest = trend->window[trend->index];
+        trend->sum_xy -= trend->sum_y - oldest;     // x_i -> x_i - 1
+        trend->sum_y += (int64_t)sample - oldest;
+        trend->sum_xy += (int64_t)(n - 1) * sample;
+        // sum_x and sum_x2 are invariant once the window is full
+    }
+
+    trend->window[trend->index] = sample;
+    trend->index = (trend->index + 1) % trend->window_size;
+}
+
+ITCM_FUNC q16_t TrendQ16_Slope(const TrendQ16_t* trend)
+{
+    if (trend == NULL || trend->count < 2) return 0;
+
+    // Standard least-squares slope; every term is already accumulated,
+    // so this is a constant-time formula evaluation
+    int64_t n = trend->count;
+    int64_t numerator = n * trend->sum_xy - (int64_t)trend->sum_x * trend->sum_y;
+    int64_t denominator = n * trend->sum_x2 - (int64_t)trend->sum_x * trend->sum_x;
+
+    if (denominator == 0) return 0;
+
+    int64_t slope = numerator / denominator;
+    if (slope > Q16_MAX) return Q16_MAX;
+    if (slope < Q16_MIN) return Q16_MIN;
+    return (q16_t)slope;
+}
+
+// ========================================================================
+// BENCHMARK ('fxbench' CONSOLE COMMAND)
+// ========================================================================
+
+void FixedPoint_Benchmark(void)
+{
+    static uint8_t prof_float = PROFILER_INVALID_SECTION;
+    static uint8_t prof_fixed = PROFILER_INVALID_SECTION;
+
+    if (prof_float == PROFILER_INVALID_SECTION)
+        prof_float = Profiler_RegisterSection("PID_float");
+    if (prof_fixed == PROFILER_INVALID_SECTION)
+        prof_fixed = Profiler_RegisterSection("PID_q16");
+
+    PIDController_t pid_f;
+    PIDQ16_t pid_q;
+
+    PID_Init(&pid_f, 1.0f, 0.1f, 0.05f);
+    PID_Enable(&pid_f, true);
+    PIDQ16_Init(&pid_q, 1.0f, 0.1f, 0.05f);
+
+    Send_Debug_Data("FXBENCH: 1000 iterations per path...\r\n");
+
+    // Stagger the process value so neither path settles to a constant
+    for (uint16_t i = 0; i < 1000; i++) {
+        float pv = 7.0f + (float)(i & 7) * 0.25f;
+
+        Profiler_Begin(prof_float);
+        PID_Update(&pid_f, pv, 7.0f);
+        Profiler_End(prof_float);
+
+        Profiler_Begin(prof_fixed);
+        PIDQ16_Update(&pid_q, Q16_FROM_FLOAT(pv), Q16_FROM_FLOAT(7.0f));
+        Profiler_End(prof_fixed);
+
+        HAL_Delay(1);   // Advance the tick so dt is never zero
+    }
+
+    profiler_section_t sec;
+
+    if (Profiler_GetSection(prof_float, &sec) && sec.call_count > 0) {
+        Send_Debug_Formatted("FXBENCH: float PID  avg %lu cycles (min %lu, max %lu)\r\n",
+                             (uint32_t)(sec.total_cycles / sec.call_count),
+                             sec.min_cycles, sec.max_cycles);
+    }
+    if (Profiler_GetSection(prof_fixed, &sec) && sec.call_count > 0) {
+        Send_Debug_Formatted("FXBENCH: Q16.16 PID avg %lu cycles (min %lu, max %lu)\r\n",
+                             (uint32_t)(sec.total_cycles / sec.call_count),
+                             sec.min_cycles, sec.max_cycles);
+    }
+}
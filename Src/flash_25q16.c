@@ -284,6 +284,134 @@ uint8_t Flash_ReadStatusReg(void) {
     return status;
 }
 
+/**
+ * @brief Erase 4KB Sector
+ */
+uint8_t Flash_EraseSector(uint32_t address) {
+    uint8_t cmd = 0x20; // Sector Erase command (4KB)
+    uint8_t addr_bytes[3];
+
+    // Convert address to bytes
+    addr_bytes[0] = (address >> 16) & 0xFF;
+    addr_bytes[1] = (address >> 8) & 0xFF;
+    addr_bytes[2] = address & 0xFF;
+
+    // Enable write
+    if (Flash_WriteEnable() != 0) {
+        return 1;
+    }
+
+    // Select flash
+    HAL_GPIO_WritePin(FLASH_CS_PORT, FLASH_CS_PIN, GPIO_PIN_RESET);
+
+    // Send command
+    if (HAL_SPI_Transmit(&hspi2, &cmd, 1, 1000) != HAL_OK) {
+        HAL_GPIO_WritePin(FLASH_CS_PORT, FLASH_CS_PIN, GPIO_PIN_SET);
+        return 1;
+    }
+
+    // Send address
+    if (HAL_SPI_Transmit(&hspi2, addr_bytes, 3, 1000) != HAL_OK) {
+        HAL_GPIO_WritePin(FLASH_CS_PORT, FLASH_CS_PIN, GPIO_PIN_SET);
+        return 1;
+    }
+
+    // Deselect flash
+    HAL_GPIO_WritePin(FLASH_CS_PORT, FLASH_CS_PIN, GPIO_PIN_SET);
+
+    // Wait for erase to complete (typ. 45ms, max 400ms)
+    if (Flash_WaitReady() != 0) {
+        return 1;
+    }
+
+    return 0; // Success
+}
+
+/**
+ * @brief Start 4KB Sector Erase without waiting for completion
+ * @note  Caller polls Flash_ReadStatusReg() BUSY bit (erase typ. 45ms,
+ *        max 400ms) - used by the async engine in flash_async.c
+ */
+uint8_t Flash_EraseSectorStart(uint32_t address) {
+    uint8_t cmd = 0x20; // Sector Erase command (4KB)
+    uint8_t addr_bytes[3];
+
+    // Convert address to bytes
+    addr_bytes[0] = (address >> 16) & 0xFF;
+    addr_bytes[1] = (address >> 8) & 0xFF;
+    addr_bytes[2] = address & 0xFF;
+
+    // Enable write
+    if (Flash_WriteEnable() != 0) {
+        return 1;
+    }
+
+    // Select flash
+    HAL_GPIO_WritePin(FLASH_CS_PORT, FLASH_CS_PIN, GPIO_PIN_RESET);
+
+    // Send command
+    if (HAL_SPI_Transmit(&hspi2, &cmd, 1, 1000) != HAL_OK) {
+        HAL_GPIO_WritePin(FLASH_CS_PORT, FLASH_CS_PIN, GPIO_PIN_SET);
+        return 1;
+    }
+
+    // Send address
+    if (HAL_SPI_Transmit(&hspi2, addr_bytes, 3, 1000) != HAL_OK) {
+        HAL_GPIO_WritePin(FLASH_CS_PORT, FLASH_CS_PIN, GPIO_PIN_SET);
+        return 1;
+    }
+
+    // Deselect flash - erase now runs inside the chip
+    HAL_GPIO_WritePin(FLASH_CS_PORT, FLASH_CS_PIN, GPIO_PIN_SET);
+
+    return 0; // Command accepted
+}
+
+/**
+ * @brief Start Page Program without waiting for completion
+ * @note  Caller polls Flash_ReadStatusReg() BUSY bit (program typ. 0.7ms)
+ */
+uint8_t Flash_WritePageStart(uint32_t address, uint8_t *data, uint16_t length) {
+    uint8_t cmd = 0x02; // Page Program command
+    uint8_t addr_bytes[3];
+
+    // Convert address to bytes
+    addr_bytes[0] = (address >> 16) & 0xFF;
+    addr_bytes[1] = (address >> 8) & 0xFF;
+    addr_bytes[2] = address & 0xFF;
+
+    // Enable write
+    if (Flash_WriteEnable() != 0) {
+        return 1;
+    }
+
+    // Select flash
+    HAL_GPIO_WritePin(FLASH_CS_PORT, FLASH_CS_PIN, GPIO_PIN_RESET);
+
+    // Send command
+    if (HAL_SPI_Transmit(&hspi2, &cmd, 1, 1000) != HAL_OK) {
+        HAL_GPIO_WritePin(FLASH_CS_PORT, FLASH_CS_PIN, GPIO_PIN_SET);
+        return 1;
+    }
+
+    // Send address
+    if (HAL_SPI_Transmit(&hspi2, addr_bytes, 3, 1000) != HAL_OK) {
+        HAL_GPIO_WritePin(FLASH_CS_PORT, FLASH_CS_PIN, GPIO_PIN_SET);
+        return 1;
+    }
+
+    // Send data
+    if (HAL_SPI_Transmit(&hspi2, data, length, 1000) != HAL_OK) {
+        HAL_GPIO_WritePin(FLASH_CS_PORT, FLASH_CS_PIN, GPIO_PIN_SET);
+        return 1;
+    }
+
+    // Deselect flash - program now runs inside the chip
+    HAL_GPIO_WritePin(FLASH_CS_PORT, FLASH_CS_PIN, GPIO_PIN_SET);
+
+    return 0; // Command accepted
+}
+
 /**
  * @brief Write Page to Flash
  */
@@ -0,0 +1,195 @@
+/**
+ * @file    flash_async.c
+ * @brief   Background Erase/Program Engine Implementation
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ */
+
+#include "flash_async.h"
+#include "flash_25q16.h"
+#include "event_queue.h"
+#include "uart_comm.h"
+#include <string.h>
+#include <stdio.h>
+
+/* ========================================================================== */
+/* PRIVATE TYPES AND VARIABLES                                                */
+/* ========================================================================== */
+
+typedef struct {
+    uint8_t type;                           // FLASH_ASYNC_OP_*
+    uint32_t address;                       // Target flash address
+    uint16_t length;                        // Program bytes (erase: unused)
+    uint8_t data[FLASH_ASYNC_MAX_DATA];     // Staged page data
+} FlashAsyncOp_t;
+
+/* Ring of queued ops - head is the op currently in flight when busy */
+static FlashAsyncOp_t op_queue[FLASH_ASYNC_QUEUE_DEPTH];
+static uint8_t op_head = 0;
+static uint8_t op_count = 0;
+static uint8_t op_in_flight = 0;            // Head op issued to the chip
+static uint32_t op_start_tick = 0;          // For duration stats and timeout
+
+static uint8_t engine_ready = 0;
+
+/* Statistics */
+static uint32_t ops_completed = 0;
+static uint32_t ops_failed = 0;
+static uint32_t ops_rejected = 0;           // Queue-full rejections
+static uint32_t op_longest_ms = 0;
+static uint8_t queue_highwater = 0;
+
+/* ========================================================================== */
+/* PRIVATE FUNCTIONS                                                          */
+/* ========================================================================== */
+
+/**
+ * @brief Reserve the tail queue slot (NULL when full)
+ */
+static FlashAsyncOp_t* FlashAsync_AllocSlot(void)
+{
+    if (op_count >= FLASH_ASYNC_QUEUE_DEPTH) {
+        ops_rejected++;
+        return NULL;
+    }
+
+    FlashAsyncOp_t *op = &op_queue[(op_head + op_count) % FLASH_ASYNC_QUEUE_DEPTH];
+    op_count++;
+    if (op_count > queue_highwater) {
+        queue_highwater = op_count;
+    }
+    return op;
+}
+
+/**
+ * @brief Retire the head op and tell the system about it
+ */
+static void FlashAsync_CompleteHead(uint8_t failed)
+{
+    FlashAsyncOp_t *op = &op_queue[op_head];
+    uint32_t duration = HAL_GetTick() - op_start_tick;
+
+    if (duration > op_longest_ms) {
+        op_longest_ms = duration;
+    }
+    if (failed) {
+        ops_failed++;
+    } else {
+        ops_completed++;
+    }
+
+    // param = op type, value = 4KB sector number
+    EventQueue_Post(EVENT_FLASH_OP_DONE, op->type,
+                    (uint16_t)(op->address >> 12));
+
+    op_head = (op_head + 1) % FLASH_ASYNC_QUEUE_DEPTH;
+    op_count--;
+    op_in_flight = 0;
+}
+
+/* ========================================================================== */
+/* PUBLIC FUNCTIONS                                                          */
+/* ========================================================================== */
+
+void FlashAsync_Init(void)
+{
+    op_head = 0;
+    op_count = 0;
+    op_in_flight = 0;
+    engine_ready = 1;
+
+    Send_Debug_Data("Flash Async: Engine ready\r\n");
+}
+
+uint8_t FlashAsync_QueueEraseSector(uint32_t address)
+{
+    FlashAsyncOp_t *op = FlashAsync_AllocSlot();
+    if (op == NULL) {
+        return 0;
+    }
+
+    op->type = FLASH_ASYNC_OP_ERASE;
+    op->address = address;
+    op->length = 0;
+    return 1;
+}
+
+uint8_t FlashAsync_QueueWritePage(uint32_t address, const uint8_t *data, uint16_t length)
+{
+    if (data == NULL || length == 0 || length > FLASH_ASYNC_MAX_DATA) {
+        return 0;
+    }
+
+    FlashAsyncOp_t *op = FlashAsync_AllocSlot();
+    if (op == NULL) {
+        return 0;
+    }
+
+    op->type = FLASH_ASYNC_OP_WRITE;
+    op->address = address;
+    op->length = length;
+    memcpy(op->data, data, length);
+    return 1;
+}
+
+void FlashAsync_Process(void)
+{
+    if (!engine_ready || op_count == 0) {
+        return;
+    }
+
+    // Op in flight: one status register read, then back to the scheduler
+    if (op_in_flight) {
+        uint8_t status = Flash_ReadStatusReg();
+        if (status != 0xFF && (status & 0x01) == 0) {
+            FlashAsync_CompleteHead(0);             // BUSY cleared - done
+        } else if ((HAL_GetTick() - op_start_tick) > FLASH_ASYNC_OP_TIMEOUT_MS) {
+            Send_Debug_Data("Flash Async: Op timeout, dropping\r\n");
+            FlashAsync_CompleteHead(1);
+        }
+        return;
+    }
+
+    // Chip idle: issue the head op and return without waiting
+    FlashAsyncOp_t *op = &op_queue[op_head];
+    uint8_t issue_failed;
+
+    op_start_tick = HAL_GetTick();
+    if (op->type == FLASH_ASYNC_OP_ERASE) {
+        issue_failed = Flash_EraseSectorStart(op->address);
+    } else {
+        issue_failed = Flash_WritePageStart(op->address, op->data, op->length);
+    }
+
+    if (issue_failed) {
+        Send_Debug_Data("Flash Async: Command rejected by chip\r\n");
+        FlashAsync_CompleteHead(1);
+        return;
+    }
+    op_in_flight = 1;
+}
+
+uint8_t FlashAsync_IsReady(void)
+{
+    return engine_ready;
+}
+
+uint8_t FlashAsync_Pending(void)
+{
+    return op_count;
+}
+
+void FlashAsync_PrintStats(void)
+{
+    char msg[120];
+
+    Send_Debug_Data("\r\n=== Flash Async Engine ===\r\n");
+    snprintf(msg, sizeof(msg), "Pending: %u/%u (highwater %u), in flight: %u\r\n",
+             op_count, FLASH_ASYNC_QUEUE_DEPTH, queue_highwater, op_in_flight);
+    Send_Debug_Data(msg);
+    snprintf(msg, sizeof(msg), "Completed: %lu, failed: %lu, rejected: %lu, longest: %lu ms\r\n",
+             ops_completed, ops_failed, ops_rejected, op_longest_ms);
+    Send_Debug_Data(msg);
+    Send_Debug_Data("==========================\r\n\r\n");
+}
@@ -9,11 +9,14 @@
   */
 
 #include "flash_config.h"
+#include "crc_util.h"
+#include "sd_ring_log.h"
+#include "flash_journal.h"
+#include "rtc_backup.h"
 #include <stdio.h>
 #include <time.h>
 
 /* Private Constants ---------------------------------------------------------*/
-#define CONFIG_CRC32_POLYNOMIAL         0xEDB88320  // Standard CRC32 polynomial
 #define CONFIG_MAGIC_NUMBER             0xFC0NFIG   // Flash config magic number
 
 /* Private Variables ---------------------------------------------------------*/
@@ -21,6 +24,34 @@ static uint32_t last_user_save_time = 0;
 static uint32_t last_sensor_log_time = 0;
 static uint32_t last_runtime_save_time = 0;
 static uint8_t config_dirty_flag = 0;
+static uint8_t runtime_dirty_flag = 0;
+static uint8_t sensor_log_dirty_flag = 0;
+static uint32_t saves_skipped_clean = 0;    // Periodic saves elided (nothing changed)
+
+/* === Crash-consistent runtime counters ===
+ * Every counter increment appends a small delta record to the journal
+ * (a sub-millisecond page program through the async engine), so the
+ * hours a crash can lose shrink from one full save interval to the one
+ * increment that was in flight. The periodic full-block save doubles as
+ * compaction: deltas at or below its sequence number are obsolete and
+ * boot replays only the newer ones onto the base. */
+static uint32_t runtime_base_seq = 0;       // Sequence of the base record in RAM
+static uint16_t runtime_deltas_pending = 0; // Appended since the last base save
+static uint16_t runtime_deltas_replayed = 0;// Recovered onto the base at boot
+
+/* === Alarm compression and in-RAM index ===
+ * A chattering contact used to append (and flash-save) a record per
+ * bounce; now repeats within ALARM_DEDUP_WINDOW_MS fold into the last
+ * record and only dirty RAM. The index arrays give the HMI alarm pages
+ * and acknowledge paths their "latest by severity/source" answers as a
+ * table read instead of a log scan. */
+static uint8_t alarm_log_dirty_flag = 0;
+static uint32_t last_alarm_save_time = 0;
+static uint8_t last_alarm_slot = ALARM_INDEX_NONE;     // Dedup comparison target
+static uint32_t alarms_collapsed = 0;                  // Occurrences folded away
+static uint8_t alarm_latest_by_severity[ALARM_SEVERITY_SLOTS];
+static uint8_t alarm_latest_by_source[ALARM_SOURCE_SLOTS];
+static uint16_t alarm_count_by_severity[ALARM_SEVERITY_SLOTS];
 
 /* Global Flash Configuration System -----------------------------------------*/
 FlashConfigSystem_t g_flash_config = {0};
@@ -30,6 +61,9 @@ uint8_t g_flash_config_initialized = 0;
 static uint32_t FlashConfig_CRC32(const uint8_t *data, uint32_t length);
 static void FlashConfig_SetDefaults(void);
 static FlashConfig_Status_t FlashConfig_ValidateData(void);
+static void FlashConfig_AppendRuntimeDelta(uint8_t equipment_type, uint8_t equipment_id,
+                                           uint32_t delta_hours, uint16_t delta_starts);
+static void FlashConfig_ApplyRuntimeDelta(const void *data, uint16_t length, void *ctx);
 
 /* === INITIALIZATION FUNCTIONS === */
 
@@ -42,7 +76,10 @@ FlashConfig_Status_t FlashConfig_Init(void)
     
     // Initialize flash configuration system
     memset(&g_flash_config, 0, sizeof(FlashConfigSystem_t));
-    
+
+    // Mount the wear-leveled config journal (recovers append position)
+    FJournal_Init();
+
     // Try to load existing configuration from flash
     FlashConfig_Status_t status = FlashConfig_LoadFromFlash();
     
@@ -58,6 +95,10 @@ FlashConfig_Status_t FlashConfig_Init(void)
         }
     }
     
+    // Reconcile runtime counters with the battery-backed RTC registers
+    // (they are ahead of flash if power was cut between commits)
+    RTCBackup_Init();
+
     // Check SD card availability
     g_flash_config.sd_available = (SD_Card_Get_Status() == SD_CARD_OK) ? 1 : 0;
     
@@ -77,26 +118,37 @@ FlashConfig_Status_t FlashConfig_Init(void)
 FlashConfig_Status_t FlashConfig_LoadFromFlash(void)
 {
     uint8_t flash_data[sizeof(UserConfig_t)];
-    
-    // Load user configuration
-    if (Flash_ReadData(FLASH_USER_CONFIG_ADDR, flash_data, sizeof(UserConfig_t)) != 0) {
-        return FLASH_CONFIG_ERROR;
+    uint8_t from_journal = 1;
+
+    // Load newest journaled user configuration (the journal CRC-verifies
+    // the exact bytes it hands back and falls back to the next-newest
+    // valid record on a torn save); fall back to the legacy fixed
+    // address only for units fielded before the journal existed
+    if (FJournal_ReadLatest(FJOURNAL_STREAM_USER_CONFIG, flash_data,
+                            sizeof(UserConfig_t)) != FJOURNAL_OK) {
+        if (Flash_ReadData(FLASH_USER_CONFIG_ADDR, flash_data, sizeof(UserConfig_t)) != 0) {
+            return FLASH_CONFIG_ERROR;
+        }
+        from_journal = 0;
     }
-    
+
     // Copy and validate user config
     memcpy(&g_flash_config.user_config, flash_data, sizeof(UserConfig_t));
-    
+
     if (g_flash_config.user_config.version != FLASH_CONFIG_VERSION) {
         return FLASH_CONFIG_CORRUPTED;
     }
-    
-    // Validate CRC
-    uint32_t calculated_crc = FlashConfig_CRC32((uint8_t*)&g_flash_config.user_config, 
-                                              sizeof(UserConfig_t) - sizeof(uint32_t));
-    if (calculated_crc != g_flash_config.user_config.crc32) {
-        return FLASH_CONFIG_CORRUPTED;
+
+    // Validate CRC - only needed for the legacy path; the journal read
+    // already verified these bytes, so boot does one read, one CRC
+    if (!from_journal) {
+        uint32_t calculated_crc = FlashConfig_CRC32((uint8_t*)&g_flash_config.user_config,
+                                                  sizeof(UserConfig_t) - sizeof(uint32_t));
+        if (calculated_crc != g_flash_config.user_config.crc32) {
+            return FLASH_CONFIG_CORRUPTED;
+        }
     }
-    
+
     // Load runtime data
     FlashConfig_LoadRuntimeData();
     
@@ -128,14 +180,25 @@ FlashConfig_Status_t FlashConfig_InitializeDefaults(void)
  */
 FlashConfig_Status_t FlashConfig_SaveUserConfig(void)
 {
+    // Validate the RAM copy before committing - a scribbled image must
+    // never be persisted over the good records already in the journal
+    if (g_flash_config.user_config.version != FLASH_CONFIG_VERSION ||
+        g_flash_config.user_config.supply_setpoint <
+        g_flash_config.user_config.min_supply_temp - 50.0f ||
+        g_flash_config.user_config.supply_setpoint >
+        g_flash_config.user_config.max_supply_temp + 50.0f) {
+        Send_Debug_Data("Flash Config: Save rejected - RAM copy failed validation\r\n");
+        return FLASH_CONFIG_CORRUPTED;
+    }
+
     // Update timestamp and CRC
     g_flash_config.user_config.timestamp = HAL_GetTick();
     g_flash_config.user_config.crc32 = FlashConfig_CRC32((uint8_t*)&g_flash_config.user_config,
                                                         sizeof(UserConfig_t) - sizeof(uint32_t));
     
-    // Write to flash
-    if (Flash_WritePage(FLASH_USER_CONFIG_ADDR, (uint8_t*)&g_flash_config.user_config,
-                       sizeof(UserConfig_t)) != 0) {
+    // Append to the wear-leveled journal (single page program)
+    if (FJournal_Append(FJOURNAL_STREAM_USER_CONFIG, &g_flash_config.user_config,
+                        sizeof(UserConfig_t)) != FJOURNAL_OK) {
         return FLASH_CONFIG_ERROR;
     }
     
@@ -223,14 +286,20 @@ FlashConfig_Status_t FlashConfig_SaveRuntimeData(void)
     g_flash_config.runtime_data.crc32 = FlashConfig_CRC32((uint8_t*)&g_flash_config.runtime_data,
                                                          sizeof(RuntimeData_t) - sizeof(uint32_t));
     
-    // Write to flash
-    if (Flash_WritePage(FLASH_RUNTIME_DATA_ADDR, (uint8_t*)&g_flash_config.runtime_data,
-                       sizeof(RuntimeData_t)) != 0) {
+    // Append to the wear-leveled journal (single page program)
+    if (FJournal_Append(FJOURNAL_STREAM_RUNTIME_DATA, &g_flash_config.runtime_data,
+                        sizeof(RuntimeData_t)) != FJOURNAL_OK) {
         return FLASH_CONFIG_ERROR;
     }
-    
+
+    // The full block is the compaction point: the RAM copy already
+    // contains every delta appended so far, so records at or below this
+    // sequence are dead weight and boot replay starts above it
+    runtime_base_seq = FJournal_GetLatestSequence(FJOURNAL_STREAM_RUNTIME_DATA);
+    runtime_deltas_pending = 0;
+
     last_runtime_save_time = HAL_GetTick();
-    
+
     Send_Debug_Data("Flash Config: Runtime data saved\r\n");
     return FLASH_CONFIG_OK;
 }
@@ -241,27 +310,109 @@ FlashConfig_Status_t FlashConfig_SaveRuntimeData(void)
 FlashConfig_Status_t FlashConfig_LoadRuntimeData(void)
 {
     uint8_t flash_data[sizeof(RuntimeData_t)];
-    
-    if (Flash_ReadData(FLASH_RUNTIME_DATA_ADDR, flash_data, sizeof(RuntimeData_t)) != 0) {
-        return FLASH_CONFIG_ERROR;
+    uint8_t from_journal = 1;
+
+    // Newest journaled record wins; legacy fixed address is the fallback
+    if (FJournal_ReadLatest(FJOURNAL_STREAM_RUNTIME_DATA, flash_data,
+                            sizeof(RuntimeData_t)) != FJOURNAL_OK) {
+        if (Flash_ReadData(FLASH_RUNTIME_DATA_ADDR, flash_data, sizeof(RuntimeData_t)) != 0) {
+            return FLASH_CONFIG_ERROR;
+        }
+        from_journal = 0;
     }
-    
+
     memcpy(&g_flash_config.runtime_data, flash_data, sizeof(RuntimeData_t));
-    
+
     // Validate version and CRC
     if (g_flash_config.runtime_data.version != FLASH_CONFIG_VERSION) {
         return FLASH_CONFIG_CORRUPTED;
     }
-    
+
     uint32_t calculated_crc = FlashConfig_CRC32((uint8_t*)&g_flash_config.runtime_data,
                                               sizeof(RuntimeData_t) - sizeof(uint32_t));
     if (calculated_crc != g_flash_config.runtime_data.crc32) {
         return FLASH_CONFIG_CORRUPTED;
     }
-    
+
+    // Fold every delta appended after this base back into the counters.
+    // A legacy fixed-address block predates the journal, so any journaled
+    // delta is newer than it and replays from sequence zero
+    runtime_base_seq = from_journal
+                       ? FJournal_GetLatestSequence(FJOURNAL_STREAM_RUNTIME_DATA) : 0;
+    runtime_deltas_replayed = FJournal_ReplayStream(FJOURNAL_STREAM_RUNTIME_DELTA,
+                                                    runtime_base_seq,
+                                                    FlashConfig_ApplyRuntimeDelta, NULL);
+    runtime_deltas_pending = runtime_deltas_replayed;
+    if (runtime_deltas_replayed > 0) {
+        char msg[80];
+        snprintf(msg, sizeof(msg), "Flash Config: Replayed %u runtime delta(s)\r\n",
+                 runtime_deltas_replayed);
+        Send_Debug_Data(msg);
+        runtime_dirty_flag = 1;     // Counters are ahead of the stored base
+    }
+
     return FLASH_CONFIG_OK;
 }
 
+/**
+ * @brief Apply one replayed delta record onto the runtime counters
+ */
+static void FlashConfig_ApplyRuntimeDelta(const void *data, uint16_t length, void *ctx)
+{
+    const RuntimeDelta_t *delta = (const RuntimeDelta_t*)data;
+    (void)ctx;
+
+    if (length != sizeof(RuntimeDelta_t)) {
+        return;     // Record from a different firmware revision - skip
+    }
+
+    if (delta->equipment_type == RUNTIME_DELTA_COMPRESSOR &&
+        delta->equipment_id < MAX_COMPRESSORS) {
+        g_flash_config.runtime_data.compressor_hours[delta->equipment_id] += delta->delta_hours;
+        g_flash_config.runtime_data.compressor_starts[delta->equipment_id] += delta->delta_starts;
+    } else if (delta->equipment_type == RUNTIME_DELTA_CONDENSER &&
+               delta->equipment_id < MAX_CONDENSER_BANKS) {
+        g_flash_config.runtime_data.condenser_hours[delta->equipment_id] += delta->delta_hours;
+        g_flash_config.runtime_data.condenser_starts[delta->equipment_id] += delta->delta_starts;
+    } else if (delta->equipment_type != RUNTIME_DELTA_SYSTEM) {
+        return;
+    }
+
+    // Equipment increments carry into the system totals, mirroring the
+    // live update paths; system-tick deltas touch only the totals
+    g_flash_config.runtime_data.system_total_hours += delta->delta_hours;
+    g_flash_config.runtime_data.system_start_count += delta->delta_starts;
+}
+
+/**
+ * @brief Append one counter increment to the journal delta stream
+ *
+ * Called on the update paths after the RAM counters change. When enough
+ * deltas pile up to risk the journal's rotation erasing un-compacted
+ * ones, a full base save is forced to fold them in.
+ */
+static void FlashConfig_AppendRuntimeDelta(uint8_t equipment_type, uint8_t equipment_id,
+                                           uint32_t delta_hours, uint16_t delta_starts)
+{
+    RuntimeDelta_t delta;
+
+    delta.equipment_type = equipment_type;
+    delta.equipment_id = equipment_id;
+    delta.delta_starts = delta_starts;
+    delta.delta_hours = delta_hours;
+
+    if (FJournal_Append(FJOURNAL_STREAM_RUNTIME_DELTA, &delta,
+                        sizeof(delta)) != FJOURNAL_OK) {
+        return;     // RAM copy and RTC backup still carry the increment
+    }
+    runtime_deltas_pending++;
+
+    if (runtime_deltas_pending >= RUNTIME_DELTA_COMPACT_COUNT) {
+        FlashConfig_SaveRuntimeData();
+        runtime_dirty_flag = 0;
+    }
+}
+
 /**
  * @brief Update Equipment Runtime Hours
  */
@@ -278,6 +429,9 @@ FlashConfig_Status_t FlashConfig_UpdateEquipmentHours(uint8_t equipment_type, ui
     }
     
     g_flash_config.runtime_data.system_total_hours += additional_hours;
+    runtime_dirty_flag = 1;
+    RTCBackup_Sync();       // Register writes - survives a power cut
+    FlashConfig_AppendRuntimeDelta(equipment_type, equipment_id, additional_hours, 0);
     return FLASH_CONFIG_OK;
 }
 
@@ -297,6 +451,9 @@ FlashConfig_Status_t FlashConfig_IncrementStartCount(uint8_t equipment_type, uin
     }
     
     g_flash_config.runtime_data.system_start_count++;
+    runtime_dirty_flag = 1;
+    RTCBackup_Sync();       // Register writes - survives a power cut
+    FlashConfig_AppendRuntimeDelta(equipment_type, equipment_id, 0, 1);
     return FLASH_CONFIG_OK;
 }
 
@@ -354,55 +511,179 @@ FlashConfig_Status_t FlashConfig_LogSensorData(float supply_temp, float return_t
     if (g_flash_config.sensor_log_count < MAX_SENSOR_LOG_ENTRIES) {
         g_flash_config.sensor_log_count++;
     }
-    
+    sensor_log_dirty_flag = 1;
+
+    // Mirror to the SD ring log for long-term history
+    if (SDLog_IsReady()) {
+        SDLog_AppendSensor(entry);
+    }
+
     return FLASH_CONFIG_OK;
 }
 
+/**
+ * @brief Put one log slot into the severity/source index
+ */
+static void FlashConfig_IndexAlarmSlot(uint8_t slot)
+{
+    const AlarmLogEntry_t *entry = &g_flash_config.alarm_logs[slot];
+
+    if (entry->alarm_severity < ALARM_SEVERITY_SLOTS) {
+        alarm_latest_by_severity[entry->alarm_severity] = slot;
+        alarm_count_by_severity[entry->alarm_severity]++;
+    }
+    if (entry->alarm_source < ALARM_SOURCE_SLOTS) {
+        alarm_latest_by_source[entry->alarm_source] = slot;
+    }
+}
+
 /**
  * @brief Log Alarm Event
+ *
+ * Repeats of the last alarm (same code, severity and source) within
+ * ALARM_DEDUP_WINDOW_MS collapse into the existing record - a
+ * chattering pressure switch bumps a counter in RAM instead of
+ * appending and flash-saving per bounce. Only a genuinely new record
+ * still writes flash immediately; collapsed updates are flushed from
+ * FlashConfig_CheckSaveIntervals().
  */
 FlashConfig_Status_t FlashConfig_LogAlarm(uint16_t alarm_code, uint8_t severity, uint8_t source,
                                          float trigger_value, const char *description)
 {
+    // Run-length collapse against the most recent record
+    if (last_alarm_slot != ALARM_INDEX_NONE) {
+        AlarmLogEntry_t *last = &g_flash_config.alarm_logs[last_alarm_slot];
+        if (last->alarm_code == alarm_code &&
+            last->alarm_severity == severity &&
+            last->alarm_source == source &&
+            (HAL_GetTick() - last->last_timestamp) <= ALARM_DEDUP_WINDOW_MS) {
+            last->last_timestamp = HAL_GetTick();
+            last->trigger_value = trigger_value;
+            if (last->repeat_count < 0xFFFF) {
+                last->repeat_count++;
+            }
+            alarms_collapsed++;
+            g_flash_config.runtime_data.alarm_count++;
+            runtime_dirty_flag = 1;
+            alarm_log_dirty_flag = 1;
+            return FLASH_CONFIG_OK;
+        }
+    }
+
     // Check if buffer is full
+    uint8_t overwriting = 0;
     if (g_flash_config.alarm_log_count >= MAX_ALARM_LOG_ENTRIES) {
         // Overwrite oldest entry (circular buffer)
         g_flash_config.alarm_log_index = 0;
         g_flash_config.alarm_log_count = MAX_ALARM_LOG_ENTRIES;
+        overwriting = 1;
     }
-    
+
     // Create new alarm entry
     AlarmLogEntry_t *entry = &g_flash_config.alarm_logs[g_flash_config.alarm_log_index];
     entry->timestamp = HAL_GetTick();
+    entry->last_timestamp = entry->timestamp;
+    entry->repeat_count = 1;
     entry->alarm_code = alarm_code;
     entry->alarm_severity = severity;
     entry->alarm_source = source;
     entry->trigger_value = trigger_value;
-    
+
     // Copy description safely
     strncpy(entry->alarm_description, description, sizeof(entry->alarm_description) - 1);
     entry->alarm_description[sizeof(entry->alarm_description) - 1] = '\0';
-    
+
+    // Maintain the severity/source index: an overwritten slot may be
+    // referenced anywhere, so a wrap rebuilds; the common append is O(1)
+    last_alarm_slot = (uint8_t)g_flash_config.alarm_log_index;
+    if (overwriting) {
+        FlashConfig_RebuildAlarmIndex();
+    } else {
+        FlashConfig_IndexAlarmSlot(last_alarm_slot);
+    }
+
     // Update counters
     g_flash_config.alarm_log_index++;
     if (g_flash_config.alarm_log_count < MAX_ALARM_LOG_ENTRIES) {
         g_flash_config.alarm_log_count++;
     }
-    
+
     // Increment alarm counter in runtime data
     g_flash_config.runtime_data.alarm_count++;
-    
+    runtime_dirty_flag = 1;
+
+    // Mirror to the SD ring log for long-term history
+    if (SDLog_IsReady()) {
+        SDLog_AppendAlarm(entry);
+    }
+
     // Save alarm log immediately (critical data)
     FlashConfig_SaveAlarmLogs();
-    
+    alarm_log_dirty_flag = 0;
+    last_alarm_save_time = HAL_GetTick();
+
     char msg[100];
     snprintf(msg, sizeof(msg), "Flash Config: Alarm logged - Code: %u, Severity: %u\r\n",
              alarm_code, severity);
     Send_Debug_Data(msg);
-    
+
     return FLASH_CONFIG_OK;
 }
 
+/**
+ * @brief Rebuild the severity/source index from the log buffer
+ */
+void FlashConfig_RebuildAlarmIndex(void)
+{
+    memset(alarm_latest_by_severity, ALARM_INDEX_NONE, sizeof(alarm_latest_by_severity));
+    memset(alarm_latest_by_source, ALARM_INDEX_NONE, sizeof(alarm_latest_by_source));
+    memset(alarm_count_by_severity, 0, sizeof(alarm_count_by_severity));
+
+    // Walk oldest-to-newest so "latest" slots win naturally
+    uint16_t count = g_flash_config.alarm_log_count;
+    uint16_t start = (count >= MAX_ALARM_LOG_ENTRIES) ? g_flash_config.alarm_log_index : 0;
+
+    for (uint16_t n = 0; n < count; n++) {
+        FlashConfig_IndexAlarmSlot((uint8_t)((start + n) % MAX_ALARM_LOG_ENTRIES));
+    }
+}
+
+/**
+ * @brief Latest logged alarm of a given severity - O(1) table read
+ * @return Entry pointer, NULL if none logged at that severity
+ */
+const AlarmLogEntry_t* FlashConfig_GetLatestAlarmBySeverity(uint8_t severity)
+{
+    if (severity >= ALARM_SEVERITY_SLOTS ||
+        alarm_latest_by_severity[severity] == ALARM_INDEX_NONE) {
+        return NULL;
+    }
+    return &g_flash_config.alarm_logs[alarm_latest_by_severity[severity]];
+}
+
+/**
+ * @brief Latest logged alarm from a given source - O(1) table read
+ * @return Entry pointer, NULL if none logged from that source
+ */
+const AlarmLogEntry_t* FlashConfig_GetLatestAlarmBySource(uint8_t source)
+{
+    if (source >= ALARM_SOURCE_SLOTS ||
+        alarm_latest_by_source[source] == ALARM_INDEX_NONE) {
+        return NULL;
+    }
+    return &g_flash_config.alarm_logs[alarm_latest_by_source[source]];
+}
+
+/**
+ * @brief Logged record count at a given severity (collapsed records
+ *        count once - see repeat_count for occurrences)
+ */
+uint16_t FlashConfig_GetAlarmCountBySeverity(uint8_t severity)
+{
+    if (severity >= ALARM_SEVERITY_SLOTS) return 0;
+    return alarm_count_by_severity[severity];
+}
+
 /* === PERIODIC PROCESSING FUNCTIONS === */
 
 /**
@@ -419,6 +700,21 @@ void FlashConfig_ProcessPeriodicTasks(void)
     if (HAL_GetTick() - last_hour_update >= 3600000) {
         last_hour_update = HAL_GetTick();
         g_flash_config.runtime_data.system_total_hours++;
+        runtime_dirty_flag = 1;
+        FlashConfig_AppendRuntimeDelta(RUNTIME_DELTA_SYSTEM, 0, 1, 0);
+    }
+
+    // Mirror live counters into the backup domain once a minute; flash
+    // only gets a commit every 8 hours of accumulated accounting
+    static uint32_t last_minute_sync = 0;
+    if (HAL_GetTick() - last_minute_sync >= 60000) {
+        last_minute_sync = HAL_GetTick();
+        RTCBackup_Sync();
+        if (RTCBackup_MinuteTick() >= RTC_BACKUP_COMMIT_MINUTES && runtime_dirty_flag) {
+            FlashConfig_SaveRuntimeData();
+            runtime_dirty_flag = 0;
+            RTCBackup_MarkCommitted();
+        }
     }
 }
 
@@ -436,15 +732,38 @@ void FlashConfig_CheckSaveIntervals(void)
         config_dirty_flag = 0;
     }
     
-    // Check sensor log save interval
+    // Check sensor log save interval - skip the write entirely when clean
     if ((current_time - last_sensor_log_time) >= g_flash_config.user_config.sensor_log_interval) {
         last_sensor_log_time = current_time;
-        FlashConfig_SaveSensorLogs();
+        if (sensor_log_dirty_flag) {
+            FlashConfig_SaveSensorLogs();
+            sensor_log_dirty_flag = 0;
+        } else {
+            saves_skipped_clean++;
+        }
     }
-    
-    // Check runtime data save interval
-    if ((current_time - last_runtime_save_time) >= g_flash_config.user_config.runtime_save_interval) {
-        FlashConfig_SaveRuntimeData();
+
+    // Alarm log: collapsed repeats only dirty RAM, so a fault storm
+    // costs at most one flash write per DEFAULT_ALARM_SAVE_INTERVAL
+    if (alarm_log_dirty_flag &&
+        (current_time - last_alarm_save_time) >= DEFAULT_ALARM_SAVE_INTERVAL) {
+        FlashConfig_SaveAlarmLogs();
+        alarm_log_dirty_flag = 0;
+        last_alarm_save_time = current_time;
+    }
+
+    // Runtime data: when the backup domain carries the live counters the
+    // 8-hour commit in FlashConfig_ProcessPeriodicTasks() replaces this
+    // interval save; the legacy path remains for boards without VBAT
+    if (!RTCBackup_IsAvailable() &&
+        (current_time - last_runtime_save_time) >= g_flash_config.user_config.runtime_save_interval) {
+        if (runtime_dirty_flag) {
+            FlashConfig_SaveRuntimeData();
+            runtime_dirty_flag = 0;
+        } else {
+            last_runtime_save_time = current_time;
+            saves_skipped_clean++;
+        }
     }
 }
 
@@ -469,6 +788,22 @@ void FlashConfig_DisplayStatus(void)
              g_flash_config.sensor_log_count,
              g_flash_config.alarm_log_count);
     Send_Debug_Data(msg);
+
+    snprintf(msg, sizeof(msg), "Dirty: config %u, runtime %u, sensor %u - skipped clean saves: %lu\r\n",
+             config_dirty_flag, runtime_dirty_flag, sensor_log_dirty_flag,
+             saves_skipped_clean);
+    Send_Debug_Data(msg);
+
+    snprintf(msg, sizeof(msg), "Runtime deltas: %u pending (base seq %lu), %u replayed at boot\r\n",
+             runtime_deltas_pending, runtime_base_seq, runtime_deltas_replayed);
+    Send_Debug_Data(msg);
+
+    snprintf(msg, sizeof(msg), "Alarm repeats collapsed: %lu (by severity: %u/%u/%u/%u/%u/%u)\r\n",
+             alarms_collapsed,
+             alarm_count_by_severity[0], alarm_count_by_severity[1],
+             alarm_count_by_severity[2], alarm_count_by_severity[3],
+             alarm_count_by_severity[4], alarm_count_by_severity[5]);
+    Send_Debug_Data(msg);
     
     snprintf(msg, sizeof(msg), "User Config: Supply %.1f°C, Return %.1f°C\r\n",
              g_flash_config.user_config.supply_setpoint,
@@ -485,20 +820,8 @@ void FlashConfig_DisplayStatus(void)
  */
 static uint32_t FlashConfig_CRC32(const uint8_t *data, uint32_t length)
 {
-    uint32_t crc = 0xFFFFFFFF;
-    
-    for (uint32_t i = 0; i < length; i++) {
-        crc ^= data[i];
-        for (int j = 0; j < 8; j++) {
-            if (crc & 1) {
-                crc = (crc >> 1) ^ CONFIG_CRC32_POLYNOMIAL;
-            } else {
-                crc >>= 1;
-            }
-        }
-    }
-    
-    return ~crc;
+    // Shared kernel - hardware CRC unit when available, table-driven otherwise
+    return CRC32_Calculate(data, length);
 }
 
 /**
@@ -543,6 +866,8 @@ static void FlashConfig_SetDefaults(void)
     g_flash_config.sensor_log_index = 0;
     g_flash_config.alarm_log_count = 0;
     g_flash_config.alarm_log_index = 0;
+    last_alarm_slot = ALARM_INDEX_NONE;
+    FlashConfig_RebuildAlarmIndex();
 }
 
 /* === SAVE FUNCTIONS FOR LOGS === */
@@ -595,7 +920,8 @@ FlashConfig_Status_t FlashConfig_LoadAlarmLogs(void)
                       sizeof(g_flash_config.alarm_logs)) != 0) {
         return FLASH_CONFIG_ERROR;
     }
-    
+
+    FlashConfig_RebuildAlarmIndex();
     return FLASH_CONFIG_OK;
 }
 
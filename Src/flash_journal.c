@@ -0,0 +1,407 @@
+/**
+ * @file    flash_journal.c
+ * @brief   Wear-Leveled Config Journal Implementation
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ */
+
+#include "flash_journal.h"
+#include "flash_25q16.h"
+#include "flash_async.h"
+#include "crc_util.h"
+#include "uart_comm.h"
+#include <string.h>
+#include <stdio.h>
+
+/* ========================================================================== */
+/* PRIVATE CONSTANTS                                                          */
+/* ========================================================================== */
+
+#define FJOURNAL_PAGES_PER_SECTOR   (FJOURNAL_SECTOR_SIZE / FJOURNAL_PAGE_SIZE)
+#define FJOURNAL_STREAM_COUNT       3
+#define FJOURNAL_NO_PAGE            0xFFFF
+
+/* ========================================================================== */
+/* PRIVATE VARIABLES                                                          */
+/* ========================================================================== */
+
+static uint16_t fjournal_next_page = 0;     // Next page slot to program
+static uint32_t fjournal_sequence = 0;      // Last sequence number used
+
+/* Newest valid record location per stream (index = stream - 1) */
+static uint16_t fjournal_latest_page[FJOURNAL_STREAM_COUNT];
+static uint32_t fjournal_latest_seq[FJOURNAL_STREAM_COUNT];
+
+static uint32_t fjournal_appends = 0;
+static uint32_t fjournal_erases = 0;
+static uint32_t fjournal_fallbacks = 0;     // Reads served by an older record
+
+/* ========================================================================== */
+/* PRIVATE FUNCTIONS                                                          */
+/* ========================================================================== */
+
+/**
+ * @brief Flash address of a journal page slot
+ */
+static uint32_t FJournal_PageAddr(uint16_t page)
+{
+    return FJOURNAL_BASE_ADDR + (uint32_t)page * FJOURNAL_PAGE_SIZE;
+}
+
+/**
+ * @brief Basic header sanity check (magic, stream, length)
+ */
+static uint8_t FJournal_HeaderValid(const FJournal_Header_t *hdr)
+{
+    if (hdr->magic != FJOURNAL_MAGIC) return 0;
+    if (hdr->stream < FJOURNAL_STREAM_USER_CONFIG ||
+        hdr->stream > FJOURNAL_STREAM_RUNTIME_DELTA) return 0;
+    if (hdr->length == 0 || hdr->length > FJOURNAL_MAX_PAYLOAD) return 0;
+    return 1;
+}
+
+/**
+ * @brief Submit one page program, through the async engine when it runs
+ *
+ * The engine executes ops strictly in queue order, so a program queued
+ * after the rotation erase lands in an already-blank sector. When the
+ * queue is momentarily full it is pumped in place instead of bypassed -
+ * bypassing would reorder a program ahead of its erase. Before the
+ * scheduler is up (boot-time appends) the path is plain blocking.
+ */
+static FJournal_Status_t FJournal_SubmitWrite(uint32_t address, uint8_t *page_buf)
+{
+    if (!FlashAsync_IsReady()) {
+        return (Flash_WritePage(address, page_buf, FJOURNAL_PAGE_SIZE) == 0)
+               ? FJOURNAL_OK : FJOURNAL_ERROR;
+    }
+
+    while (!FlashAsync_QueueWritePage(address, page_buf, FJOURNAL_PAGE_SIZE)) {
+        FlashAsync_Process();   // Rare burst: drain one op, retry
+    }
+    return FJOURNAL_OK;
+}
+
+/**
+ * @brief Submit one sector erase (same ordering rules as SubmitWrite)
+ */
+static FJournal_Status_t FJournal_SubmitErase(uint32_t address)
+{
+    if (!FlashAsync_IsReady()) {
+        return (Flash_EraseSector(address) == 0) ? FJOURNAL_OK : FJOURNAL_ERROR;
+    }
+
+    while (!FlashAsync_QueueEraseSector(address)) {
+        FlashAsync_Process();
+    }
+    return FJOURNAL_OK;
+}
+
+/**
+ * @brief Program one record into the given page slot
+ */
+static FJournal_Status_t FJournal_WriteRecord(uint16_t page, uint8_t stream,
+                                              const void *data, uint16_t length)
+{
+    uint8_t page_buf[FJOURNAL_PAGE_SIZE];
+    FJournal_Header_t *hdr = (FJournal_Header_t*)page_buf;
+
+    memset(page_buf, 0xFF, sizeof(page_buf));
+    hdr->magic = FJOURNAL_MAGIC;
+    hdr->stream = stream;
+    hdr->reserved = 0xFF;
+    hdr->sequence = ++fjournal_sequence;
+    hdr->length = length;
+    hdr->pad = 0xFFFF;
+    hdr->crc32 = CRC32_Calculate((const uint8_t*)data, length);
+    memcpy(&page_buf[FJOURNAL_HEADER_SIZE], data, length);
+
+    if (FJournal_SubmitWrite(FJournal_PageAddr(page), page_buf) != FJOURNAL_OK) {
+        return FJOURNAL_ERROR;
+    }
+
+    // Bookkeeping tracks the queued state; until the engine retires the
+    // program, a read of this record sees blank flash and the fallback
+    // path in FJournal_ReadLatest serves the previous valid one
+    fjournal_latest_page[stream - 1] = page;
+    fjournal_latest_seq[stream - 1] = fjournal_sequence;
+    fjournal_appends++;
+    return FJOURNAL_OK;
+}
+
+/* ========================================================================== */
+/* PUBLIC FUNCTIONS                                                          */
+/* ========================================================================== */
+
+FJournal_Status_t FJournal_Init(void)
+{
+    FJournal_Header_t hdr;
+    uint32_t best_seq = 0;
+    uint16_t best_page = FJOURNAL_NO_PAGE;
+
+    fjournal_sequence = 0;
+    fjournal_next_page = 0;
+    for (uint8_t s = 0; s < FJOURNAL_STREAM_COUNT; s++) {
+        fjournal_latest_page[s] = FJOURNAL_NO_PAGE;
+        fjournal_latest_seq[s] = 0;
+    }
+
+    // One header read per page slot - newest sequence number wins
+    for (uint16_t page = 0; page < FJOURNAL_TOTAL_PAGES; page++) {
+        if (Flash_ReadData(FJournal_PageAddr(page), (uint8_t*)&hdr,
+                           sizeof(hdr)) != 0) {
+            return FJOURNAL_ERROR;
+        }
+        if (!FJournal_HeaderValid(&hdr)) {
+            continue;
+        }
+        if (hdr.sequence > fjournal_latest_seq[hdr.stream - 1]) {
+            fjournal_latest_seq[hdr.stream - 1] = hdr.sequence;
+            fjournal_latest_page[hdr.stream - 1] = page;
+        }
+        if (hdr.sequence > best_seq) {
+            best_seq = hdr.sequence;
+            best_page = page;
+        }
+    }
+
+    if (best_page != FJOURNAL_NO_PAGE) {
+        fjournal_sequence = best_seq;
+        fjournal_next_page = (best_page + 1) % FJOURNAL_TOTAL_PAGES;
+    }
+
+    char msg[100];
+    snprintf(msg, sizeof(msg), "Flash Journal: Mounted, next page %u, seq %lu\r\n",
+             fjournal_next_page, fjournal_sequence);
+    Send_Debug_Data(msg);
+    return FJOURNAL_OK;
+}
+
+FJournal_Status_t FJournal_Append(uint8_t stream, const void *data, uint16_t length)
+{
+    static uint8_t rescue_buf[FJOURNAL_STREAM_COUNT][FJOURNAL_MAX_PAYLOAD];
+    uint16_t rescue_len[FJOURNAL_STREAM_COUNT] = {0};
+
+    if (stream < FJOURNAL_STREAM_USER_CONFIG || stream > FJOURNAL_STREAM_RUNTIME_DELTA ||
+        data == NULL) {
+        return FJOURNAL_ERROR;
+    }
+    if (length > FJOURNAL_MAX_PAYLOAD) {
+        return FJOURNAL_TOO_LARGE;
+    }
+
+    // Rotating into a new sector: erase it, preserving any stream whose
+    // newest record is about to go under the eraser
+    if ((fjournal_next_page % FJOURNAL_PAGES_PER_SECTOR) == 0) {
+        uint16_t sector_first = fjournal_next_page;
+        uint16_t sector_last = sector_first + FJOURNAL_PAGES_PER_SECTOR - 1;
+
+        for (uint8_t s = 0; s < FJOURNAL_STREAM_COUNT; s++) {
+            uint16_t page = fjournal_latest_page[s];
+            // Delta records are never rescued: re-appending one would give
+            // it a fresh sequence number above its compaction base and it
+            // would replay (and double-count) at the next boot. The writer
+            // compacts deltas into a new base long before rotation reaches
+            // them (see RUNTIME_DELTA_COMPACT_COUNT in flash_config)
+            if (s + 1 == FJOURNAL_STREAM_RUNTIME_DELTA) {
+                continue;
+            }
+            if (page == FJOURNAL_NO_PAGE || page < sector_first || page > sector_last) {
+                continue;
+            }
+            FJournal_Header_t hdr;
+            if (Flash_ReadData(FJournal_PageAddr(page), (uint8_t*)&hdr, sizeof(hdr)) == 0 &&
+                FJournal_HeaderValid(&hdr)) {
+                Flash_ReadData(FJournal_PageAddr(page) + FJOURNAL_HEADER_SIZE,
+                               rescue_buf[s], hdr.length);
+                rescue_len[s] = hdr.length;
+            }
+        }
+
+        if (FJournal_SubmitErase(FJournal_PageAddr(sector_first)) != FJOURNAL_OK) {
+            return FJOURNAL_ERROR;
+        }
+        fjournal_erases++;
+
+        // Re-append rescued records at the head of the fresh sector
+        for (uint8_t s = 0; s < FJOURNAL_STREAM_COUNT; s++) {
+            if (rescue_len[s] == 0) {
+                continue;
+            }
+            if (FJournal_WriteRecord(fjournal_next_page, s + 1,
+                                     rescue_buf[s], rescue_len[s]) != FJOURNAL_OK) {
+                return FJOURNAL_ERROR;
+            }
+            fjournal_next_page = (fjournal_next_page + 1) % FJOURNAL_TOTAL_PAGES;
+        }
+    }
+
+    FJournal_Status_t status = FJournal_WriteRecord(fjournal_next_page, stream, data, length);
+    if (status == FJOURNAL_OK) {
+        fjournal_next_page = (fjournal_next_page + 1) % FJOURNAL_TOTAL_PAGES;
+    }
+    return status;
+}
+
+/**
+ * @brief Try to read and CRC-verify one record into the caller's buffer
+ */
+static FJournal_Status_t FJournal_ReadRecord(uint16_t page, uint8_t stream,
+                                             void *data, uint16_t length)
+{
+    FJournal_Header_t hdr;
+
+    if (Flash_ReadData(FJournal_PageAddr(page), (uint8_t*)&hdr, sizeof(hdr)) != 0 ||
+        !FJournal_HeaderValid(&hdr) || hdr.stream != stream || hdr.length != length) {
+        return FJOURNAL_NOT_FOUND;
+    }
+
+    if (Flash_ReadData(FJournal_PageAddr(page) + FJOURNAL_HEADER_SIZE,
+                       (uint8_t*)data, length) != 0) {
+        return FJOURNAL_ERROR;
+    }
+
+    if (CRC32_Calculate((const uint8_t*)data, length) != hdr.crc32) {
+        return FJOURNAL_NOT_FOUND;
+    }
+    return FJOURNAL_OK;
+}
+
+FJournal_Status_t FJournal_ReadLatest(uint8_t stream, void *data, uint16_t length)
+{
+    uint16_t page;
+
+    if (stream < FJOURNAL_STREAM_USER_CONFIG || stream > FJOURNAL_STREAM_RUNTIME_DELTA ||
+        data == NULL) {
+        return FJOURNAL_ERROR;
+    }
+
+    page = fjournal_latest_page[stream - 1];
+    if (page == FJOURNAL_NO_PAGE) {
+        return FJOURNAL_NOT_FOUND;
+    }
+
+    if (FJournal_ReadRecord(page, stream, data, length) == FJOURNAL_OK) {
+        return FJOURNAL_OK;
+    }
+
+    // The newest record is torn (power lost mid-program) - fall back to
+    // the next-newest valid one instead of surrendering the stream, so
+    // one bad save costs the customer one save, not their whole tuning.
+    // Candidates are tried newest-first until one passes its CRC.
+    uint32_t below_seq = fjournal_latest_seq[stream - 1];
+
+    for (;;) {
+        FJournal_Header_t hdr;
+        uint32_t best_seq = 0;
+        uint16_t best_page = FJOURNAL_NO_PAGE;
+
+        for (uint16_t p = 0; p < FJOURNAL_TOTAL_PAGES; p++) {
+            if (Flash_ReadData(FJournal_PageAddr(p), (uint8_t*)&hdr,
+                               sizeof(hdr)) != 0) {
+                return FJOURNAL_ERROR;
+            }
+            if (!FJournal_HeaderValid(&hdr) || hdr.stream != stream ||
+                hdr.sequence >= below_seq) {
+                continue;
+            }
+            if (hdr.sequence > best_seq) {
+                best_seq = hdr.sequence;
+                best_page = p;
+            }
+        }
+
+        if (best_page == FJOURNAL_NO_PAGE) {
+            return FJOURNAL_NOT_FOUND;
+        }
+
+        if (FJournal_ReadRecord(best_page, stream, data, length) == FJOURNAL_OK) {
+            // Promote the survivor so later reads hit it directly
+            fjournal_latest_page[stream - 1] = best_page;
+            fjournal_latest_seq[stream - 1] = best_seq;
+            fjournal_fallbacks++;
+            return FJOURNAL_OK;
+        }
+
+        below_seq = best_seq;
+    }
+}
+
+uint32_t FJournal_GetLatestSequence(uint8_t stream)
+{
+    if (stream < FJOURNAL_STREAM_USER_CONFIG || stream > FJOURNAL_STREAM_RUNTIME_DELTA) {
+        return 0;
+    }
+    return fjournal_latest_seq[stream - 1];
+}
+
+uint16_t FJournal_ReplayStream(uint8_t stream, uint32_t after_sequence,
+                               FJournal_ReplayFn_t handler, void *ctx)
+{
+    uint8_t payload[FJOURNAL_MAX_PAYLOAD];
+    uint32_t floor_seq = after_sequence;
+    uint16_t delivered = 0;
+
+    if (stream < FJOURNAL_STREAM_USER_CONFIG || stream > FJOURNAL_STREAM_RUNTIME_DELTA ||
+        handler == NULL) {
+        return 0;
+    }
+
+    // Selection scan: repeatedly find the lowest sequence above the floor.
+    // Quadratic in page count, but the region is 32 pages and this runs
+    // once at boot - header reads, not full-page reads, bound the cost
+    for (;;) {
+        FJournal_Header_t hdr;
+        FJournal_Header_t next = {0};
+        uint16_t next_page = FJOURNAL_NO_PAGE;
+
+        for (uint16_t p = 0; p < FJOURNAL_TOTAL_PAGES; p++) {
+            if (Flash_ReadData(FJournal_PageAddr(p), (uint8_t*)&hdr,
+                               sizeof(hdr)) != 0) {
+                return delivered;
+            }
+            if (!FJournal_HeaderValid(&hdr) || hdr.stream != stream ||
+                hdr.sequence <= floor_seq) {
+                continue;
+            }
+            if (next_page == FJOURNAL_NO_PAGE || hdr.sequence < next.sequence) {
+                next = hdr;
+                next_page = p;
+            }
+        }
+
+        if (next_page == FJOURNAL_NO_PAGE) {
+            return delivered;
+        }
+        floor_seq = next.sequence;
+
+        if (Flash_ReadData(FJournal_PageAddr(next_page) + FJOURNAL_HEADER_SIZE,
+                           payload, next.length) != 0) {
+            return delivered;
+        }
+        if (CRC32_Calculate(payload, next.length) != next.crc32) {
+            continue;   // Torn record - skip it, keep replaying newer ones
+        }
+
+        handler(payload, next.length, ctx);
+        delivered++;
+    }
+}
+
+void FJournal_PrintStatus(void)
+{
+    char msg[120];
+
+    Send_Debug_Data("\r\n=== Flash Journal ===\r\n");
+    snprintf(msg, sizeof(msg), "Next page: %u/%u, seq: %lu, appends: %lu, erases: %lu, fallbacks: %lu\r\n",
+             fjournal_next_page, FJOURNAL_TOTAL_PAGES, fjournal_sequence,
+             fjournal_appends, fjournal_erases, fjournal_fallbacks);
+    Send_Debug_Data(msg);
+    snprintf(msg, sizeof(msg), "User config: page %u seq %lu, Runtime: page %u seq %lu, Delta: page %u seq %lu\r\n",
+             fjournal_latest_page[0], fjournal_latest_seq[0],
+             fjournal_latest_page[1], fjournal_latest_seq[1],
+             fjournal_latest_page[2], fjournal_latest_seq[2]);
+    Send_Debug_Data(msg);
+    Send_Debug_Data("=====================\r\n\r\n");
+}
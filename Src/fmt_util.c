@@ -0,0 +1,216 @@
+/**
+ * @file    fmt_util.c
+ * @brief   Lightweight Append-Style Formatter Implementation
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ */
+
+#include "fmt_util.h"
+#include "profiler.h"
+#include "uart_comm.h"
+#include <stdio.h>
+
+static const char fmt_hex_digits[] = "0123456789ABCDEF";
+
+char *Fmt_Str(char *dst, const char *src)
+{
+    while (*src) {
+        *dst++ = *src++;
+    }
+    *dst = 0;
+    return dst;
+}
+
+char *Fmt_Char(char *dst, char c)
+{
+    *dst++ = c;
+    *dst = 0;
+    return dst;
+}
+
+char *Fmt_U32(char *dst, uint32_t value)
+{
+    // Build backwards into a scratch buffer, then copy forward
+    char tmp[10];
+    uint8_t len = 0;
+
+    do {
+        tmp[len++] = (char)('0' + (value % 10));
+        value /= 10;
+    } while (value);
+
+    while (len) {
+        *dst++ = tmp[--len];
+    }
+    *dst = 0;
+    return dst;
+}
+
+char *Fmt_I32(char *dst, int32_t value)
+{
+    uint32_t mag;
+
+    if (value < 0) {
+        *dst++ = '-';
+        mag = (uint32_t)(-(int64_t)value);  // Safe for INT32_MIN
+    } else {
+        mag = (uint32_t)value;
+    }
+    return Fmt_U32(dst, mag);
+}
+
+char *Fmt_Fixed(char *dst, int32_t scaled, uint8_t decimals)
+{
+    uint32_t mag;
+    uint32_t scale = 1;
+
+    if (scaled < 0) {
+        *dst++ = '-';
+        mag = (uint32_t)(-(int64_t)scaled);
+    } else {
+        mag = (uint32_t)scaled;
+    }
+
+    for (uint8_t i = 0; i < decimals && i < 9; i++) {
+        scale *= 10;
+    }
+
+    dst = Fmt_U32(dst, mag / scale);
+    if (decimals == 0) {
+        return dst;
+    }
+
+    *dst++ = '.';
+    uint32_t frac = mag % scale;
+    for (scale /= 10; scale; scale /= 10) {
+        *dst++ = (char)('0' + (frac / scale) % 10);
+    }
+    *dst = 0;
+    return dst;
+}
+
+char *Fmt_Q16(char *dst, q16_t value, uint8_t decimals)
+{
+    uint32_t scale = 1;
+    for (uint8_t i = 0; i < decimals && i < 9; i++) {
+        scale *= 10;
+    }
+
+    // Round to the requested precision in integer math
+    int64_t scaled = ((int64_t)value * scale +
+                      (value >= 0 ? Q16_ONE / 2 : -(Q16_ONE / 2))) >> Q16_SHIFT;
+    return Fmt_Fixed(dst, (int32_t)scaled, decimals);
+}
+
+char *Fmt_Hex8(char *dst, uint8_t value)
+{
+    *dst++ = fmt_hex_digits[value >> 4];
+    *dst++ = fmt_hex_digits[value & 0x0F];
+    *dst = 0;
+    return dst;
+}
+
+char *Fmt_Hex16(char *dst, uint16_t value)
+{
+    dst = Fmt_Hex8(dst, (uint8_t)(value >> 8));
+    return Fmt_Hex8(dst, (uint8_t)value);
+}
+
+char *Fmt_Hex32(char *dst, uint32_t value)
+{
+    dst = Fmt_Hex16(dst, (uint16_t)(value >> 16));
+    return Fmt_Hex16(dst, (uint16_t)value);
+}
+
+char *Fmt_HexBytes(char *dst, const uint8_t *data, uint16_t length)
+{
+    for (uint16_t i = 0; i < length; i++) {
+        if (i) {
+            *dst++ = ' ';
+        }
+        dst = Fmt_Hex8(dst, data[i]);
+    }
+    *dst = 0;
+    return dst;
+}
+
+char *Fmt_IP(char *dst, const uint8_t *ip)
+{
+    dst = Fmt_U32(dst, ip[0]);
+    dst = Fmt_Char(dst, '.');
+    dst = Fmt_U32(dst, ip[1]);
+    dst = Fmt_Char(dst, '.');
+    dst = Fmt_U32(dst, ip[2]);
+    dst = Fmt_Char(dst, '.');
+    return Fmt_U32(dst, ip[3]);
+}
+
+char *Fmt_MAC(char *dst, const uint8_t *mac)
+{
+    for (uint8_t i = 0; i < 6; i++) {
+        if (i) {
+            *dst++ = ':';
+        }
+        dst = Fmt_Hex8(dst, mac[i]);
+    }
+    return dst;
+}
+
+// ========================================================================
+// BENCHMARK ('fmtbench' CONSOLE COMMAND)
+// ========================================================================
+
+void Fmt_Benchmark(void)
+{
+    static uint8_t prof_snprintf = PROFILER_INVALID_SECTION;
+    static uint8_t prof_fmt = PROFILER_INVALID_SECTION;
+
+    if (prof_snprintf == PROFILER_INVALID_SECTION)
+        prof_snprintf = Profiler_RegisterSection("fmt_snprintf");
+    if (prof_fmt == PROFILER_INVALID_SECTION)
+        prof_fmt = Profiler_RegisterSection("fmt_append");
+
+    char msg[120];
+    volatile uint16_t sink = 0;
+
+    Send_Debug_Data("FMTBENCH: 1000 iterations per path...\r\n");
+
+    for (uint16_t i = 0; i < 1000; i++) {
+        uint16_t temp = 123 + (i & 63);
+        uint16_t crc = (uint16_t)(0xA001 ^ i);
+
+        Profiler_Begin(prof_snprintf);
+        snprintf(msg, sizeof(msg), "SENSOR,T=%d.%d,CRC=0x%04X,SEQ=%lu\r\n",
+                 temp / 10, temp % 10, crc, (uint32_t)i);
+        Profiler_End(prof_snprintf);
+        sink += msg[0];
+
+        Profiler_Begin(prof_fmt);
+        char *p = msg;
+        p = Fmt_Str(p, "SENSOR,T=");
+        p = Fmt_Fixed(p, temp, 1);
+        p = Fmt_Str(p, ",CRC=0x");
+        p = Fmt_Hex16(p, crc);
+        p = Fmt_Str(p, ",SEQ=");
+        p = Fmt_U32(p, i);
+        p = Fmt_Str(p, "\r\n");
+        Profiler_End(prof_fmt);
+        sink += msg[0];
+    }
+
+    (void)sink;
+
+    profiler_section_t sec;
+
+    if (Profiler_GetSection(prof_snprintf, &sec) && sec.call_count > 0) {
+        Send_Debug_Formatted("FMTBENCH: snprintf avg %lu cycles (min %lu, max %lu)\r\n",
+                             (uint32_t)(sec.total_cycles / sec.call_count),
+                             sec.min_cycles, sec.max_cycles);
+    }
+    if (Profiler_GetSection(prof_fmt, &sec) && sec.call_count > 0) {
+        Send_Debug_Formatted("FMTBENCH: append   avg %lu cycles (min %lu, max %lu)\r\n",
+                             (uint32_t)(sec.total_cycles / sec.call_count),
+                             sec.min_cycles, sec.max_cycles);
+    }
+}
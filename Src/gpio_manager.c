@@ -3,15 +3,25 @@
  */
 
 #include "gpio_manager.h"
+#include "event_queue.h"
+#include "debug_log.h"
+#include "fmt_util.h"
 #include <stdarg.h>
 
 // External debug function
 extern void Send_Debug_Data(const char *message);
 
-// Wrapper function for formatted debug output
+// Wrapper function for formatted debug output. The runtime log gate
+// sits ahead of vsnprintf so a silenced module pays a compare, not a
+// format pass.
 void Send_Debug_Formatted(const char *format, ...) {
     char buffer[200];
     va_list args;
+
+    if (!DebugLog_Enabled(LOG_MOD_GPIO, LOG_LEVEL_INFO)) {
+        return;
+    }
+
     va_start(args, format);
     vsnprintf(buffer, sizeof(buffer), format, args);
     va_end(args);
@@ -63,6 +73,35 @@ static InputConfig_t input_config[INPUT_COUNT] = {
     {"I1.7", GPIOC, GPIO_PIN_3, 0, 1, 1}    // PC3
 };
 
+/* === EXTI fast path for critical safety inputs ===
+ * The E-stop (I0.0/PA0) and phase monitor (I0.2/PC6) fire an interrupt
+ * on any edge. The ISR drops all compressor relays with direct BSRR
+ * writes - microseconds from contact opening to coils off, independent
+ * of main-loop health - and latches a trip flag that the polled safety
+ * scan consumes to raise the alarm in task context. */
+static volatile uint16_t safety_trip_flags = 0;     // Bit n = input n tripped
+static volatile uint32_t safety_trip_count = 0;
+
+/* === SysTick vertical-counter debounce engine ===
+ * Every millisecond the SysTick hook snapshots the five input ports
+ * with direct IDR reads and runs a 2-bit vertical counter across all
+ * 16 channels at once - pure bitwise arithmetic, no per-pin branching.
+ * A channel must disagree with its stable state for 4 consecutive
+ * samples before it toggles, so contact bounce is absorbed but a 5 ms
+ * flow-switch pulse is never missed. Raw levels are stored (1 = pin
+ * high = inactive for these active-low opto inputs). */
+static uint8_t input_port_index[INPUT_COUNT];   // Port snapshot slot per input
+static uint8_t input_pin_pos[INPUT_COUNT];      // Pin position within the port
+static volatile uint16_t input_stable_state = 0;    // Debounced raw pin levels
+static volatile uint16_t input_rising_latched = 0;  // Raw low->high (released)
+static volatile uint16_t input_falling_latched = 0; // Raw high->low (activated)
+static uint16_t input_vcnt0 = 0;                // Vertical counter bit 0
+static uint16_t input_vcnt1 = 0;                // Vertical counter bit 1
+static uint8_t input_debounce_ready = 0;
+
+/* Ports holding input pins, in snapshot order */
+static GPIO_TypeDef *const input_snapshot_ports[5] = {GPIOA, GPIOB, GPIOC, GPIOD, GPIOE};
+
 // Add these static variables at the top of the file (after includes)
 static uint32_t test_start_time = 0;
 static uint8_t test_state = 0;  // 0=idle, 1=turning_on, 2=all_on, 3=turning_off
@@ -89,6 +128,8 @@ void GPIO_Manager_Init(void)
     // NOTE: This will reconfigure pins that MX_GPIO_Init() already set up
     GPIO_InitAllRelays();
     GPIO_InitAllInputs();
+    GPIO_InitSafetyEXTI();
+    Input_DebounceInit();
 
     // Read current state of all relays (in case some were already set)
     for (int i = 0; i < RELAY_COUNT; i++) {
@@ -167,6 +208,171 @@ void GPIO_InitAllInputs(void)
     Send_Debug_Formatted("All 16 digital inputs initialized with pull-ups enabled\r\n");
 }
 
+/**
+ * @brief Switch the E-stop and phase-monitor inputs to EXTI mode
+ * @note  Both edges: the ISR reads the level, so a bounce cannot leave
+ *        a trip unseen. Priority 0 - nothing preempts the safety path.
+ */
+void GPIO_InitSafetyEXTI(void)
+{
+    GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+    GPIO_InitStruct.Mode = GPIO_MODE_IT_RISING_FALLING;
+    GPIO_InitStruct.Pull = GPIO_PULLUP;
+    GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+
+    // I0.0 / PA0 - emergency stop (EXTI0)
+    GPIO_InitStruct.Pin = GPIO_PIN_0;
+    HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+
+    // I0.2 / PC6 - phase monitor (EXTI9_5)
+    GPIO_InitStruct.Pin = GPIO_PIN_6;
+    HAL_GPIO_Init(GPIOC, &GPIO_InitStruct);
+
+    HAL_NVIC_SetPriority(EXTI0_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(EXTI0_IRQn);
+    HAL_NVIC_SetPriority(EXTI9_5_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(EXTI9_5_IRQn);
+
+    Send_Debug_Formatted("Safety EXTI armed: E-stop (PA0), phase monitor (PC6)\r\n");
+}
+
+/**
+ * @brief Drop all compressor relays (Q0 bank, relays 0-7) immediately
+ * @note  Interrupt context - direct BSRR writes, one store per port.
+ *        ULN2803 drivers are active HIGH, so OFF = pin reset (upper half).
+ *        Shared with the control tick ISR (Safety_TickISR).
+ */
+void GPIO_FastTripDropCompressors(void)
+{
+    GPIOE->BSRR = (uint32_t)(GPIO_PIN_5 | GPIO_PIN_2 | GPIO_PIN_3 |
+                             GPIO_PIN_4 | GPIO_PIN_6) << 16;   // Q0.0/2/4/5/6
+    GPIOB->BSRR = (uint32_t)(GPIO_PIN_8 | GPIO_PIN_9) << 16;   // Q0.1/3
+    GPIOA->BSRR = (uint32_t)GPIO_PIN_10 << 16;                 // Q0.7
+
+    // Keep the software shadow truthful so Relay_Get() agrees
+    for (int i = 0; i < 8; i++) {
+        relay_config[i].current_state = 0;
+    }
+}
+
+/**
+ * @brief EXTI callback for the safety inputs
+ * @note  Interrupt context. Inputs are active LOW (opto pulls the pin
+ *        down when the circuit is healthy); a HIGH level means the
+ *        contact opened - trip now, let the safety task raise the alarm.
+ */
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+    if (GPIO_Pin == GPIO_PIN_0) {           // PA0 - emergency stop
+        if (HAL_GPIO_ReadPin(GPIOA, GPIO_PIN_0) == GPIO_PIN_SET) {
+            GPIO_FastTripDropCompressors();
+            safety_trip_flags |= (1 << 0);
+            safety_trip_count++;
+        }
+    }
+    else if (GPIO_Pin == GPIO_PIN_6) {      // PC6 - phase monitor
+        if (HAL_GPIO_ReadPin(GPIOC, GPIO_PIN_6) == GPIO_PIN_SET) {
+            GPIO_FastTripDropCompressors();
+            safety_trip_flags |= (1 << 2);
+            safety_trip_count++;
+        }
+    }
+}
+
+/**
+ * @brief Build the snapshot index tables and prime the debounce state
+ */
+void Input_DebounceInit(void)
+{
+    for (int i = 0; i < INPUT_COUNT; i++) {
+        for (uint8_t p = 0; p < 5; p++) {
+            if (input_config[i].gpio_port == input_snapshot_ports[p]) {
+                input_port_index[i] = p;
+                break;
+            }
+        }
+        input_pin_pos[i] = (uint8_t)__builtin_ctz(input_config[i].gpio_pin);
+    }
+
+    // Prime stable state from a direct snapshot so boot sees no false edges
+    uint16_t initial = 0;
+    for (int i = 0; i < INPUT_COUNT; i++) {
+        uint32_t idr = input_snapshot_ports[input_port_index[i]]->IDR;
+        initial |= (uint16_t)(((idr >> input_pin_pos[i]) & 1U) << i);
+    }
+    input_stable_state = initial;
+    input_vcnt0 = 0;
+    input_vcnt1 = 0;
+    input_debounce_ready = 1;
+
+    Send_Debug_Formatted("Input debounce engine armed (1ms SysTick, 4ms filter)\r\n");
+}
+
+/**
+ * @brief 1 ms debounce tick - called from SysTick_Handler
+ * @note  Interrupt context. Cost is constant: 5 IDR reads, 16 fixed
+ *        shift/mask steps, and a handful of bitwise ops for all
+ *        channels together.
+ */
+void Input_DebounceTick(void)
+{
+    if (!input_debounce_ready) return;
+
+    uint32_t idr[5];
+    for (uint8_t p = 0; p < 5; p++) {
+        idr[p] = input_snapshot_ports[p]->IDR;
+    }
+
+    uint16_t sample = 0;
+    for (int i = 0; i < INPUT_COUNT; i++) {
+        sample |= (uint16_t)(((idr[input_port_index[i]] >> input_pin_pos[i]) & 1U) << i);
+    }
+
+    // 2-bit vertical counter: a channel toggles only after 4 consecutive
+    // samples that disagree with its stable state
+    uint16_t delta = sample ^ input_stable_state;
+    input_vcnt1 = (input_vcnt1 ^ input_vcnt0) & delta;
+    input_vcnt0 = ~input_vcnt0 & delta;
+    uint16_t toggles = delta & ~(input_vcnt0 | input_vcnt1);
+
+    if (toggles) {
+        input_stable_state ^= toggles;
+        input_rising_latched  |= toggles & input_stable_state;
+        input_falling_latched |= toggles & (uint16_t)~input_stable_state;
+        EventQueue_Post(EVENT_INPUT_EDGE, 0, toggles);
+    }
+}
+
+/**
+ * @brief Fetch and clear the latched debounced edge masks
+ * @param rising Raw low->high transitions (input released) - may be NULL
+ * @param falling Raw high->low transitions (input activated) - may be NULL
+ */
+void Input_GetAndClearEdges(uint16_t *rising, uint16_t *falling)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (rising != NULL)  *rising = input_rising_latched;
+    if (falling != NULL) *falling = input_falling_latched;
+    input_rising_latched = 0;
+    input_falling_latched = 0;
+    if (!primask) __enable_irq();
+}
+
+/**
+ * @brief Fetch and clear the latched EXTI trip flags (bit n = input n)
+ */
+uint16_t GPIO_GetAndClearSafetyTrips(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint16_t flags = safety_trip_flags;
+    safety_trip_flags = 0;
+    if (!primask) __enable_irq();
+    return flags;
+}
+
 /**
  * @brief Set relay state (silent version)
  * @param relay_id: Relay ID (0-15)
@@ -193,6 +399,70 @@ void Relay_Set(uint8_t relay_id, uint8_t state)
     // Completely silent - no debug output
 }
 
+/**
+ * @brief Current state of all relays as a bitmask (bit n = relay n ON)
+ */
+uint16_t Relay_GetAll(void)
+{
+    uint16_t mask = 0;
+    for (int i = 0; i < RELAY_COUNT; i++) {
+        if (relay_config[i].current_state) {
+            mask |= (1 << i);
+        }
+    }
+    return mask;
+}
+
+/**
+ * @brief Commit a complete desired relay state in one operation
+ * @param desired_mask: Target state, bit n = relay n ON
+ * @note  Computes the delta against the current shadow and folds all
+ *        changes on the same port into a single BSRR write (set and
+ *        reset halves together), so a staging transition that
+ *        reshuffles several compressors switches on one clean edge per
+ *        port instead of a ragged per-relay sequence. One audit line
+ *        per commit instead of one per relay.
+ */
+void Relay_CommitGroup(uint16_t desired_mask)
+{
+    // Ports carrying relay pins, in accumulation order
+    static GPIO_TypeDef *const relay_ports[6] = {GPIOA, GPIOB, GPIOC, GPIOD, GPIOE, GPIOH};
+    uint32_t bsrr[6] = {0};
+
+    uint16_t current = Relay_GetAll();
+    uint16_t delta = current ^ desired_mask;
+    if (delta == 0) {
+        return;     // Nothing to switch
+    }
+
+    for (int i = 0; i < RELAY_COUNT; i++) {
+        if (!(delta & (1 << i))) continue;
+
+        uint8_t on = (desired_mask >> i) & 1;
+        for (uint8_t p = 0; p < 6; p++) {
+            if (relay_config[i].gpio_port == relay_ports[p]) {
+                bsrr[p] |= on ? (uint32_t)relay_config[i].gpio_pin
+                              : (uint32_t)relay_config[i].gpio_pin << 16;
+                break;
+            }
+        }
+        relay_config[i].current_state = on;
+    }
+
+    // One store per affected port - all its relays switch on the same edge
+    for (uint8_t p = 0; p < 6; p++) {
+        if (bsrr[p]) {
+            relay_ports[p]->BSRR = bsrr[p];
+        }
+    }
+
+    // Deferred: the commit path only stores the trace words, the log
+    // pump task formats them later
+    LOG_GPIO_DEFER(LOG_LEVEL_DEBUG,
+                   "Relay commit: 0x%04lX -> 0x%04lX (delta 0x%04lX)\r\n",
+                   current, desired_mask, delta);
+}
+
 /**
  * @brief Get relay state
  * @param relay_id: Relay number (0-15)
@@ -252,11 +522,13 @@ uint8_t Input_Read(uint8_t input_id)
  */
 uint8_t Input_ReadDebounced(uint8_t input_id)
 {
-    uint8_t state1 = Input_Read(input_id);
-    HAL_Delay(5); // 5ms debounce delay
-    uint8_t state2 = Input_Read(input_id);
+    if (input_id >= INPUT_COUNT) return 0xFF;
 
-    return (state1 == state2) ? state1 : input_config[input_id].current_state;
+    // Served from the SysTick debounce engine - no sampling delay here
+    if (input_debounce_ready) {
+        return (uint8_t)((input_stable_state >> input_id) & 1U);
+    }
+    return Input_Read(input_id);    // Engine not armed yet (early boot)
 }
 
 /**
@@ -265,14 +537,18 @@ uint8_t Input_ReadDebounced(uint8_t input_id)
  */
 uint16_t Input_ReadAll(void)
 {
-    uint16_t result = 0;
+    // One debounced snapshot instead of 16 HAL_GPIO_ReadPin calls;
+    // active LOW, so an active input is a 0 bit in the raw levels
+    if (input_debounce_ready) {
+        return (uint16_t)~input_stable_state;
+    }
 
+    uint16_t result = 0;
     for (int i = 0; i < INPUT_COUNT; i++) {
         if (Input_Read(i) == 0) { // Active (24V applied)
             result |= (1 << i);
         }
     }
-
     return result;
 }
 
@@ -633,10 +909,12 @@ void Monitor_Input_Changes_Once(void) {
         for (int i = 0; i < 16; i++) {
             if (changed & (1 << i)) {
                 char input_msg[60];
-                snprintf(input_msg, sizeof(input_msg), 
-                        "INPUT CHANGE: I%d.%d = %s\r\n", 
-                        i/8, i%8, 
-                        (current_input_state & (1 << i)) ? "ACTIVE" : "INACTIVE");
+                char *p = Fmt_Str(input_msg, "INPUT CHANGE: I");
+                p = Fmt_U32(p, (uint32_t)(i / 8));
+                p = Fmt_Char(p, '.');
+                p = Fmt_U32(p, (uint32_t)(i % 8));
+                p = Fmt_Str(p, (current_input_state & (1 << i)) ?
+                            " = ACTIVE\r\n" : " = INACTIVE\r\n");
                 Send_Debug_Data(input_msg);
             }
         }
@@ -678,10 +956,12 @@ void Monitor_Input_Changes_Continuous(void) {
             for (int i = 0; i < 16; i++) {
                 if (changed & (1 << i)) {
                     char input_msg[60];
-                    snprintf(input_msg, sizeof(input_msg), 
-                            "INPUT CHANGE: I%d.%d = %s\r\n", 
-                            i/8, i%8, 
-                            (current_input_state & (1 << i)) ? "ACTIVE" : "INACTIVE");
+                    char *p = Fmt_Str(input_msg, "INPUT CHANGE: I");
+                    p = Fmt_U32(p, (uint32_t)(i / 8));
+                    p = Fmt_Char(p, '.');
+                    p = Fmt_U32(p, (uint32_t)(i % 8));
+                    p = Fmt_Str(p, (current_input_state & (1 << i)) ?
+                                " = ACTIVE\r\n" : " = INACTIVE\r\n");
                     Send_Debug_Data(input_msg);
                 }
             }
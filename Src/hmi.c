@@ -1,6 +1,10 @@
 #include "hmi.h"
 #include "uart_comm.h"
 #include "gpio.h"
+#include "profiler.h"
+#include "crc_util.h"
+#include "dcache_util.h"
+#include "event_queue.h"
 #include <string.h>
 
 // External UART handle
@@ -27,7 +31,6 @@ static uint32_t responses_received = 0;
 static uint8_t last_response_received = 0;
 
 // Add these variables at the top of hmi.c (after existing variables):
-static uint8_t hmi_rx_buffer[1];  // Single byte receive buffer
 static volatile uint8_t hmi_interrupt_active = 0;
 
 // Add this near the top of hmi.c with other static variables:
@@ -43,42 +46,490 @@ uint8_t HMI_Is_Initialized(void) {
     return hmi_initialized;
 }
 
-// CRC calculation for DWIN HMI commands
-uint16_t Calculate_CRC16(uint8_t* data, uint8_t length) {
-    uint16_t crc = 0xFFFF;  // Initial value
-    
-    for (uint8_t i = 0; i < length; i++) {
-        crc ^= (uint16_t)data[i];
-        
-        for (uint8_t j = 0; j < 8; j++) {
-            if (crc & 0x0001) {
-                crc = (crc >> 1) ^ 0xA001;  // CRC-16 polynomial
-            } else {
-                crc = crc >> 1;
+/* === Non-blocking HMI transmit pipeline ===
+ * Frames are enqueued and clocked out by a 1 ms state machine driven from
+ * the SysTick handler (HMI_TX_Tick). The machine handles RS485 direction
+ * switching, interrupt-driven UART transmission and the inter-frame gap,
+ * so no caller ever sleeps waiting for the DWIN bus. The old
+ * HAL_Delay-based send helpers now just enqueue. */
+
+#define HMI_TX_QUEUE_SIZE       8
+#define HMI_TX_MAX_FRAME        32
+#define HMI_TX_DE_SETTLE_MS     2   // Transceiver TX turnaround
+#define HMI_TX_TAIL_MS          1   // Hold DE after last stop bit
+#define HMI_TX_DEFAULT_GAP_MS   5   // DWIN inter-frame gap
+
+typedef enum {
+    HMI_TX_IDLE = 0,
+    HMI_TX_DE_SETTLE,       // DE raised, waiting for transceiver
+    HMI_TX_SENDING,         // UART interrupt transmission in flight
+    HMI_TX_TAIL,            // Transmission done, holding DE briefly
+    HMI_TX_GAP              // DE dropped, enforcing inter-frame gap
+} HMI_TxState_t;
+
+typedef struct {
+    uint8_t data[HMI_TX_MAX_FRAME];
+    uint8_t length;
+    uint8_t gap_ms;             // Gap to enforce after this frame
+} HMI_TxFrame_t;
+
+static HMI_TxFrame_t hmi_tx_queue[HMI_TX_QUEUE_SIZE];
+static volatile uint8_t hmi_tx_head = 0;    // Next slot to fill
+static volatile uint8_t hmi_tx_tail = 0;    // Next frame to send
+static volatile HMI_TxState_t hmi_tx_state = HMI_TX_IDLE;
+static volatile uint8_t hmi_tx_timer = 0;   // ms countdown for timed states
+static volatile uint8_t hmi_tx_done = 0;    // Set by UART TX complete callback
+static uint32_t hmi_tx_dropped = 0;         // Frames dropped on full queue
+
+/**
+ * @brief Queue a frame for transmission to the HMI
+ * @param data Frame bytes (copied into the queue)
+ * @param length Frame length (max HMI_TX_MAX_FRAME)
+ * @param gap_ms Inter-frame gap to enforce after this frame
+ * @return 1 if queued, 0 if the queue is full or the frame too long
+ */
+uint8_t HMI_TX_Enqueue(const uint8_t *data, uint8_t length, uint8_t gap_ms) {
+    if (data == NULL || length == 0 || length > HMI_TX_MAX_FRAME) return 0;
+
+    uint8_t next_head = (hmi_tx_head + 1) % HMI_TX_QUEUE_SIZE;
+    if (next_head == hmi_tx_tail) {
+        hmi_tx_dropped++;       // Queue full - drop whole frame, never block
+        return 0;
+    }
+
+    HMI_TxFrame_t *frame = &hmi_tx_queue[hmi_tx_head];
+    memcpy(frame->data, data, length);
+    frame->length = length;
+    frame->gap_ms = gap_ms;
+    hmi_tx_head = next_head;
+    return 1;
+}
+
+/**
+ * @brief Number of frames waiting in the TX queue
+ */
+uint8_t HMI_TX_GetQueueDepth(void) {
+    return (uint8_t)((hmi_tx_head - hmi_tx_tail + HMI_TX_QUEUE_SIZE) % HMI_TX_QUEUE_SIZE);
+}
+
+/**
+ * @brief Frames dropped because the TX queue was full
+ */
+uint32_t HMI_TX_GetDroppedFrames(void) {
+    return hmi_tx_dropped;
+}
+
+/**
+ * @brief UART4 TX complete - called from the central UART dispatcher
+ * @note  Interrupt context
+ */
+void HMI_TxCpltCallback(void) {
+    hmi_tx_done = 1;
+}
+
+/**
+ * @brief 1 ms TX state machine - called from the SysTick handler
+ * @note  Interrupt context; only touches the DE pin, the queue tail and
+ *        starts interrupt-driven UART transfers
+ */
+void HMI_TX_Tick(void) {
+    switch (hmi_tx_state) {
+        case HMI_TX_IDLE:
+            if (hmi_tx_head != hmi_tx_tail) {
+                HAL_GPIO_WritePin(HMI_DE_RE_GPIO_Port, HMI_DE_RE_Pin, GPIO_PIN_SET);
+                hmi_tx_timer = HMI_TX_DE_SETTLE_MS;
+                hmi_tx_state = HMI_TX_DE_SETTLE;
             }
+            break;
+
+        case HMI_TX_DE_SETTLE:
+            if (--hmi_tx_timer == 0) {
+                HMI_TxFrame_t *frame = &hmi_tx_queue[hmi_tx_tail];
+                hmi_tx_done = 0;
+                if (HAL_UART_Transmit_IT(&huart4, frame->data, frame->length) == HAL_OK) {
+                    hmi_tx_state = HMI_TX_SENDING;
+                } else {
+                    // UART busy (e.g. a legacy blocking send) - retry next ms
+                    hmi_tx_timer = 1;
+                }
+            }
+            break;
+
+        case HMI_TX_SENDING:
+            if (hmi_tx_done) {
+                hmi_tx_timer = HMI_TX_TAIL_MS;
+                hmi_tx_state = HMI_TX_TAIL;
+            }
+            break;
+
+        case HMI_TX_TAIL:
+            if (--hmi_tx_timer == 0) {
+                HAL_GPIO_WritePin(HMI_DE_RE_GPIO_Port, HMI_DE_RE_Pin, GPIO_PIN_RESET);
+                uint8_t gap = hmi_tx_queue[hmi_tx_tail].gap_ms;
+                hmi_tx_tail = (hmi_tx_tail + 1) % HMI_TX_QUEUE_SIZE;
+                hmi_tx_timer = (gap > 0) ? gap : 1;
+                hmi_tx_state = HMI_TX_GAP;
+            }
+            break;
+
+        case HMI_TX_GAP:
+            if (--hmi_tx_timer == 0) {
+                hmi_tx_state = HMI_TX_IDLE;
+            }
+            break;
+
+        default:
+            hmi_tx_state = HMI_TX_IDLE;
+            break;
+    }
+}
+
+/* === VP transaction layer ===
+ * Shadow cache over the panel's VP space with batched frames. Writers
+ * call HMI_VP_Set(); the flush pass coalesces runs of adjacent dirty
+ * VPs into single multi-word 0x82 frames. User-input VPs (touch
+ * buttons) are polled as ONE multi-word 0x83 read of the whole input
+ * window and the reply lands back in the shadow, where HMI_VP_Get()
+ * and HMI_VP_InputEdge() serve it. Panel round trips per update cycle
+ * drop from one-per-register to a write frame or two plus one poll,
+ * and the flush is bounded per call. */
+
+#define HMI_VP_OUT_BASE         HMI_VP_TEMP             // 0x1000
+#define HMI_VP_OUT_WORDS        18                      // ..HMI_VP_MESSAGE_COUNT
+#define HMI_VP_IN_BASE          HMI_VP_BTN_RELAY_Q06    // 0x2000
+#define HMI_VP_IN_WORDS         4                       // ..HMI_VP_BTN_TEST
+#define HMI_VP_MAX_RUN_WORDS    12      // 6 header + 24 data < HMI_TX_MAX_FRAME
+#define HMI_VP_FLUSH_FRAMES     2       // Write frames per flush pass
+#define HMI_VP_POLL_INTERVAL_MS 200     // Input window poll cadence
+
+static uint16_t vp_out_shadow[HMI_VP_OUT_WORDS];
+static uint32_t vp_out_dirty = 0;           // Bit per output VP
+static uint32_t vp_out_written = 0;         // Shadow valid (first Set writes)
+static uint16_t vp_in_shadow[HMI_VP_IN_WORDS];
+static uint16_t vp_in_changed = 0;          // Sticky bits, consumed by InputEdge
+static uint32_t vp_last_poll = 0;
+
+static uint32_t vp_frames_written = 0;
+static uint32_t vp_words_written = 0;
+static uint32_t vp_writes_elided = 0;       // Set() calls the shadow absorbed
+static uint32_t vp_polls_sent = 0;
+static uint32_t vp_poll_replies = 0;
+
+/**
+ * @brief Stage a VP write through the shadow cache
+ *
+ * Unchanged values are absorbed; changed ones are marked dirty and go
+ * out with the next coalesced flush. Addresses outside the shadowed
+ * window fall back to a direct single-word frame.
+ */
+uint8_t HMI_VP_Set(uint16_t address, uint16_t value) {
+    if (address < HMI_VP_OUT_BASE ||
+        address >= (HMI_VP_OUT_BASE + HMI_VP_OUT_WORDS)) {
+        HMI_Write_VP_Register(address, value);
+        return 1;
+    }
+
+    uint8_t index = (uint8_t)(address - HMI_VP_OUT_BASE);
+    if ((vp_out_written & (1UL << index)) && vp_out_shadow[index] == value) {
+        vp_writes_elided++;
+        return 1;
+    }
+
+    vp_out_shadow[index] = value;
+    vp_out_written |= (1UL << index);
+    vp_out_dirty |= (1UL << index);
+    return 1;
+}
+
+/**
+ * @brief Read a VP from the shadow cache (no panel round trip)
+ */
+uint8_t HMI_VP_Get(uint16_t address, uint16_t *value) {
+    if (value == NULL) return 0;
+
+    if (address >= HMI_VP_IN_BASE &&
+        address < (HMI_VP_IN_BASE + HMI_VP_IN_WORDS)) {
+        *value = vp_in_shadow[address - HMI_VP_IN_BASE];
+        return 1;
+    }
+    if (address >= HMI_VP_OUT_BASE &&
+        address < (HMI_VP_OUT_BASE + HMI_VP_OUT_WORDS) &&
+        (vp_out_written & (1UL << (address - HMI_VP_OUT_BASE)))) {
+        *value = vp_out_shadow[address - HMI_VP_OUT_BASE];
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Consume one input-VP change (touch edge) if pending
+ */
+uint8_t HMI_VP_InputEdge(uint16_t address, uint16_t *value) {
+    if (address < HMI_VP_IN_BASE ||
+        address >= (HMI_VP_IN_BASE + HMI_VP_IN_WORDS)) {
+        return 0;
+    }
+
+    uint8_t index = (uint8_t)(address - HMI_VP_IN_BASE);
+    if (!(vp_in_changed & (1u << index))) {
+        return 0;
+    }
+
+    vp_in_changed &= ~(1u << index);
+    if (value != NULL) {
+        *value = vp_in_shadow[index];
+    }
+    return 1;
+}
+
+/**
+ * @brief Coalesce dirty shadow runs into multi-word write frames
+ *        (bounded to HMI_VP_FLUSH_FRAMES per call)
+ */
+static void HMI_VP_Flush(void) {
+    uint8_t frames = 0;
+    uint8_t i = 0;
+
+    while (i < HMI_VP_OUT_WORDS && frames < HMI_VP_FLUSH_FRAMES) {
+        if (!(vp_out_dirty & (1UL << i))) {
+            i++;
+            continue;
+        }
+
+        uint8_t run = 0;
+        while ((i + run) < HMI_VP_OUT_WORDS && run < HMI_VP_MAX_RUN_WORDS &&
+               (vp_out_dirty & (1UL << (i + run)))) {
+            run++;
+        }
+
+        // DWIN multi-word write: 5A A5 LEN 82 ADDR_H ADDR_L D0H D0L ...
+        uint8_t frame[6 + 2 * HMI_VP_MAX_RUN_WORDS];
+        uint16_t address = HMI_VP_OUT_BASE + i;
+        frame[0] = DWIN_HEADER_BYTE1;
+        frame[1] = DWIN_HEADER_BYTE2;
+        frame[2] = (uint8_t)(3 + 2 * run);
+        frame[3] = DWIN_CMD_WRITE_VAR;
+        frame[4] = (address >> 8) & 0xFF;
+        frame[5] = address & 0xFF;
+        for (uint8_t w = 0; w < run; w++) {
+            frame[6 + 2 * w] = (vp_out_shadow[i + w] >> 8) & 0xFF;
+            frame[7 + 2 * w] = vp_out_shadow[i + w] & 0xFF;
+        }
+
+        if (!HMI_TX_Enqueue(frame, (uint8_t)(6 + 2 * run), HMI_TX_DEFAULT_GAP_MS)) {
+            return;     // TX queue full - dirty bits stay, retry next pass
         }
+
+        for (uint8_t w = 0; w < run; w++) {
+            vp_out_dirty &= ~(1UL << (i + w));
+        }
+        vp_frames_written++;
+        vp_words_written += run;
+        frames++;
+        i += run;
     }
-    
-    return crc;
 }
 
-// Alternative CRC-8 calculation (some DWIN models use CRC-8)
-uint8_t Calculate_CRC8(uint8_t* data, uint8_t length) {
-    uint8_t crc = 0x00;  // Initial value
-    
-    for (uint8_t i = 0; i < length; i++) {
-        crc ^= data[i];
-        
-        for (uint8_t j = 0; j < 8; j++) {
-            if (crc & 0x80) {
-                crc = (crc << 1) ^ 0x07;  // CRC-8 polynomial
-            } else {
-                crc = crc << 1;
-            }
+/**
+ * @brief Parse a multi-word read reply into the input shadow
+ *        (5A A5 LEN 83 ADDR_H ADDR_L N D0H D0L ...)
+ */
+static void HMI_VP_IngestReadReply(const uint8_t *frame, uint8_t length) {
+    if (length < 9 || frame[3] != DWIN_CMD_READ_VAR) return;
+
+    uint16_t address = ((uint16_t)frame[4] << 8) | frame[5];
+    uint8_t words = frame[6];
+
+    if (address < HMI_VP_IN_BASE || words == 0 ||
+        (address + words) > (HMI_VP_IN_BASE + HMI_VP_IN_WORDS) ||
+        length < (uint8_t)(7 + 2 * words)) {
+        return;
+    }
+
+    for (uint8_t w = 0; w < words; w++) {
+        uint8_t index = (uint8_t)(address - HMI_VP_IN_BASE + w);
+        uint16_t value = ((uint16_t)frame[7 + 2 * w] << 8) | frame[8 + 2 * w];
+        if (vp_in_shadow[index] != value) {
+            vp_in_shadow[index] = value;
+            vp_in_changed |= (1u << index);
+        }
+    }
+    vp_poll_replies++;
+}
+
+/**
+ * @brief VP transaction pump: flush coalesced writes, poll the input
+ *        window on its cadence (called from HMI_Process)
+ */
+void HMI_VP_Process(void) {
+    HMI_VP_Flush();
+
+    uint32_t now = HAL_GetTick();
+    if ((now - vp_last_poll) >= HMI_VP_POLL_INTERVAL_MS) {
+        vp_last_poll = now;
+
+        // One read frame covers every user-input VP
+        uint8_t poll[7] = {
+            DWIN_HEADER_BYTE1, DWIN_HEADER_BYTE2, 0x04, DWIN_CMD_READ_VAR,
+            (HMI_VP_IN_BASE >> 8) & 0xFF, HMI_VP_IN_BASE & 0xFF,
+            HMI_VP_IN_WORDS
+        };
+        if (HMI_TX_Enqueue(poll, sizeof(poll), HMI_TX_DEFAULT_GAP_MS)) {
+            vp_polls_sent++;
         }
     }
-    
-    return crc;
+}
+
+/**
+ * @brief Print shadow cache and batching statistics
+ */
+void HMI_VP_PrintStatus(void) {
+    char msg[120];
+
+    Send_Debug_Data("\r\n=== HMI VP Transactions ===\r\n");
+    snprintf(msg, sizeof(msg), "Write frames: %lu (%lu words, %lu elided)\r\n",
+             vp_frames_written, vp_words_written, vp_writes_elided);
+    Send_Debug_Data(msg);
+    snprintf(msg, sizeof(msg), "Input polls: %lu sent, %lu replies, dirty: 0x%05lX\r\n",
+             vp_polls_sent, vp_poll_replies, vp_out_dirty);
+    Send_Debug_Data(msg);
+    Send_Debug_Data("===========================\r\n\r\n");
+}
+
+/* === Circular-DMA HMI receiver ===
+ * UART4 RX runs on circular DMA with IDLE-line events: bytes land in
+ * hmi_rx_dma_buf with zero CPU cost, and the event callback walks the new
+ * region, reassembles DWIN frames (5A A5, length, payload) and pushes them
+ * to a frame queue that HMI_Process() drains. Touch events survive even
+ * when the main loop is busy with the W5500 or SD card. */
+
+#define HMI_RX_DMA_BUF_SIZE     128
+#define HMI_RX_MAX_FRAME        64
+#define HMI_RX_QUEUE_SIZE       8
+
+typedef struct {
+    uint8_t data[HMI_RX_MAX_FRAME];
+    uint8_t length;
+} HMI_RxFrame_t;
+
+static uint8_t hmi_rx_dma_buf[HMI_RX_DMA_BUF_SIZE] DCACHE_ALIGNED;
+static uint16_t hmi_rx_dma_pos = 0;         // Last consumed DMA position
+
+static HMI_RxFrame_t hmi_rx_queue[HMI_RX_QUEUE_SIZE];
+static volatile uint8_t hmi_rx_q_head = 0;
+static volatile uint8_t hmi_rx_q_tail = 0;
+static uint32_t hmi_rx_dropped = 0;         // Frames dropped on full queue
+static uint32_t hmi_rx_resyncs = 0;         // Parser resyncs on bad header
+
+// Frame reassembly state (frames can straddle IDLE events)
+static uint8_t hmi_rx_frame[HMI_RX_MAX_FRAME];
+static uint8_t hmi_rx_frame_len = 0;
+
+/**
+ * @brief Push an assembled frame to the RX queue
+ * @note  Interrupt context
+ */
+static void HMI_RX_QueueFrame(const uint8_t *data, uint8_t length) {
+    uint8_t next_head = (hmi_rx_q_head + 1) % HMI_RX_QUEUE_SIZE;
+    if (next_head == hmi_rx_q_tail) {
+        hmi_rx_dropped++;
+        return;
+    }
+    memcpy(hmi_rx_queue[hmi_rx_q_head].data, data, length);
+    hmi_rx_queue[hmi_rx_q_head].length = length;
+    hmi_rx_q_head = next_head;
+}
+
+/**
+ * @brief Feed one received byte to the DWIN frame reassembler
+ * @note  Interrupt context
+ */
+static void HMI_RX_FeedByte(uint8_t byte) {
+    if (hmi_rx_frame_len == 0) {
+        if (byte != DWIN_HEADER_BYTE1) { hmi_rx_resyncs++; return; }
+    } else if (hmi_rx_frame_len == 1) {
+        if (byte != DWIN_HEADER_BYTE2) {
+            hmi_rx_frame_len = 0;
+            hmi_rx_resyncs++;
+            // The byte could itself start a new header
+            if (byte == DWIN_HEADER_BYTE1) hmi_rx_frame[hmi_rx_frame_len++] = byte;
+            return;
+        }
+    }
+
+    if (hmi_rx_frame_len < HMI_RX_MAX_FRAME) {
+        hmi_rx_frame[hmi_rx_frame_len++] = byte;
+    } else {
+        hmi_rx_frame_len = 0;               // Oversized - drop and resync
+        hmi_rx_resyncs++;
+        return;
+    }
+
+    // Header (2) + length byte received - check for completion
+    if (hmi_rx_frame_len >= 3) {
+        uint16_t expected_total = 3 + hmi_rx_frame[2];
+        if (expected_total > HMI_RX_MAX_FRAME) {
+            hmi_rx_frame_len = 0;
+            hmi_rx_resyncs++;
+        } else if (hmi_rx_frame_len >= expected_total) {
+            HMI_RX_QueueFrame(hmi_rx_frame, (uint8_t)expected_total);
+            hmi_rx_frame_len = 0;
+        }
+    }
+}
+
+/**
+ * @brief UART4 RX event (IDLE line / DMA wrap) - consume new DMA bytes
+ * @param Size Current DMA write position in the circular buffer
+ * @note  Interrupt context, called from the central UART dispatcher
+ */
+void HMI_RxEventCallback(uint16_t Size) {
+    DCache_InvalidateRange(hmi_rx_dma_buf, sizeof(hmi_rx_dma_buf));  // DMA wrote behind the cache
+    while (hmi_rx_dma_pos != Size) {
+        HMI_RX_FeedByte(hmi_rx_dma_buf[hmi_rx_dma_pos]);
+        hmi_rx_dma_pos = (hmi_rx_dma_pos + 1) % HMI_RX_DMA_BUF_SIZE;
+    }
+    EventQueue_Post(EVENT_HMI_FRAME_RX, 0, Size);  // Wake the HMI task
+}
+
+/**
+ * @brief UART4 error (overrun, framing) - restart circular reception
+ * @note  Interrupt context
+ */
+void HMI_ErrorCallback(void) {
+    hmi_rx_dma_pos = 0;
+    hmi_rx_frame_len = 0;
+    HAL_UARTEx_ReceiveToIdle_DMA(&huart4, hmi_rx_dma_buf, HMI_RX_DMA_BUF_SIZE);
+}
+
+/**
+ * @brief Pop the next complete DWIN frame from the RX queue
+ * @param data Destination buffer (at least HMI_RX_MAX_FRAME bytes)
+ * @return Frame length, or 0 if the queue is empty
+ */
+uint8_t HMI_RX_GetFrame(uint8_t *data) {
+    if (hmi_rx_q_head == hmi_rx_q_tail) return 0;
+    uint8_t length = hmi_rx_queue[hmi_rx_q_tail].length;
+    memcpy(data, hmi_rx_queue[hmi_rx_q_tail].data, length);
+    hmi_rx_q_tail = (hmi_rx_q_tail + 1) % HMI_RX_QUEUE_SIZE;
+    return length;
+}
+
+/**
+ * @brief Frames dropped because the RX queue was full
+ */
+uint32_t HMI_RX_GetDroppedFrames(void) {
+    return hmi_rx_dropped;
+}
+
+// CRC calculation for DWIN HMI commands - table-driven kernels in crc_util.c
+uint16_t Calculate_CRC16(uint8_t* data, uint8_t length) {
+    return CRC16_Modbus(data, length);
+}
+
+// Alternative CRC-8 calculation (some DWIN models use CRC-8)
+uint8_t Calculate_CRC8(uint8_t* data, uint8_t length) {
+    return CRC8_Calculate(data, length);
 }
 
 // Simple checksum (sum of all bytes)
@@ -381,9 +832,89 @@ void HMI_Capture(void) {
     }
 }
 
+// ============================================================================
+// Page tracking - which panel page the operator is looking at
+// ============================================================================
+
+static uint8_t hmi_current_page = HMI_PAGE_MAIN;
+
+/**
+ * @brief Page a VP address is displayed on (drives the dirty-diff
+ *        scheduler in ch_control_core.c - off-screen VPs can wait)
+ */
+uint8_t HMI_PageForVP(uint16_t vp_address) {
+    switch (vp_address) {
+        case HMI_VP_TEMP:
+        case HMI_VP_PRESSURE:
+        case HMI_VP_FLOW:
+        case HMI_VP_LEVEL:
+        case HMI_VP_NETWORK_STATUS:
+        case HMI_VP_MODBUS_STATUS:
+        case HMI_VP_BTN_RESET:
+        case HMI_VP_BTN_TEST:
+            return HMI_PAGE_MAIN;
+
+        case HMI_VP_RELAY_Q06:
+        case HMI_VP_RELAY_Q07:
+        case HMI_VP_MESSAGE_COUNT:
+        case HMI_VP_BTN_RELAY_Q06:
+        case HMI_VP_BTN_RELAY_Q07:
+            return HMI_PAGE_IO;
+
+        default:
+            return HMI_PAGE_ANY;    // Status/time banner VPs show everywhere
+    }
+}
+
+uint8_t HMI_GetCurrentPage(void) {
+    return hmi_current_page;
+}
+
+/**
+ * @brief Update the tracked page from a received DWIN frame: picture-ID
+ *        read responses carry the page directly, and a touch on a VP
+ *        proves its page is on-screen
+ */
+static void HMI_TrackPageFromFrame(const uint8_t *frame, uint8_t length) {
+    if (length < 7 || frame[3] != DWIN_CMD_READ_VAR) return;
+
+    uint16_t address = ((uint16_t)frame[4] << 8) | frame[5];
+
+    if (address == DWIN_REG_PIC_ID && length >= 9) {
+        // 5A A5 06 83 00 03 01 PAGE_H PAGE_L
+        hmi_current_page = frame[8];
+    } else if (address >= 0x1000 && length >= 9) {
+        uint8_t page = HMI_PageForVP(address);
+        if (page != HMI_PAGE_ANY) {
+            hmi_current_page = page;
+        }
+    }
+}
+
 // NO SENDING OF COMMANDS - just monitor what's already working
 HMI_StatusTypeDef HMI_Process(void) {
-    HMI_Capture();
+    static uint8_t prof_id = PROFILER_INVALID_SECTION;
+    if (prof_id == PROFILER_INVALID_SECTION) {
+        prof_id = Profiler_RegisterSection("HMI_Process");
+    }
+
+    Profiler_Begin(prof_id);
+
+    // Drain complete DWIN frames delivered by the circular DMA receiver
+    uint8_t frame[HMI_RX_MAX_FRAME];
+    uint8_t length;
+    while ((length = HMI_RX_GetFrame(frame)) > 0) {
+        HMI_TrackPageFromFrame(frame, length);
+        HMI_VP_IngestReadReply(frame, length);
+        memcpy(hmi_buffer, frame, length);
+        hmi_index = length;
+        Show_Complete_Message();
+    }
+
+    // Batched VP writes and the input-window poll ride the same task
+    HMI_VP_Process();
+
+    Profiler_End(prof_id);
     return HMI_OK;
 }
 
@@ -632,37 +1163,10 @@ void HMI_Process_With_Version_Check(void) {
 }
 
 void HMI_Send_With_Proper_Timing(uint8_t* data, uint8_t size, const char* description) {
-    // Step 1: Ensure we start in receive mode
-    HAL_GPIO_WritePin(HMI_DE_RE_GPIO_Port, HMI_DE_RE_Pin, GPIO_PIN_RESET);
-    HAL_Delay(10);  // Let bus and transceiver settle
-    
-    // Step 2: Clear any pending RX data
-    while (__HAL_UART_GET_FLAG(&huart4, UART_FLAG_RXNE)) {
-        volatile uint8_t dummy = huart4.Instance->RDR;
-        (void)dummy;
-    }
-    
-    // Step 3: Switch to transmit mode with proper timing
-    HAL_GPIO_WritePin(HMI_DE_RE_GPIO_Port, HMI_DE_RE_Pin, GPIO_PIN_SET);
-    HAL_Delay(10);  // CRITICAL: Wait for transceiver to switch to TX mode
-    
-    // Step 4: Send data
-    HAL_StatusTypeDef result = HAL_UART_Transmit(&huart4, data, size, 2000);
-    
-    // Step 5: Wait for transmission to complete (CRITICAL)
-    while(__HAL_UART_GET_FLAG(&huart4, UART_FLAG_TC) == RESET) {
-        // Wait for transmission complete flag
-    }
-    
-    // Step 6: Additional delay to ensure last bit is fully transmitted
-    HAL_Delay(5);  // Ensure all bits are on the bus
-    
-    // Step 7: Switch back to receive mode
-    HAL_GPIO_WritePin(HMI_DE_RE_GPIO_Port, HMI_DE_RE_Pin, GPIO_PIN_RESET);
-    
-    // Step 8: Small delay before expecting response
-    HAL_Delay(5);  // Let transceiver switch to RX and bus settle
-    
+    // Timing (direction switching, TX completion, inter-frame gap) is now
+    // handled by the SysTick-driven TX state machine - just enqueue.
+    uint8_t queued = HMI_TX_Enqueue(data, size, HMI_TX_DEFAULT_GAP_MS);
+
     // Debug output
     Send_Debug_Data("HMI TX: ");
     for (int i = 0; i < size; i++) {
@@ -671,9 +1175,9 @@ void HMI_Send_With_Proper_Timing(uint8_t* data, uint8_t size, const char* descri
         Send_Debug_Data(hex_str);
     }
     char msg[100];
-    snprintf(msg, sizeof(msg), "(%s) - Status: %s\r\n", 
-             description, 
-             (result == HAL_OK) ? "OK" : "FAILED");
+    snprintf(msg, sizeof(msg), "(%s) - %s\r\n",
+             description,
+             queued ? "QUEUED" : "QUEUE FULL");
     Send_Debug_Data(msg);
 }
 
@@ -3379,30 +3883,14 @@ void HMI_Improved_Page_Test(void) {
     Send_Debug_Data("=== END IMPROVED TEST ===\r\n\r\n");
 }
 
-// Add this function to start interrupt reception:
+// Start circular DMA reception with IDLE-line frame delimiting.
+// Replaces the old byte-by-byte HAL_UART_Receive_IT scheme.
 void HMI_Start_Interrupt_RX(void) {
     if (!hmi_interrupt_active) {
         hmi_interrupt_active = 1;
-        HAL_UART_Receive_IT(&huart4, hmi_rx_buffer, 1);
-        Send_Debug_Data("UART4 interrupt RX started\r\n");
-    }
-}
-
-// Add this callback function (called automatically when data arrives):
-void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart) {
-    if (huart->Instance == UART4) {
-        // Data received in hmi_rx_buffer[0]
-        uint8_t received_byte = hmi_rx_buffer[0];
-        
-        // Store in your HMI buffer
-        if (hmi_index < sizeof(hmi_buffer)) {
-            hmi_buffer[hmi_index] = received_byte;
-            hmi_index++;
-            hmi_last_time = HAL_GetTick();
-        }
-        
-        // Restart reception for next byte
-        HAL_UART_Receive_IT(&huart4, hmi_rx_buffer, 1);
+        hmi_rx_dma_pos = 0;
+        HAL_UARTEx_ReceiveToIdle_DMA(&huart4, hmi_rx_dma_buf, HMI_RX_DMA_BUF_SIZE);
+        Send_Debug_Data("UART4 circular DMA RX started\r\n");
     }
 }
 
@@ -3431,6 +3919,9 @@ void HMI_Process_Debug_Command(const char* command) {
         // Test one page change
         HMI_Correct_Page_Change();
     }
+    else if (strncmp(command, "hmi_vp", 6) == 0) {
+        HMI_VP_PrintStatus();
+    }
     else if (strncmp(command, "hmi_hw_test", 11) == 0) {
         HMI_Hardware_RX_Test();
     }
@@ -3558,12 +4049,18 @@ void HMI_Test_Page_Status(void) {
  */
 void HMI_Write_VP_Register(uint16_t address, uint16_t value)
 {
-    // TODO: Implement HMI register write
-    // This is a placeholder for HMI integration
-    // For now, just send debug message
-    char msg[50];
-    snprintf(msg, sizeof(msg), "HMI Write: 0x%04X = %d\r\n", address, value);
-    Send_Debug_Data(msg);
+    // DWIN write VP: 5A A5 05 82 ADDR_H ADDR_L DATA_H DATA_L
+    uint8_t frame[8];
+    frame[0] = DWIN_HEADER_BYTE1;
+    frame[1] = DWIN_HEADER_BYTE2;
+    frame[2] = 0x05;                    // Length: cmd + addr + data
+    frame[3] = DWIN_CMD_WRITE_VAR;
+    frame[4] = (address >> 8) & 0xFF;
+    frame[5] = address & 0xFF;
+    frame[6] = (value >> 8) & 0xFF;
+    frame[7] = value & 0xFF;
+
+    HMI_TX_Enqueue(frame, sizeof(frame), HMI_TX_DEFAULT_GAP_MS);
 }
 
 // Add this function to hmi.c
@@ -3572,8 +4069,9 @@ void HMI_Send_Cyclic_Commands(void)
     // Placeholder implementation for cyclic HMI commands
     // This would typically send periodic status updates to the HMI
     if (HMI_Is_Initialized()) {
-        // Send system status updates
-        HMI_Write_VP_Register(HMI_VP_STATUS, HMI_STATUS_RUNNING);
-        HMI_Write_VP_Register(HMI_VP_SYSTEM_TIME, (uint16_t)(HAL_GetTick() / 1000));
+        // Staged through the shadow cache - unchanged values never hit
+        // the bus, adjacent dirty VPs leave in one frame
+        HMI_VP_Set(HMI_VP_STATUS, HMI_STATUS_RUNNING);
+        HMI_VP_Set(HMI_VP_SYSTEM_TIME, (uint16_t)(HAL_GetTick() / 1000));
     }
 }
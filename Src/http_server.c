@@ -0,0 +1,267 @@
+/**
+ * @file    http_server.c
+ * @brief   Non-Blocking HTTP Server with Keep-Alive on W5500 Socket 0
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * Minimal HTTP/1.1 server for the SCADA dashboard. Connections are kept
+ * alive between polls so the 2-second status poll does not pay a TCP
+ * handshake every time. The /status endpoint streams system state as
+ * chunked JSON, one chunk per Process() pass, straight from the live
+ * control structures - no giant staging buffer. Static responses are
+ * const flash strings sent without copies through the burst TX path.
+ */
+
+#include "http_server.h"
+#include "w5500_socket.h"
+#include "ch_control_core.h"
+#include "ch_temp_control.h"
+#include "ch_staging.h"
+#include "gpio_manager.h"
+#include "uart_comm.h"
+#include <string.h>
+#include <stdio.h>
+
+/* DI/DO mirrors declared in http_server.h - refreshed from the GPIO
+ * manager before each status response */
+uint8_t di_status[8];
+uint8_t do_status[8];
+
+/* Connection state machine */
+typedef enum {
+    HTTP_STATE_CLOSED = 0,
+    HTTP_STATE_LISTENING,
+    HTTP_STATE_CONNECTED,           // Keep-alive, waiting for a request
+    HTTP_STATE_STREAMING            // Emitting /status chunks
+} http_state_t;
+
+#define HTTP_KEEPALIVE_TIMEOUT_MS   15000
+#define HTTP_STREAM_PHASES          4
+
+static http_state_t http_state = HTTP_STATE_CLOSED;
+static uint32_t http_last_activity = 0;
+static uint8_t http_stream_phase = 0;
+static uint32_t http_requests_served = 0;
+
+/* Static responses live in flash and are sent without staging copies */
+static const char http_resp_status_header[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: application/json\r\n"
+    "Connection: keep-alive\r\n"
+    "Transfer-Encoding: chunked\r\n"
+    "\r\n";
+
+static const char http_resp_index[] =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: text/plain\r\n"
+    "Connection: keep-alive\r\n"
+    "Content-Length: 42\r\n"
+    "\r\n"
+    "Chiller controller online. Try /status.\r\n";
+
+static const char http_resp_404[] =
+    "HTTP/1.1 404 Not Found\r\n"
+    "Connection: keep-alive\r\n"
+    "Content-Length: 0\r\n"
+    "\r\n";
+
+/* Private Functions ---------------------------------------------------------*/
+
+/**
+ * @brief Send one chunked-encoding chunk: size line, payload and
+ *        trailer go into the TX window as three fragments, one SEND
+ */
+static uint16_t HTTP_SendChunk(uint8_t sn, const char *data, uint16_t length)
+{
+    char size_line[12];
+    int size_len = snprintf(size_line, sizeof(size_line), "%X\r\n", length);
+
+    w5500_tx_fragment_t frags[3] = {
+        { (const uint8_t*)size_line, (uint16_t)size_len },
+        { (const uint8_t*)data, length },
+        { (const uint8_t*)"\r\n", 2 }
+    };
+    return W5500_Socket_SendVectored(sn, frags, 3);
+}
+
+/**
+ * @brief Refresh the DI/DO mirrors from the GPIO manager
+ */
+static void HTTP_RefreshIOStatus(void)
+{
+    for (uint8_t i = 0; i < 8; i++) {
+        di_status[i] = Input_Read(i);
+        do_status[i] = Relay_Get(i);
+    }
+}
+
+/**
+ * @brief Emit the next /status JSON chunk (one per Process pass)
+ */
+static void HTTP_StreamStatusChunk(uint8_t sn)
+{
+    char chunk[160];
+    int len = 0;
+
+    switch (http_stream_phase) {
+        case 0:
+            len = snprintf(chunk, sizeof(chunk),
+                    "{\"uptime_s\":%lu,\"state\":%u,\"mode\":%u,",
+                    HAL_GetTick() / 1000,
+                    (unsigned)ChillerCore_GetSystemState(),
+                    (unsigned)ChillerCore_GetCurrentMode());
+            break;
+
+        case 1:
+            len = snprintf(chunk, sizeof(chunk),
+                    "\"supply_c\":%.1f,\"return_c\":%.1f,\"ambient_c\":%.1f,"
+                    "\"setpoint_c\":%.1f,\"pid_pct\":%.1f,",
+                    TempControl_GetSupplyWaterTemp(),
+                    TempControl_GetReturnWaterTemp(),
+                    TempControl_GetAmbientTemp(),
+                    TempControl_GetSetpoint(),
+                    TempControl_GetPIDOutput());
+            break;
+
+        case 2:
+            len = snprintf(chunk, sizeof(chunk),
+                    "\"compressors\":%u,\"condensers\":%u,\"capacity_pct\":%.1f,"
+                    "\"faults\":%lu,",
+                    Staging_GetRunningCompressorCount(),
+                    Staging_GetRunningCondenserCount(),
+                    Staging_GetCurrentCapacityPercent(),
+                    (uint32_t)ChillerCore_GetActiveFaults());
+            break;
+
+        case 3:
+        default:
+            HTTP_RefreshIOStatus();
+            len = snprintf(chunk, sizeof(chunk),
+                    "\"di\":[%u,%u,%u,%u,%u,%u,%u,%u],"
+                    "\"do\":[%u,%u,%u,%u,%u,%u,%u,%u]}",
+                    di_status[0], di_status[1], di_status[2], di_status[3],
+                    di_status[4], di_status[5], di_status[6], di_status[7],
+                    do_status[0], do_status[1], do_status[2], do_status[3],
+                    do_status[4], do_status[5], do_status[6], do_status[7]);
+            break;
+    }
+
+    if (HTTP_SendChunk(sn, chunk, (uint16_t)len) == 0) {
+        return;     // TX window full - retry this phase next pass
+    }
+
+    if (http_stream_phase >= HTTP_STREAM_PHASES - 1) {
+        /* Terminating zero-length chunk ends the response; connection
+         * stays open for the next poll */
+        W5500_Socket_SendData(sn, (const uint8_t*)"0\r\n\r\n", 5);
+        http_stream_phase = 0;
+        http_state = HTTP_STATE_CONNECTED;
+        http_requests_served++;
+    } else {
+        http_stream_phase++;
+    }
+    http_last_activity = HAL_GetTick();
+}
+
+/* Public Functions ----------------------------------------------------------*/
+
+/**
+ * @brief Initialize HTTP server socket and start listening
+ */
+void HTTP_Server_Init(void)
+{
+    if (W5500_Socket_Init_TCP_Server(HTTP_SOCKET, HTTP_PORT)) {
+        http_state = HTTP_STATE_LISTENING;
+        Send_Debug_Data("HTTP Server: Listening on port 80\r\n");
+    } else {
+        http_state = HTTP_STATE_CLOSED;
+        Send_Debug_Data("HTTP Server: Socket init failed\r\n");
+    }
+    http_stream_phase = 0;
+}
+
+/**
+ * @brief Parse a request line and start the matching response
+ */
+void HTTP_HandleRequest(uint8_t sn, char* request)
+{
+    if (strncmp(request, "GET /status", 11) == 0) {
+        /* Header now, JSON body streamed chunk-by-chunk from Process */
+        W5500_Socket_SendData(sn, (const uint8_t*)http_resp_status_header,
+                              sizeof(http_resp_status_header) - 1);
+        http_stream_phase = 0;
+        http_state = HTTP_STATE_STREAMING;
+    } else if (strncmp(request, "GET / ", 6) == 0 ||
+               strncmp(request, "GET /\r", 6) == 0) {
+        HTTP_SendResponse(sn);
+    } else {
+        W5500_Socket_SendData(sn, (const uint8_t*)http_resp_404,
+                              sizeof(http_resp_404) - 1);
+    }
+    http_last_activity = HAL_GetTick();
+}
+
+/**
+ * @brief Serve the static index response (const flash string, no copy)
+ */
+void HTTP_SendResponse(uint8_t sn)
+{
+    W5500_Socket_SendData(sn, (const uint8_t*)http_resp_index,
+                          sizeof(http_resp_index) - 1);
+    http_requests_served++;
+}
+
+/**
+ * @brief Non-blocking HTTP state machine (call from the main loop)
+ */
+void HTTP_Server_Process(void)
+{
+    if (http_state == HTTP_STATE_CLOSED) return;
+
+    uint8_t status = W5500_Socket_GetStatus(HTTP_SOCKET);
+
+    switch (status) {
+        case W5500_SOCK_ESTABLISHED:
+            if (http_state == HTTP_STATE_LISTENING) {
+                http_state = HTTP_STATE_CONNECTED;
+                http_last_activity = HAL_GetTick();
+            }
+
+            if (http_state == HTTP_STATE_STREAMING) {
+                HTTP_StreamStatusChunk(HTTP_SOCKET);
+                break;
+            }
+
+            /* Keep-alive: wait for the next request on the open pipe */
+            if (W5500_Socket_GetRxReceivedSize(HTTP_SOCKET) > 0) {
+                char request[BUFFER_SIZE];
+                uint16_t len = W5500_Socket_ReceiveData(HTTP_SOCKET,
+                                                        (uint8_t*)request,
+                                                        sizeof(request) - 1);
+                if (len > 0) {
+                    request[len] = '\0';
+                    HTTP_HandleRequest(HTTP_SOCKET, request);
+                }
+            } else if (HAL_GetTick() - http_last_activity > HTTP_KEEPALIVE_TIMEOUT_MS) {
+                /* Idle dashboard went away - reclaim the socket */
+                W5500_Socket_Disconnect(HTTP_SOCKET);
+            }
+            break;
+
+        case W5500_SOCK_CLOSE_WAIT:
+            /* Peer closed - finish the FIN handshake */
+            W5500_Socket_Disconnect(HTTP_SOCKET);
+            break;
+
+        case W5500_SOCK_CLOSED:
+            /* Dropped out of LISTEN (disconnect/reset) - re-arm */
+            HTTP_Server_Init();
+            break;
+
+        default:
+            /* LISTEN and transient TCP states - nothing to do */
+            break;
+    }
+}
@@ -23,12 +23,32 @@
 #include "flash_25q16.h"
 #include "hmi.h"
 #include "sd_card.h"
+#include "sd_ring_log.h"
+#include "flash_journal.h"
+#include "flash_async.h"
+#include "http_server.h"
+#include "tcp_cli.h"
+#include "event_queue.h"
+#include "debug_log.h"
+#include "cpu_load.h"
+#include "timebase.h"
 #include "equipment_config.h"
 #include "flash_config.h"
 #include "ch_control_core.h"
+#include "ch_control_path.h"
 #include "ch_safety.h"
 #include "ch_temp_control.h"
 #include "ch_staging.h"
+#include "scheduler.h"
+#include "profiler.h"
+#include "fixed_point.h"
+#include "fmt_util.h"
+#include "block_pool.h"
+#include "watchdog.h"
+#include "warm_restart.h"
+#include "fault_intake.h"
+#include "control_tick.h"
+#include "benchmark.h"
 #include <stdlib.h>  // For atof function
 
 /* Private define ------------------------------------------------------------*/
@@ -65,6 +85,7 @@ uint16_t sensor_level = 75;
 /* Private function prototypes -----------------------------------------------*/
 void SystemClock_Config(void);
 static void MPU_Config(void);
+static void CPU_Cache_Enable(void);
 void Process_DebugCommands(char* command);
 void Display_SystemStatus(void);
 
@@ -87,6 +108,426 @@ void SD_Card_Auto_Status_Report(void);
 void SD_Card_Run_Full_Auto_Test(void);
 void SD_Card_Display_Auto_Test_Config(void);
 
+/* ========================================================================== */
+/* SCHEDULER TASKS                                                            */
+/* The old superloop interleaved everything with ad-hoc HAL_GetTick() checks. */
+/* Each block is now a registered task with a period and priority; the        */
+/* scheduler measures per-task runtimes ('sched_stats' on the console).       */
+/* ========================================================================== */
+
+/* Task IDs captured at registration so the event dispatcher can wake
+ * the owning task ahead of its polling period */
+static uint8_t task_id_safety;
+static uint8_t task_id_modbus;
+static uint8_t task_id_gpio;
+static uint8_t task_id_hmi;
+static uint8_t task_id_http;
+static uint8_t task_id_tcp_cli;
+static uint8_t task_id_tcp_srv;
+static uint8_t task_id_sd_card;
+static uint8_t task_id_flash;
+
+/* ========================================================================== */
+/* BOOT SEQUENCING                                                            */
+/* The safety-critical path (GPIO, config, control core, Modbus) comes up    */
+/* synchronously in main(); everything else is staged through Task_BootBringup */
+/* so compressor staging starts well before the network or SD card is ready. */
+/* Each stage is a profiler section - 'profile' shows per-stage boot cost.   */
+/* ========================================================================== */
+
+typedef enum {
+    BOOT_STAGE_NET_PHY = 0,             // W5500 SPI bring-up and self-test
+    BOOT_STAGE_NET_CONFIG,              // IP config, HTTP server, TCP CLI
+    BOOT_STAGE_FLASH,                   // External flash memory
+    BOOT_STAGE_HMI,                     // DWIN panel link
+    BOOT_STAGE_SD,                      // SD card and ring log mount
+    BOOT_STAGE_DONE
+} BootStage_t;
+
+static BootStage_t boot_stage = BOOT_STAGE_NET_PHY;
+static uint8_t boot_prof_id = PROFILER_INVALID_SECTION;
+
+static void Boot_StageBegin(const char* name)
+{
+    boot_prof_id = Profiler_RegisterSection(name);
+    Profiler_Begin(boot_prof_id);
+}
+
+static void Boot_StageEnd(void)
+{
+    Profiler_End(boot_prof_id);
+}
+
+/**
+ * @brief Background bring-up state machine - one stage per invocation
+ */
+static void Task_BootBringup(void)
+{
+    switch (boot_stage) {
+        case BOOT_STAGE_NET_PHY:
+            Boot_StageBegin("BootNetPhy");
+            SPI_W5500_Init();
+            if (W5500_SelfTest()) {
+                w5500_initialized = 1;
+                Send_Debug_Data("W5500 SelfTest: PASSED!\r\n");
+            } else {
+                w5500_initialized = 0;
+                HAL_GPIO_WritePin(RUN_LED_PORT, RUN_LED_PIN, GPIO_PIN_RESET);
+                HAL_GPIO_WritePin(STOP_LED_PORT, STOP_LED_PIN, GPIO_PIN_SET);
+                Send_Debug_Data("W5500 SelfTest: FAILED!\r\n");
+            }
+            Boot_StageEnd();
+            boot_stage = BOOT_STAGE_NET_CONFIG;
+            break;
+
+        case BOOT_STAGE_NET_CONFIG:
+            Boot_StageBegin("BootNetCfg");
+            if (w5500_initialized && W5500_Init()) {
+                uint8_t mac[6] = {0x00, 0x08, 0xDC, 0x12, 0x34, 0x56};
+                uint8_t ip[4] = {192, 168, 8, 100};
+                uint8_t subnet[4] = {255, 255, 255, 0};
+                uint8_t gateway[4] = {192, 168, 8, 1};
+
+                W5500_ConfigureNetwork(mac, ip, subnet, gateway);
+
+                uint8_t read_ip[4];
+                W5500_GetIPConfig(read_ip, NULL, NULL, NULL);
+                char msg[100];
+                snprintf(msg, sizeof(msg), "IP Configured: %d.%d.%d.%d\r\n",
+                         read_ip[0], read_ip[1], read_ip[2], read_ip[3]);
+                Send_Debug_Data(msg);
+
+                // Data server buffer plan first - resizing socket
+                // buffers wipes them, so it runs before any socket opens
+                TCP_Server_Init(TCP_SERVER_PORT);
+
+                // HTTP status server (SCADA dashboard, port 80)
+                HTTP_Server_Init();
+
+                // TCP debug CLI (remote diagnostics, port 2323)
+                TCP_CLI_Init();
+
+                // Data/telemetry/log-export pool across the remaining
+                // sockets - listeners spin up from TCP_Server_Process
+                TCP_Server_Start();
+            } else if (w5500_initialized) {
+                Send_Debug_Data("W5500: Initialization FAILED!\r\n");
+            }
+            Boot_StageEnd();
+            boot_stage = BOOT_STAGE_FLASH;
+            break;
+
+        case BOOT_STAGE_FLASH:
+            Boot_StageBegin("BootFlash");
+            if (Flash_Init() == 0) {
+                flash_initialized = 1;
+            } else {
+                flash_initialized = 0;
+                Send_Debug_Data("Flash Memory: INITIALIZATION FAILED\r\n");
+            }
+            Boot_StageEnd();
+            boot_stage = BOOT_STAGE_HMI;
+            break;
+
+        case BOOT_STAGE_HMI:
+            Boot_StageBegin("BootHMI");
+            if (HMI_Init() == 1) {
+                HMI_Set_Initialized(1);
+            } else {
+                Send_Debug_Data("HMI: Initialization failed\r\n");
+                HMI_Set_Initialized(0);
+            }
+            Boot_StageEnd();
+            boot_stage = BOOT_STAGE_SD;
+            break;
+
+        case BOOT_STAGE_SD:
+            Boot_StageBegin("BootSD");
+            // Basic initialization only - diagnostics stay behind the
+            // console commands instead of delaying bring-up
+            if (SD_Card_Init() == SD_CARD_OK) {
+                sd_card_initialized = 1;
+                // Mount the append-only ring log for sensor/alarm history
+                SDLog_Init();
+            } else {
+                sd_card_initialized = 0;
+            }
+            Boot_StageEnd();
+            boot_stage = BOOT_STAGE_DONE;
+
+            {
+                char msg[80];
+                snprintf(msg, sizeof(msg),
+                         "Boot: background bring-up complete at %lu ms\r\n",
+                         HAL_GetTick());
+                Send_Debug_Data(msg);
+            }
+            break;
+
+        case BOOT_STAGE_DONE:
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Drain the ISR event queue and wake the owning tasks
+ * @note  Runs every scheduler pass - the single choke point between
+ *        interrupt sources and main-loop consumers
+ */
+static void Task_EventDispatch(void)
+{
+    event_t event;
+
+    while (EventQueue_Pop(&event)) {
+        switch (event.type) {
+            case EVENT_MODBUS_FRAME_RX:
+                Scheduler_RequestRun(task_id_modbus);
+                break;
+            case EVENT_HMI_FRAME_RX:
+                Scheduler_RequestRun(task_id_hmi);
+                break;
+            case EVENT_SOCKET_EVENT:
+                Scheduler_RequestRun(task_id_http);
+                Scheduler_RequestRun(task_id_tcp_cli);
+                Scheduler_RequestRun(task_id_tcp_srv);
+                break;
+            case EVENT_SD_WRITE_DONE:
+                Scheduler_RequestRun(task_id_sd_card);
+                break;
+            case EVENT_INPUT_EDGE:
+                Scheduler_RequestRun(task_id_gpio);
+                break;
+            case EVENT_SAFETY_TRIP:
+                // Control tick ISR already dropped the relays; run the
+                // safety task now for the alarm/lockout bookkeeping
+                Scheduler_RequestRun(task_id_safety);
+                break;
+            case EVENT_FLASH_OP_DONE:
+                // Wake the engine so the next queued op starts right away
+                Scheduler_RequestRun(task_id_flash);
+                break;
+            case EVENT_TIMER:
+                // Callback-less software timer fired (param = timer ID);
+                // consumers subscribe here as they appear
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+/**
+ * @brief Network link supervision - log link up/down transitions
+ */
+static void Task_NetworkLink(void)
+{
+    static uint8_t last_link_state = 0xFF;
+
+    if (!w5500_initialized) return;
+
+    uint8_t link_is_up = W5500_CheckLinkStatus() ? 1 : 0;
+    if (link_is_up != last_link_state) {
+        last_link_state = link_is_up;
+        Send_Debug_Data(link_is_up ? "Network Link: UP\r\n"
+                                   : "Network Link: DOWN\r\n");
+    }
+}
+
+/**
+ * @brief Modbus RTU sensor engine
+ */
+static void Task_Modbus(void)
+{
+    if (modbus_initialized) {
+        Modbus_System_Process();
+    }
+}
+
+/**
+ * @brief HTTP status server state machine
+ */
+static void Task_HTTPServer(void)
+{
+    if (w5500_initialized) {
+        HTTP_Server_Process();
+    }
+}
+
+/**
+ * @brief TCP debug CLI state machine
+ */
+static void Task_TCPCLI(void)
+{
+    if (w5500_initialized) {
+        TCP_CLI_Process();
+    }
+}
+
+/**
+ * @brief Data/telemetry server socket pool (w5500_tcp_server.c)
+ */
+static void Task_TCPServer(void)
+{
+    if (w5500_initialized) {
+        TCP_Server_Process();
+    }
+}
+
+/**
+ * @brief Equipment configuration periodic tasks
+ */
+static void Task_EquipmentConfig(void)
+{
+    EquipmentConfig_ProcessPeriodicTasks();
+}
+
+/**
+ * @brief Flash configuration periodic tasks
+ */
+static void Task_FlashConfig(void)
+{
+    FlashConfig_ProcessPeriodicTasks();
+}
+
+/**
+ * @brief Background flash erase/program engine pump
+ */
+static void Task_FlashAsync(void)
+{
+    FlashAsync_Process();
+}
+
+/**
+ * @brief Deferred log formatting and transmission
+ */
+static void Task_LogPump(void)
+{
+    DebugLog_Pump();
+}
+
+/**
+ * @brief Bounded fault queue drain (fan-out to flash log and debug)
+ */
+static void Task_FaultDrain(void)
+{
+    FaultIntake_Process();
+}
+
+/**
+ * @brief Chiller core control
+ */
+static void Task_ChillerCore(void)
+{
+    ChillerCore_Process();
+}
+
+/**
+ * @brief Safety system supervision
+ */
+static void Task_Safety(void)
+{
+    Safety_Process();
+}
+
+/**
+ * @brief Temperature control loop
+ */
+static void Task_TempControl(void)
+{
+    TempControl_Process();
+}
+
+/**
+ * @brief Compressor staging
+ */
+static void Task_Staging(void)
+{
+    Staging_Process();
+}
+
+/**
+ * @brief GPIO input scanning and periodic status display
+ */
+static void Task_GPIOMonitor(void)
+{
+    if (!gpio_manager_initialized) return;
+
+    Monitor_Input_Changes_Continuous();
+}
+
+/**
+ * @brief Periodic GPIO status display (60s software timer)
+ */
+static void Timer_GPIOStatus(void)
+{
+    if (gpio_manager_initialized) {
+        Display_GPIO_Status();
+    }
+}
+
+/**
+ * @brief HMI communication processing
+ */
+static void Task_HMI(void)
+{
+    if (HMI_Is_Initialized()) {
+        HMI_Process();
+    }
+}
+
+/**
+ * @brief Run LED heartbeat
+ */
+static void Task_LedBlink(void)
+{
+    HAL_GPIO_TogglePin(RUN_LED_GPIO_Port, RUN_LED_PIN);
+}
+
+/**
+ * @brief SD card processing - safe mode
+ */
+static void Task_SDCard(void)
+{
+    SD_Card_Process();
+}
+
+/**
+ * @brief Kick the IWDG when all critical tasks have checked in
+ */
+static void Task_Watchdog(void)
+{
+    Watchdog_Process();
+}
+
+/**
+ * @brief Register all application tasks with the cooperative scheduler
+ */
+static void Register_ApplicationTasks(void)
+{
+    Scheduler_RegisterTask("events",     Task_EventDispatch,    0, SCHED_PRIO_CRITICAL);
+    task_id_safety = Scheduler_RegisterTask("safety", Task_Safety,     20, SCHED_PRIO_CRITICAL);
+    Scheduler_RegisterTask("core",       Task_ChillerCore,     50, SCHED_PRIO_CRITICAL);
+    Scheduler_RegisterTask("temp_ctrl",  Task_TempControl,     50, SCHED_PRIO_HIGH);
+    Scheduler_RegisterTask("staging",    Task_Staging,        100, SCHED_PRIO_HIGH);
+    task_id_modbus  = Scheduler_RegisterTask("modbus",     Task_Modbus,          10, SCHED_PRIO_HIGH);
+    task_id_gpio    = Scheduler_RegisterTask("gpio",       Task_GPIOMonitor,     10, SCHED_PRIO_HIGH);
+    task_id_hmi     = Scheduler_RegisterTask("hmi",        Task_HMI,             10, SCHED_PRIO_NORMAL);
+    Scheduler_RegisterTask("net_link",   Task_NetworkLink,   2000, SCHED_PRIO_NORMAL);
+    task_id_http    = Scheduler_RegisterTask("http",       Task_HTTPServer,      50, SCHED_PRIO_NORMAL);
+    task_id_tcp_cli = Scheduler_RegisterTask("tcp_cli",    Task_TCPCLI,          50, SCHED_PRIO_NORMAL);
+    task_id_tcp_srv = Scheduler_RegisterTask("tcp_srv",    Task_TCPServer,       50, SCHED_PRIO_NORMAL);
+    Scheduler_RegisterTask("equip_cfg",  Task_EquipmentConfig, 100, SCHED_PRIO_NORMAL);
+    Scheduler_RegisterTask("flash_cfg",  Task_FlashConfig,    100, SCHED_PRIO_LOW);
+    task_id_flash   = Scheduler_RegisterTask("flash_op",   Task_FlashAsync,      10, SCHED_PRIO_NORMAL);
+    task_id_sd_card = Scheduler_RegisterTask("sd_card",    Task_SDCard,         100, SCHED_PRIO_LOW);
+    Scheduler_RegisterTask("faults",     Task_FaultDrain,      50, SCHED_PRIO_HIGH);
+    Scheduler_RegisterTask("log",        Task_LogPump,         50, SCHED_PRIO_LOW);
+    Scheduler_RegisterTask("led",        Task_LedBlink,       500, SCHED_PRIO_LOW);
+    Scheduler_RegisterTask("boot",       Task_BootBringup,     50, SCHED_PRIO_LOW);
+    Scheduler_RegisterTask("watchdog",   Task_Watchdog,       100, SCHED_PRIO_CRITICAL);
+}
+
 /**
   * @brief  The application entry point.
   * @retval int
@@ -95,6 +536,7 @@ int main(void)
 {
   /* MCU Configuration--------------------------------------------------------*/
   MPU_Config();
+  CPU_Cache_Enable();
   HAL_Init();
   SystemClock_Config();
   MX_GPIO_Init();
@@ -106,244 +548,99 @@ int main(void)
 
   /* Initialize peripherals */
   Init_UARTs();
-  HAL_Delay(100);
   Send_Debug_Data("=== SYSTEM STARTUP ===\r\n");
   Send_Debug_Data("STM32H7B0VB Chiller Control System\r\n");
-  Send_Debug_Data("GPIO Manager + Network + Modbus Integration\r\n");
 
   // Turn on RUN_LED, turn off STOP_LED
   HAL_GPIO_WritePin(RUN_LED_PORT, RUN_LED_PIN, GPIO_PIN_SET);
   HAL_GPIO_WritePin(STOP_LED_PORT, STOP_LED_PIN, GPIO_PIN_RESET);
 
-  /* === GPIO MANAGER INITIALIZATION === */
-  Send_Debug_Data("=== Initializing GPIO Manager ===\r\n");
+  /* Scheduler/profiler/events come up first so the boot stages below
+   * can be timed and the non-critical bring-up can run as a task */
+  Scheduler_Init();
+  Profiler_Init();
+  EventQueue_Init();
+  DebugLog_Init();
+  Timebase_Init();          /* CYCCNT is running (Profiler_Init above) */
+  Timebase_Register("gpio_stat", Timer_GPIOStatus, 60000, TIMEBASE_PERIODIC);
+  FaultIntake_Init();
+  CpuLoad_Calibrate();      /* Idle baseline - before any task registers */
+
+  /* === FAST-BOOT CRITICAL PATH ===
+   * Only what compressor staging needs runs synchronously: relay GPIO,
+   * configuration, the control/safety cores and the Modbus sensor
+   * engine. Networking, HMI, flash memory and SD bring-up continue in
+   * the background ('boot' task) after control is already running.
+   * Per-stage timings land in the profiler ('profile' command). */
+  Boot_StageBegin("BootGPIO");
   GPIO_Manager_Init();
   gpio_manager_initialized = 1;
-  Send_Debug_Data("GPIO Manager: 16 Relays + 16 Inputs ready\r\n");
-
-  // Show available GPIO commands
-  Send_Debug_Data("Available GPIO Commands:\r\n");
-  // Send_Debug_Data("- relay_test : Test all relays\r\n");
-  Send_Debug_Data("- input_monitor : Monitor inputs\r\n");
-  Send_Debug_Data("- gpio_help : Show all commands\r\n");
-
-   // Initialize SPI for W5500
-  SPI_W5500_Init();
-
-  // Test SPI
-  SPI_W5500_Test_Communication();
-
-  // Test W5500
-  W5500_Test_CS();
-  W5500_Test_Reset();
-
-  // Run self-test
-  if (W5500_SelfTest()) {
-      w5500_initialized = 1;
-      Send_Debug_Data("W5500 SelfTest: PASSED!\r\n");
-  } else {
-      w5500_initialized = 0;
-      HAL_GPIO_WritePin(RUN_LED_PORT, RUN_LED_PIN, GPIO_PIN_RESET);
-      HAL_GPIO_WritePin(STOP_LED_PORT, STOP_LED_PIN, GPIO_PIN_SET);
-      Send_Debug_Data("W5500 SelfTest: FAILED!\r\n");
-  }
-
- /* === EQUIPMENT CONFIGURATION INITIALIZATION === */
-Send_Debug_Data("=== Initializing Equipment Configuration ===\r\n");
-if (EquipmentConfig_Init() == EQUIPMENT_STATUS_OK) {
-    Send_Debug_Data("Equipment Configuration: READY\r\n");
-} else {
-    Send_Debug_Data("Equipment Configuration: FAILED\r\n");
-}
- 
-  // === MODBUS SENSOR INITIALIZATION ===
-  Modbus_System_Init();  // Initialize everything
-  Modbus_System_SetInterval(60000);  // Set to 60 seconds instead of 10
-  modbus_initialized = 1;  // Enable Modbus in main loop
-
-  // === ADD MODBUS INIT AND FIRST READ AFTER NETWORK IS UP ===
-  if (w5500_initialized && W5500_Init()) {
-      Send_Debug_Data("=== W5500 Network Initialized ===\r\n");
-
-      uint8_t mac[6] = {0x00, 0x08, 0xDC, 0x12, 0x34, 0x56};
-      uint8_t ip[4] = {192, 168, 8, 100};
-      uint8_t subnet[4] = {255, 255, 255, 0};
-      uint8_t gateway[4] = {192, 168, 8, 1};
-
-      W5500_ConfigureNetwork(mac, ip, subnet, gateway);
-
-      uint8_t read_ip[4];
-      W5500_GetIPConfig(read_ip, NULL, NULL, NULL);
-      char msg[100];
-      snprintf(msg, sizeof(msg), "IP Configured: %d.%d.%d.%d\r\n",
-               read_ip[0], read_ip[1], read_ip[2], read_ip[3]);
-      Send_Debug_Data(msg);
+  Boot_StageEnd();
 
-      // === MODBUS FIRST READ AFTER NETWORK IS UP ===
-      Modbus_System_Start();  // Single line to start first read
-
-      // Turn ON Relays Q0.6 and Q0.7 using GPIO Manager - DISABLED
-      // if (gpio_manager_initialized) {
-      //     Relay_Set(6, 1);  // Q0.6 (relay index 6)
-      //     Relay_Set(7, 1);  // Q0.7 (relay index 7)
-      //     Send_Debug_Data("Relays Q0.6 and Q0.7: ON (via GPIO Manager)\r\n");
-      // } else {
-      //     // Fallback to direct GPIO control
-      //     HAL_GPIO_WritePin(Q0_6_PORT, Q0_6_PIN, GPIO_PIN_SET);
-      //     HAL_GPIO_WritePin(Q0_7_PORT, Q0_7_PIN, GPIO_PIN_SET);
-      //     Send_Debug_Data("Relays Q0.6 and Q0.7: ON (direct GPIO)\r\n");
-      // }
-      
-      Send_Debug_Data("All relays initialized to OFF state\r\n");
-  } else {
-      Send_Debug_Data("W5500: Initialization FAILED!\r\n");
+  Boot_StageBegin("BootConfig");
+  if (EquipmentConfig_Init() != EQUIPMENT_STATUS_OK) {
+      Send_Debug_Data("Equipment Configuration: FAILED\r\n");
   }
-
-  /* === FLASH MEMORY INITIALIZATION === */
-  if (Flash_Init() == 0) {
-      flash_initialized = 1;
-  } else {
-      flash_initialized = 0;
-      Send_Debug_Data("Flash Memory: INITIALIZATION FAILED\r\n");
+  if (FlashConfig_Init() != FLASH_CONFIG_OK) {
+      Send_Debug_Data("Flash Config: FAILED\r\n");
   }
+  FlashAsync_Init();        // Boot-time writes above stay synchronous
+  Boot_StageEnd();
 
-  /* === HMI INITIALIZATION === */
-  Send_Debug_Data("=== Initializing HMI Communication ===\r\n");
-  if (HMI_Init() == 1) {
-      Send_Debug_Data("HMI: Initialization successful\r\n");
-      HMI_Set_Initialized(1);
-  } else {
-      Send_Debug_Data("HMI: Initialization failed\r\n");
-      HMI_Set_Initialized(0);
+  Boot_StageBegin("BootControl");
+  if (ChillerCore_Init() != CH_FAULT_NONE) {
+      Send_Debug_Data("Chiller Core: INITIALIZATION FAILED\r\n");
   }
-
-  /* === SD CARD INITIALIZATION - CLEAN === */
-  // Use only basic initialization - no debug spam
-  if (SD_Card_Init() == SD_CARD_OK) {
-      sd_card_initialized = 1;
-      
-      // Run automatic tests silently (no debug output)
-      SD_Card_Run_Automatic_Tests();
-      
-  } else {
-      sd_card_initialized = 0;
+  if (!Safety_Init()) {
+      Send_Debug_Data("ERROR: Safety system initialization failed!\r\n");
+  }
+  if (!TempControl_Init()) {
+      Send_Debug_Data("ERROR: Temperature control init failed!\r\n");
+  }
+  if (!Staging_Init()) {
+      Send_Debug_Data("ERROR: Staging initialization failed\r\n");
   }
 
-  Send_Debug_Data("=== System Initialization Complete ===\r\n");
-  Send_Debug_Data("All systems ready - entering main loop\r\n");
-
-  /* Infinite loop */
-  while (1)
-  {
-    /* --- Task 1: W5500 Network Maintenance --- */
-    if (w5500_initialized) {
-        // This static variable belongs to the W5500 task
-        static uint32_t link_check_time = 0;
-        
-        // Check link status periodically
-        if (HAL_GetTick() - link_check_time > 2000) {
-            link_check_time = HAL_GetTick();
-            // All the original link up/down logic goes here
-            uint8_t link_is_up = W5500_CheckLinkStatus();
-            if (link_is_up) {
-                // Link up logic (your original code)
-                static uint8_t link_up_logged = 0;
-                if (!link_up_logged) {
-                    Send_Debug_Data("Network Link: UP\r\n");
-                    link_up_logged = 1;
-                }
-            } else {
-                // Link down logic (your original code)
-                static uint8_t link_down_logged = 0;
-                if (!link_down_logged) {
-                    Send_Debug_Data("Network Link: DOWN\r\n");
-                    link_down_logged = 1;
-                }
-            }
-        }
-        // You would also put TCP_Server_Process() here if you were using it
-    }
-
-    /* --- Task 2: Modbus Sensor Processing --- */
-    if (modbus_initialized) {
-        Modbus_System_Process();
-        // HAL_Delay(1000);  // REMOVE THIS - it's blocking the main loop
-    }
-/* --- Task 6: Equipment Configuration Processing --- */
-EquipmentConfig_ProcessPeriodicTasks();
-
-   /* --- Task 6: Flash Configuration Processing --- */
-FlashConfig_ProcessPeriodicTasks();
-
-   /* --- Task 7: Chiller Core Control Processing --- */
-ChillerCore_Process();
+  /* Warm restart: must run before Watchdog_Init clears the RCC reset
+   * flags. Resumes the saved running set after a soft/IWDG reset
+   * instead of cold-starting the plant */
+  WarmRestart_Init();
+  WarmRestart_TryRestore();
+  Timebase_Register("warm_mirror", WarmRestart_Mirror, 1000, TIMEBASE_PERIODIC);
+  Boot_StageEnd();
 
-   /* --- Task 8: Safety System Processing --- */
-Safety_Process();  // Add this line to your existing tasks
+  Boot_StageBegin("BootModbus");
+  Modbus_System_Init();
+  Modbus_System_SetInterval(60000);
+  Modbus_System_Start();
+  modbus_initialized = 1;
+  Boot_StageEnd();
 
-   /* --- Task 9: Temperature Control Processing --- */
-TempControl_Process();  // Add this line after Safety_Process()
+  Register_ApplicationTasks();
 
-   /* --- Task 10: Chiller Staging Processing --- */
-Staging_Process();
+  /* Arm the IWDG last: the critical task set is registered, post-mortem
+   * from the previous run (if any) is reported inside Init */
+  Watchdog_Init();
 
-    /* --- Task 3: GPIO Manager Processing --- */
-    if (gpio_manager_initialized) {
-        // Monitor input changes continuously
-        Monitor_Input_Changes_Continuous();
-        
-        // Non-blocking output test - runs every 30 seconds (completely silent)
-        // static uint32_t auto_output_test_time = 0;
-        // static uint8_t test_started = 0;
-        
-        // Start test every 30 seconds (silent)
-        // if (!Test_Is_Running() && (HAL_GetTick() - auto_output_test_time > 30000)) {
-        //     auto_output_test_time = HAL_GetTick();
-        //     test_started = 1;
-        //     // Completely silent - no debug messages
-        // }
-        
-        // Run the non-blocking test
-        // if (test_started) {
-        //     Test_All_Outputs_NonBlocking();
-        //     if (!Test_Is_Running()) {
-        //         test_started = 0;
-        //     }
-        // }
-        
-        // Periodic GPIO status display every 60 seconds (only if inputs active)
-        static uint32_t gpio_status_time = 0;
-        if (HAL_GetTick() - gpio_status_time > 60000) {
-            gpio_status_time = HAL_GetTick();
-            Display_GPIO_Status();
-        }
-    }
-
-    /* --- Task 4: Flash Memory Test --- */
-    if (flash_initialized) {
-        // Flash memory tested during boot - no periodic operations
-        // Flash is ready for use when needed
-    }
+  /* Start the 10ms TIM7 control tick: PID + trip scan now preempt the
+   * comms superloop instead of waiting behind it */
+  ControlTick_Init();
 
-    /* --- Task 4: HMI Processing --- */
-    if (HMI_Is_Initialized()) {
-        HMI_Process();
-    }
-
-    /* --- Task 5: UI / Debug Output --- */
-    // LED blinking task (keep this)
-    static uint32_t last_blink_time = 0;
-    if (HAL_GetTick() - last_blink_time > 500) {
-        last_blink_time = HAL_GetTick();
-        HAL_GPIO_TogglePin(RUN_LED_GPIO_Port, RUN_LED_PIN);
-    }
-
-    /* --- Task 7: SD Card Processing - SAFE MODE --- */
-    SD_Card_Process();              // Keep existing function
-    // SD_Card_Auto_Test_Process();    // REMOVED - causes hangs
+  {
+      char msg[80];
+      snprintf(msg, sizeof(msg),
+               "Boot: control path ready in %lu ms, background bring-up started\r\n",
+               HAL_GetTick());
+      Send_Debug_Data(msg);
+  }
 
+  /* Infinite loop - all periodic work runs as scheduler tasks */
+  while (1)
+  {
+    Scheduler_Process();
+    Timebase_Process();
+    CpuLoad_IdleHook();
     message_count++;
-    // Removed other debug output
   }
 }
 
@@ -388,6 +685,21 @@ void Process_DebugCommands(char* command)
     else if (strncmp(command, "modbus_disable", 14) == 0) {
         Modbus_System_Disable();
     }
+    else if (strncmp(command, "sched_stats", 11) == 0) {
+        Scheduler_PrintTable();
+    }
+    else if (strncmp(command, "profile_reset", 13) == 0) {
+        Profiler_Reset();
+    }
+    else if (strncmp(command, "profile", 7) == 0) {
+        Profiler_PrintReport();
+    }
+    else if (strncmp(command, "debug_stats", 11) == 0) {
+        char msg[80];
+        snprintf(msg, sizeof(msg), "Debug TX ring: %lu messages dropped\r\n",
+                 Debug_GetOverflowDrops());
+        Send_Debug_Data(msg);
+    }
 else if (strncmp(command, "hmi", 3) == 0) {
         HMI_Process_Debug_Command(command);
     }
@@ -400,6 +712,85 @@ else if (strncmp(command, "hmi", 3) == 0) {
     else if (strncmp(command, "sd_capacity", 11) == 0) {
         SD_Card_Capacity_Test();
     }
+    else if (strncmp(command, "sd_queue", 8) == 0) {
+        SD_Card_WriteQueue_Stats();
+    }
+    else if (strncmp(command, "sdlog_flush", 11) == 0) {
+        SDLog_Flush();
+        Send_Debug_Data("SDLog: Flush requested\r\n");
+    }
+    else if (strncmp(command, "sdlog", 5) == 0) {
+        SDLog_PrintStatus();
+    }
+    else if (strncmp(command, "journal", 7) == 0) {
+        FJournal_PrintStatus();
+    }
+    else if (strncmp(command, "fasync", 6) == 0) {
+        FlashAsync_PrintStats();
+    }
+    else if (strncmp(command, "ctlpath", 7) == 0) {
+        ControlPath_PrintStatus();
+    }
+    else if (strncmp(command, "loglevel", 8) == 0) {
+        DebugLog_HandleCommand(strlen(command) > 9 ? command + 9 : NULL);
+    }
+    else if (strncmp(command, "logstat", 7) == 0) {
+        DebugLog_PrintStatus();
+    }
+    else if (strncmp(command, "cpuload", 7) == 0) {
+        CpuLoad_PrintStatus();
+    }
+    else if (strncmp(command, "events", 6) == 0) {
+        EventQueue_PrintStatus();
+    }
+    else if (strncmp(command, "timers", 6) == 0) {
+        Timebase_PrintStatus();
+    }
+    else if (strncmp(command, "warm", 4) == 0) {
+        WarmRestart_PrintStatus();
+    }
+    else if (strncmp(command, "faults", 6) == 0) {
+        FaultIntake_PrintStatus();
+    }
+    else if (strncmp(command, "bench", 5) == 0) {
+        // 'bench' runs all cases, 'bench <name>' runs one
+        const char *arg = command + 5;
+        while (*arg == ' ') arg++;
+        Benchmark_Run(arg);
+    }
+    else if (strncmp(command, "fxbench", 7) == 0) {
+        FixedPoint_Benchmark();
+    }
+    else if (strncmp(command, "fmtbench", 8) == 0) {
+        Fmt_Benchmark();
+    }
+    else if (strncmp(command, "pools", 5) == 0) {
+        BlockPool_PrintStats();
+    }
+    else if (strncmp(command, "wdg", 3) == 0) {
+        Watchdog_PrintStatus();
+    }
+    else if (strncmp(command, "tick", 4) == 0) {
+        ControlTick_PrintStats();
+    }
+    else if (strncmp(command, "mb_slaves", 9) == 0) {
+        Modbus_PrintSlaveTable();
+    }
+    else if (strncmp(command, "safety_checks", 13) == 0) {
+        Safety_PrintCheckTable();
+    }
+    else if (strncmp(command, "staging_sched", 13) == 0) {
+        Staging_PrintSchedule();
+    }
+    else if (strncmp(command, "perf_dump", 9) == 0) {
+        SDLog_DumpPerfRecords(64);
+    }
+    else if (strncmp(command, "net_stats_reset", 15) == 0) {
+        W5500_Socket_ResetStats();
+    }
+    else if (strncmp(command, "net_stats", 9) == 0) {
+        W5500_Socket_PrintStats();
+    }
     else if (strncmp(command, "sd_status", 9) == 0) {
         SD_Card_Status_Display();
     }
@@ -435,12 +826,10 @@ else if (strncmp(command, "sd_recovery", 11) == 0) {
     SD_Card_Emergency_Recovery();
 }
 else if (strncmp(command, "sd_reset", 8) == 0) {
-    Send_Debug_Data("Resetting SD card to 1-bit mode...\r\n");
-    HAL_SD_DeInit(&hsd1);
-    HAL_Delay(100);
-    // sd_card_initialized = 0; // This line is removed as per the edit hint
-    // sd_card_present = 0; // This line is removed as per the edit hint
-    Send_Debug_Data("SD card reset complete\r\n");
+    // Non-blocking: the lifecycle machine in SD_Card_Process() releases
+    // the bus, waits out the settle time and re-initializes in stages
+    Send_Debug_Data("Resetting SD card interface...\r\n");
+    SD_Card_Manual_Detection();
 }
 else if (strncmp(command, "sd_detect", 9) == 0) {
     SD_Card_Manual_Detection();
@@ -593,6 +982,9 @@ void Display_SystemStatus(void)
     snprintf(msg, sizeof(msg), "MCU: STM32H7B0VB @ %luMHz\r\n", HAL_RCC_GetSysClockFreq() / 1000000);
     Send_Debug_Data(msg);
 
+    snprintf(msg, sizeof(msg), "CPU Load: %u%%\r\n", CpuLoad_GetPercent());
+    Send_Debug_Data(msg);
+
     Send_Debug_Data("Flash: 128KB, RAM: ~1.4MB\r\n");
 
     // System component status
@@ -604,14 +996,10 @@ void Display_SystemStatus(void)
 
     snprintf(msg, sizeof(msg), "GPIO Manager: %s\r\n", gpio_manager_initialized ? "ACTIVE" : "INACTIVE");
     Send_Debug_Data(msg);
- 
-/* === FLASH CONFIG INITIALIZATION === */
-Send_Debug_Data("=== Initializing Flash Configuration ===\r\n");
-if (FlashConfig_Init() == FLASH_CONFIG_OK) {
-    Send_Debug_Data("Flash Config: READY\r\n");
-} else {
-    Send_Debug_Data("Flash Config: FAILED\r\n");
-}
+
+    snprintf(msg, sizeof(msg), "Flash Config: %s\r\n", flash_initialized ? "READY" : "OFFLINE");
+    Send_Debug_Data(msg);
+
     // Show active relays
     Send_Debug_Data("Active Relays: ");
     uint8_t active_relays = 0;
@@ -627,39 +1015,9 @@ if (FlashConfig_Init() == FLASH_CONFIG_OK) {
     if (active_relays == 0) Send_Debug_Data("None");
     Send_Debug_Data("\r\n");
 
-/* === CHILLER CORE INITIALIZATION === */
-Send_Debug_Data("=== Initializing Chiller Control Core ===\r\n");
-ChillerFaultCode_t core_result = ChillerCore_Init();
-if (core_result == CH_FAULT_NONE) {
-    Send_Debug_Data("Chiller Core: READY\r\n");
-} else {
-    Send_Debug_Data("Chiller Core: INITIALIZATION FAILED\r\n");
-}
-
-/* === SAFETY SYSTEM INITIALIZATION === */
-Send_Debug_Data("=== Initializing Safety System ===\r\n");
-if (!Safety_Init()) {
-    Send_Debug_Data("ERROR: Safety system initialization failed!\r\n");
-} else {
-    Send_Debug_Data("Safety System: READY\r\n");
-}
-
-/* === TEMPERATURE CONTROL SYSTEM INITIALIZATION === */
-Send_Debug_Data("=== Initializing Temperature Control System ===\r\n");
-if (!TempControl_Init()) {
-    Send_Debug_Data("ERROR: Temperature control system initialization failed!\r\n");
-} else {
-    Send_Debug_Data("Temperature Control System: READY\r\n");
-}
+    // Control subsystems are initialized once on the boot critical path
+    // (see main); this is purely a status report now
 
-/* --- Task 7: Chiller Staging Processing --- */
-Send_Debug_Data("=== Initializing Chiller Staging System ===\r\n");
-if (!Staging_Init()) {
-    Send_Debug_Data("ERROR: Staging initialization failed\r\n");
-} else {
-    Send_Debug_Data("Chiller Staging System: READY\r\n");
-}
- 
     // Show active inputs
     Send_Debug_Data("Active Inputs: ");
     uint8_t active_inputs = 0;
@@ -791,6 +1149,19 @@ static void MPU_Config(void)
   HAL_MPU_Enable(MPU_PRIVILEGED_DEFAULT);
 }
 
+/**
+  * @brief  Enable the Cortex-M7 instruction and data caches
+  * @note   Without them every instruction fetch and data access pays
+  *         flash/AXI latency - the single largest performance lever on
+  *         this part. DMA buffers stay in cacheable RAM; the drivers
+  *         clean/invalidate at their DMA boundaries (see dcache_util.h).
+  */
+static void CPU_Cache_Enable(void)
+{
+  SCB_EnableICache();
+  SCB_EnableDCache();
+}
+
 /**
   * @brief  This function is executed in case of error occurrence.
   */
@@ -2,14 +2,20 @@
 /**
   * @file    modbus_sensor.c
   * @brief   Modbus RTU driver for DS18B20 Temperature Sensor Board
+  *          Non-blocking engine: UART8 RX DMA + IDLE-line frame detection
   * @author  Industrial Chiller Control
-  * @version 1.0
+  * @version 2.0
   * @date    2025
   */
 /* USER CODE END Header */
 
 #include "modbus_sensor.h"
 #include "main.h"
+#include "profiler.h"
+#include "crc_util.h"
+#include "dcache_util.h"
+#include "fmt_util.h"
+#include "event_queue.h"
 #include <string.h>
 
 // Add this line:
@@ -17,10 +23,20 @@ extern UART_HandleTypeDef huart8;
 
 // Static buffer for Modbus communication
 static uint8_t modbus_tx_buf[8];
-static uint8_t modbus_rx_buf[25];  // Max: 1 byte ID + 1 byte func + 1 byte byte-count + 16*2 data + 2 CRC
+static uint8_t modbus_rx_buf[32] DCACHE_ALIGNED;  // Max: 1 byte ID + 1 byte func + 1 byte byte-count + 12*2 data + 2 CRC
+
+// Engine state machine - replaces the old blocking Modbus_Transceive()
+static volatile ModbusEngineState_t modbus_engine_state = MODBUS_ENGINE_IDLE;
+static ModbusRequestType_t modbus_request_type = MODBUS_REQ_NONE;
+static uint16_t modbus_expected_len = 0;
+static uint32_t modbus_response_timeout = 500;   // Per-request response window (ms)
+static uint32_t modbus_tx_start_time = 0;
+static uint32_t modbus_retry_time = 0;
+static uint8_t  modbus_retry_count = 0;
+static volatile uint16_t modbus_rx_frame_len = 0;
+static volatile uint8_t  modbus_rx_frame_ready = 0;
 
 // Global variables for Modbus state machine
-static uint8_t modbus_state = 0;
 static uint32_t modbus_last_request = 0;
 static uint32_t modbus_request_interval = 30000; // 30 seconds between requests
 static float last_temperatures[8] = {0};
@@ -33,93 +49,418 @@ static uint8_t modbus_initialized = 0;
 // Global system control
 static uint8_t modbus_system_enabled = 0;
 
+// Multi-drop slave table: slot 0 is the supply/return temperature board,
+// polled fast; auxiliary boards are configured at runtime and polled slow.
+// Dead slaves back off exponentially so they stop taxing bus latency.
+static ModbusSlave_t modbus_slaves[MODBUS_MAX_SLAVES];
+static uint8_t modbus_active_slave = 0;     // Slot owning the in-flight request
+static uint8_t modbus_rr_cursor = 0;        // Round-robin fairness cursor
+
+// Double-buffered published snapshot: the back buffer is filled when a
+// poll cycle of the primary slave completes, then the live index flips.
+// Consumers read through Modbus_GetSnapshot() and always see one
+// coherent, timestamped view of the whole register block.
+static ModbusSnapshot_t modbus_snapshots[2];
+static volatile uint8_t modbus_snapshot_live = 0;
+
+// Engine constants
+#define MODBUS_TX_TIMEOUT_MS        100     // TX of 8 bytes @ 9600 is ~8ms; generous margin
+#define MODBUS_RETRY_DELAY_MS       250     // Back-off between retries (non-blocking)
+#define MODBUS_MAX_RETRIES          3
+
 /**
-  * @brief  Calculate Modbus RTU CRC-16
-  * @param  data: Pointer to data array
-  * @param  length: Number of bytes
-  * @retval CRC-16 value
+  * @brief  Build a function-code-3 (Read Holding Registers) request in modbus_tx_buf
+  * @param  start_reg: First register address
+  * @param  reg_count: Number of registers to read
   */
-static uint16_t Modbus_CRC16(uint8_t *data, uint16_t length) {
-    uint16_t crc = 0xFFFF;
-    for (int i = 0; i < length; i++) {
-        crc ^= data[i];
-        for (int j = 0; j < 8; j++) {
-            if (crc & 0x0001) {
-                crc >>= 1;
-                crc ^= 0xA001;
-            } else {
-                crc >>= 1;
-            }
-        }
-    }
-    return crc;
+static void Modbus_BuildReadRequest(uint8_t slave_address, uint16_t start_reg, uint16_t reg_count) {
+    modbus_tx_buf[0] = slave_address;
+    modbus_tx_buf[1] = 0x03;  // Read Holding Registers
+    modbus_tx_buf[2] = (start_reg >> 8) & 0xFF;
+    modbus_tx_buf[3] = start_reg & 0xFF;
+    modbus_tx_buf[4] = (reg_count >> 8) & 0xFF;
+    modbus_tx_buf[5] = reg_count & 0xFF;
+    uint16_t crc = CRC16_Modbus(modbus_tx_buf, 6);
+    modbus_tx_buf[6] = crc & 0xFF;
+    modbus_tx_buf[7] = (crc >> 8) & 0xFF;
 }
 
 /**
-  * @brief  Send Modbus request and receive response
-  * @param  tx_buf: Transmit buffer
-  * @param  tx_len: Length of data to send
-  * @param  rx_buf: Receive buffer
-  * @param  rx_len: Expected response length
-  * @param  timeout_ms: Response timeout
-  * @retval 1 if success, 0 if failure
+  * @brief  Start a non-blocking Modbus transaction
+  * @param  slave_index: Slot in the slave table (selects the bus address)
+  * @param  type: Request type (selects the response parser)
+  * @param  start_reg: First register address
+  * @param  reg_count: Number of registers
+  * @param  expected_len: Expected response length in bytes
+  * @retval 1 if the request was started, 0 if the engine is busy
   */
-static uint8_t Modbus_Transceive(uint8_t *tx_buf, uint16_t tx_len, uint8_t *rx_buf, uint16_t rx_len, uint32_t timeout_ms) {
-    // Clear UART receive buffer first
-    uint8_t dummy;
-    while (HAL_UART_Receive(MODBUS_UART, &dummy, 1, 1) == HAL_OK) {
-        // Clear any pending data
+static uint8_t Modbus_StartRequest(uint8_t slave_index, ModbusRequestType_t type,
+                                   uint16_t start_reg, uint16_t reg_count,
+                                   uint16_t expected_len) {
+    if (modbus_engine_state != MODBUS_ENGINE_IDLE) {
+        return 0;  // Transaction already in flight - caller retries next cycle
     }
-    
-    // Add debug output
-    char msg[100];
-    snprintf(msg, sizeof(msg), "Modbus TX: %02X %02X %02X %02X %02X %02X %02X %02X\r\n", 
-             tx_buf[0], tx_buf[1], tx_buf[2], tx_buf[3], tx_buf[4], tx_buf[5], tx_buf[6], tx_buf[7]);
-    Send_Debug_Data(msg);
-    
-    // Enable DE (Transmit)
+
+    modbus_active_slave = slave_index;
+    Modbus_BuildReadRequest(modbus_slaves[slave_index].address, start_reg, reg_count);
+
+    modbus_request_type = type;
+    modbus_expected_len = expected_len;
+    modbus_rx_frame_ready = 0;
+    modbus_rx_frame_len = 0;
+
+    // Enable DE (Transmit) - released in the TX-complete interrupt
     HAL_GPIO_WritePin(MODBUS_DE_PORT, MODBUS_DE_PIN, GPIO_PIN_SET);
-    HAL_UART_Transmit(MODBUS_UART, tx_buf, tx_len, timeout_ms);
+
+    if (HAL_UART_Transmit_IT(MODBUS_UART, modbus_tx_buf, 8) != HAL_OK) {
+        HAL_GPIO_WritePin(MODBUS_DE_PORT, MODBUS_DE_PIN, GPIO_PIN_RESET);
+        return 0;
+    }
+
+    modbus_tx_start_time = HAL_GetTick();
+    modbus_engine_state = MODBUS_ENGINE_TX;
+    return 1;
+}
+
+/**
+  * @brief  TX complete callback (called from uart_comm.c dispatcher, interrupt context)
+  *         Drops DE and arms the DMA receiver with IDLE-line frame detection
+  */
+void Modbus_TxCpltCallback(void) {
+    // Release the RS485 bus and listen for the response
     HAL_GPIO_WritePin(MODBUS_DE_PORT, MODBUS_DE_PIN, GPIO_PIN_RESET);
 
-    // Wait before receiving - increase delay
-    HAL_Delay(10);  // Increase from 2ms to 10ms
+    if (HAL_UARTEx_ReceiveToIdle_DMA(MODBUS_UART, modbus_rx_buf, sizeof(modbus_rx_buf)) == HAL_OK) {
+        modbus_engine_state = MODBUS_ENGINE_WAIT_RX;
+    } else {
+        modbus_engine_state = MODBUS_ENGINE_ERROR;
+    }
+}
+
+/**
+  * @brief  RX event callback (called from uart_comm.c dispatcher, interrupt context)
+  *         Fires on IDLE line - i.e. end of slave response frame
+  * @param  size: Number of bytes received into modbus_rx_buf
+  */
+void Modbus_RxEventCallback(uint16_t size) {
+    DCache_InvalidateRange(modbus_rx_buf, sizeof(modbus_rx_buf));  // DMA wrote behind the cache
+    modbus_rx_frame_len = size;
+    modbus_rx_frame_ready = 1;
+    EventQueue_Post(EVENT_MODBUS_FRAME_RX, 0, size);  // Wake the engine task
+}
+
+/**
+  * @brief  UART error callback (called from uart_comm.c dispatcher, interrupt context)
+  */
+void Modbus_ErrorCallback(void) {
+    modbus_engine_state = MODBUS_ENGINE_ERROR;
+}
 
-    // Receive response
-    HAL_StatusTypeDef rx_status = HAL_UART_Receive(MODBUS_UART, rx_buf, rx_len, timeout_ms);
-    if (rx_status != HAL_OK) {
-        snprintf(msg, sizeof(msg), "Modbus RX FAILED: Status=%d\r\n", rx_status);
-        Send_Debug_Data(msg);
-        return 0;
+/**
+  * @brief  Record a failed poll of the active slave: bump the error stats
+  *         and push its next poll out with an exponential back-off so a
+  *         dead probe stops costing a full timeout every cycle
+  */
+static void Modbus_SlaveOnFailure(void) {
+    ModbusSlave_t* slave = &modbus_slaves[modbus_active_slave];
+
+    slave->consecutive_failures++;
+    slave->split_phase = 0;     // Restart any split sequence from the top
+
+    if (slave->backoff_ms == 0) {
+        slave->backoff_ms = MODBUS_BACKOFF_BASE_MS;
+    } else if (slave->backoff_ms < MODBUS_BACKOFF_MAX_MS) {
+        slave->backoff_ms *= 2;
+        if (slave->backoff_ms > MODBUS_BACKOFF_MAX_MS) {
+            slave->backoff_ms = MODBUS_BACKOFF_MAX_MS;
+        }
     }
+    slave->next_poll_time = HAL_GetTick() + slave->backoff_ms;
 
-    // Show received data
-    snprintf(msg, sizeof(msg), "Modbus RX: ");
-    Send_Debug_Data(msg);
-    for (int i = 0; i < rx_len; i++) {
-        snprintf(msg, sizeof(msg), "%02X ", rx_buf[i]);
+    if (slave->online && slave->consecutive_failures >= MODBUS_DEAD_THRESHOLD) {
+        slave->online = 0;
+        char msg[80];
+        snprintf(msg, sizeof(msg), "Modbus: Slave 0x%02X OFFLINE (backoff %lu ms)\r\n",
+                 slave->address, slave->backoff_ms);
         Send_Debug_Data(msg);
     }
-    Send_Debug_Data("\r\n");
+}
 
-    // Validate response length and CRC
-    if (rx_len < 3) {
-        Send_Debug_Data("Modbus: Response too short\r\n");
-        return 0;
+/**
+  * @brief  Fill the back buffer from the primary slave's data and flip
+  *         the live index - one atomic publication per poll cycle
+  */
+static void Modbus_PublishSnapshot(void) {
+    ModbusSnapshot_t* back = &modbus_snapshots[modbus_snapshot_live ^ 1];
+    const ModbusSlave_t* slave = &modbus_slaves[0];
+
+    uint16_t valid_mask = 0;
+    for (int i = 0; i < MAX_SENSORS; i++) {
+        back->temperatures[i] = slave->temperatures[i];
+        if (slave->temperatures[i] > -999.0f) {
+            valid_mask |= (1 << i);
+        }
     }
-    uint16_t crc = Modbus_CRC16(rx_buf, rx_len - 2);
-    uint16_t received_crc = (rx_buf[rx_len - 1] << 8) | rx_buf[rx_len - 2];
-    
-    if (crc != received_crc) {
-        snprintf(msg, sizeof(msg), "Modbus CRC FAILED: Calc=0x%04X, Recv=0x%04X\r\n", crc, received_crc);
+    back->valid_mask = valid_mask;
+    back->sensor_count = slave->sensor_count;
+    back->status_bitmap = slave->status_bitmap;
+    back->error_count = slave->error_count;
+    back->timestamp = HAL_GetTick();
+    back->sequence = modbus_snapshots[modbus_snapshot_live].sequence + 1;
+
+    modbus_snapshot_live ^= 1;      // Single-store publication
+}
+
+const ModbusSnapshot_t* Modbus_GetSnapshot(void) {
+    return &modbus_snapshots[modbus_snapshot_live];
+}
+
+/**
+  * @brief  Age of the published snapshot in ms (UINT32_MAX before the
+  *         first publication, so stale checks fail safe)
+  */
+uint32_t Modbus_SnapshotAge(void) {
+    const ModbusSnapshot_t* snap = Modbus_GetSnapshot();
+    if (snap->sequence == 0) return 0xFFFFFFFFUL;
+    return HAL_GetTick() - snap->timestamp;
+}
+
+/**
+  * @brief  Record a good response from the active slave: clear the back-off
+  *         and fold the response time into the health statistics
+  */
+static void Modbus_SlaveOnSuccess(uint32_t response_time_ms) {
+    ModbusSlave_t* slave = &modbus_slaves[modbus_active_slave];
+
+    if (!slave->online) {
+        char msg[60];
+        snprintf(msg, sizeof(msg), "Modbus: Slave 0x%02X back ONLINE\r\n", slave->address);
         Send_Debug_Data(msg);
-        return 0;
     }
-    
-    Send_Debug_Data("Modbus: SUCCESS\r\n");
+    slave->online = 1;
+    slave->consecutive_failures = 0;
+    slave->backoff_ms = 0;
+    slave->responses++;
+
+    // EMA (1/8 weight) plus worst case
+    if (slave->response_time_avg == 0) {
+        slave->response_time_avg = response_time_ms;
+    } else {
+        slave->response_time_avg += ((int32_t)response_time_ms -
+                                     (int32_t)slave->response_time_avg) / 8;
+    }
+    if (response_time_ms > slave->response_time_max) {
+        slave->response_time_max = response_time_ms;
+    }
+
+    if (slave->use_split_reads && ++slave->split_phase < 3) {
+        // Split-read fallback: run the remaining partial reads back to
+        // back before the slave waits out its polling period
+        slave->next_poll_time = HAL_GetTick();
+    } else {
+        slave->split_phase = 0;
+        slave->next_poll_time = HAL_GetTick() + slave->poll_interval;
+
+        // Primary slave cycle complete - publish a fresh snapshot
+        if (modbus_active_slave == 0) {
+            Modbus_PublishSnapshot();
+        }
+    }
+}
+
+/**
+  * @brief  Schedule a retry (or give up) after a failed transaction - never blocks
+  */
+static void Modbus_ScheduleRetry(void) {
+    HAL_UART_AbortReceive(MODBUS_UART);
+    HAL_GPIO_WritePin(MODBUS_DE_PORT, MODBUS_DE_PIN, GPIO_PIN_RESET);
+
+    modbus_slaves[modbus_active_slave].errors++;
+
+    modbus_retry_count++;
+    if (modbus_retry_count < MODBUS_MAX_RETRIES) {
+        modbus_retry_time = HAL_GetTick();
+        modbus_engine_state = MODBUS_ENGINE_RETRY_WAIT;
+    } else {
+        Send_Debug_Data("Modbus: All retries failed\r\n");
+        Modbus_SlaveOnFailure();
+        modbus_retry_count = 0;
+        modbus_request_type = MODBUS_REQ_NONE;
+        modbus_engine_state = MODBUS_ENGINE_IDLE;
+    }
+}
+
+/**
+  * @brief  Parse a validated response frame according to the request type
+  * @retval 1 if parsed successfully, 0 on format error
+  */
+static uint8_t Modbus_ParseResponse(void) {
+    ModbusSlave_t* slave = &modbus_slaves[modbus_active_slave];
+
+    switch (modbus_request_type) {
+        case MODBUS_REQ_ALL_DATA:
+            // Register 0: sensor count, 1-8: temperatures, 9-11: status/uptime/errors
+            slave->sensor_count = modbus_rx_buf[4];
+            for (int i = 0; i < 8; i++) {
+                uint16_t reg_val = (modbus_rx_buf[5 + i*2] << 8) | modbus_rx_buf[6 + i*2];
+                slave->temperatures[i] = Modbus_Decode_Temperature(reg_val);
+            }
+            slave->status_bitmap = (modbus_rx_buf[21] << 8) | modbus_rx_buf[22];
+            slave->uptime = (modbus_rx_buf[23] << 8) | modbus_rx_buf[24];
+            slave->error_count = (modbus_rx_buf[25] << 8) | modbus_rx_buf[26];
+            break;
+
+        case MODBUS_REQ_SENSOR_COUNT:
+            slave->sensor_count = modbus_rx_buf[4];
+            break;
+
+        case MODBUS_REQ_TEMPERATURES:
+            for (int i = 0; i < 8; i++) {
+                uint16_t reg_val = (modbus_rx_buf[3 + i*2] << 8) | modbus_rx_buf[4 + i*2];
+                slave->temperatures[i] = Modbus_Decode_Temperature(reg_val);
+            }
+            break;
+
+        case MODBUS_REQ_STATUS:
+            slave->status_bitmap = (modbus_rx_buf[3] << 8) | modbus_rx_buf[4];
+            slave->uptime = (modbus_rx_buf[5] << 8) | modbus_rx_buf[6];
+            slave->error_count = (modbus_rx_buf[7] << 8) | modbus_rx_buf[8];
+            break;
+
+        default:
+            return 0;
+    }
+
+    // The primary temperature board also feeds the legacy single-slave
+    // caches that the temperature-control consumers read
+    if (modbus_active_slave == 0) {
+        memcpy(last_temperatures, slave->temperatures, sizeof(last_temperatures));
+        last_sensor_count = slave->sensor_count;
+        last_status = slave->status_bitmap;
+        last_uptime = slave->uptime;
+        last_error_count = slave->error_count;
+    }
+
     return 1;
 }
 
+/**
+  * @brief  Advance the Modbus engine state machine - called every main-loop pass,
+  *         never waits on the wire
+  */
+static void Modbus_EngineProcess(void) {
+    uint32_t now = HAL_GetTick();
+
+    switch (modbus_engine_state) {
+        case MODBUS_ENGINE_IDLE:
+            break;
+
+        case MODBUS_ENGINE_TX:
+            // TX completion is interrupt-driven; only guard against a wedged transmit
+            if (now - modbus_tx_start_time > MODBUS_TX_TIMEOUT_MS) {
+                HAL_UART_AbortTransmit(MODBUS_UART);
+                Send_Debug_Data("Modbus: TX timeout\r\n");
+                Modbus_ScheduleRetry();
+            }
+            break;
+
+        case MODBUS_ENGINE_WAIT_RX:
+            if (modbus_rx_frame_ready) {
+                modbus_rx_frame_ready = 0;
+                uint16_t len = modbus_rx_frame_len;
+
+                // Exception response (function code with bit 7 set): the
+                // device rejected the request. For the coalesced block
+                // read, fall back to split reads for this slave instead
+                // of retrying a range it will never serve.
+                if (len >= 5 && (modbus_rx_buf[1] & 0x80)) {
+                    uint16_t exc_crc = CRC16_Modbus(modbus_rx_buf, 3);
+                    uint16_t exc_received = (modbus_rx_buf[4] << 8) | modbus_rx_buf[3];
+                    if (exc_crc == exc_received) {
+                        ModbusSlave_t* slave = &modbus_slaves[modbus_active_slave];
+                        if (modbus_request_type == MODBUS_REQ_ALL_DATA && !slave->use_split_reads) {
+                            slave->use_split_reads = 1;
+                            slave->split_phase = 0;
+                            slave->next_poll_time = now;    // Re-poll split immediately
+                            char msg[90];
+                            snprintf(msg, sizeof(msg),
+                                     "Modbus: Slave 0x%02X rejected block read (exc %u) - using split reads\r\n",
+                                     slave->address, modbus_rx_buf[2]);
+                            Send_Debug_Data(msg);
+                            modbus_retry_count = 0;
+                            modbus_request_type = MODBUS_REQ_NONE;
+                            modbus_engine_state = MODBUS_ENGINE_IDLE;
+                        } else {
+                            Send_Debug_Data("Modbus: Exception response\r\n");
+                            Modbus_ScheduleRetry();
+                        }
+                        break;
+                    }
+                }
+
+                // Validate response length and CRC
+                if (len < 5 || len < modbus_expected_len) {
+                    Send_Debug_Data("Modbus: Response too short\r\n");
+                    Modbus_ScheduleRetry();
+                    break;
+                }
+
+                uint16_t crc = CRC16_Modbus(modbus_rx_buf, modbus_expected_len - 2);
+                uint16_t received_crc = (modbus_rx_buf[modbus_expected_len - 1] << 8) |
+                                         modbus_rx_buf[modbus_expected_len - 2];
+                if (crc != received_crc) {
+                    // Append formatters - this fires per frame on a noisy bus
+                    char msg[80];
+                    char *p = Fmt_Str(msg, "Modbus CRC FAILED: Calc=0x");
+                    p = Fmt_Hex16(p, crc);
+                    p = Fmt_Str(p, ", Recv=0x");
+                    p = Fmt_Hex16(p, received_crc);
+                    Fmt_Str(p, "\r\n");
+                    Send_Debug_Data(msg);
+                    Modbus_ScheduleRetry();
+                    break;
+                }
+
+                // Good frame - parse, credit the slave, return to idle
+                Modbus_ParseResponse();
+                Modbus_SlaveOnSuccess(now - modbus_tx_start_time);
+                modbus_retry_count = 0;
+                modbus_request_type = MODBUS_REQ_NONE;
+                modbus_engine_state = MODBUS_ENGINE_IDLE;
+            }
+            else if (now - modbus_tx_start_time > modbus_response_timeout) {
+                Send_Debug_Data("Modbus: Response timeout\r\n");
+                Modbus_ScheduleRetry();
+            }
+            break;
+
+        case MODBUS_ENGINE_RETRY_WAIT:
+            if (now - modbus_retry_time >= MODBUS_RETRY_DELAY_MS) {
+                // Re-issue the same request (tx buffer still holds the frame)
+                ModbusRequestType_t type = modbus_request_type;
+                modbus_engine_state = MODBUS_ENGINE_IDLE;
+                modbus_rx_frame_ready = 0;
+
+                HAL_GPIO_WritePin(MODBUS_DE_PORT, MODBUS_DE_PIN, GPIO_PIN_SET);
+                if (HAL_UART_Transmit_IT(MODBUS_UART, modbus_tx_buf, 8) == HAL_OK) {
+                    modbus_request_type = type;
+                    modbus_tx_start_time = HAL_GetTick();
+                    modbus_engine_state = MODBUS_ENGINE_TX;
+                } else {
+                    HAL_GPIO_WritePin(MODBUS_DE_PORT, MODBUS_DE_PIN, GPIO_PIN_RESET);
+                    Modbus_ScheduleRetry();
+                }
+            }
+            break;
+
+        case MODBUS_ENGINE_ERROR:
+            HAL_UART_AbortReceive(MODBUS_UART);
+            Send_Debug_Data("Modbus: UART error - recovering\r\n");
+            Modbus_ScheduleRetry();
+            break;
+    }
+}
+
 /**
   * @brief  Decode temperature from register value
   * @param  reg_value: Raw register value
@@ -129,16 +470,16 @@ float Modbus_Decode_Temperature(uint16_t reg_value) {
     if (reg_value == 0) {
         return -999.0f;  // Sensor not connected
     }
-    
+
     // Temperature format: (temp * 100) + 10000
     // So to decode: (reg_value - 10000) / 100
     float temp = (float)(reg_value - 10000) / 100.0f;
-    
+
     // Sanity check: temperatures should be reasonable (-50°C to +150°C)
     if (temp < -50.0f || temp > 150.0f) {
         return -999.0f;  // Invalid reading
     }
-    
+
     return temp;
 }
 
@@ -148,35 +489,120 @@ float Modbus_Decode_Temperature(uint16_t reg_value) {
   */
 uint8_t Modbus_Init(void) {
     // Reset state machine
-    modbus_state = 0;
+    modbus_engine_state = MODBUS_ENGINE_IDLE;
+    modbus_request_type = MODBUS_REQ_NONE;
+    modbus_retry_count = 0;
     modbus_last_request = 0;
     modbus_initialized = 1;
-    
+
     // Initialize temperature array
     for (int i = 0; i < 8; i++) {
         last_temperatures[i] = -999.0f;
     }
-    
+
+    // Slave table: slot 0 is the supply/return temperature board on the
+    // fast period; auxiliary slaves get enabled via Modbus_Slave_Configure()
+    memset(modbus_slaves, 0, sizeof(modbus_slaves));
+    for (uint8_t s = 0; s < MODBUS_MAX_SLAVES; s++) {
+        for (int i = 0; i < MAX_SENSORS; i++) {
+            modbus_slaves[s].temperatures[i] = -999.0f;
+        }
+    }
+    Modbus_Slave_Configure(0, MODBUS_SLAVE_ID, MODBUS_POLL_FAST_MS);
+    modbus_active_slave = 0;
+    modbus_rr_cursor = 0;
+
     return 1; // Always return success for now
 }
 
+/**
+  * @brief  Configure a slot in the multi-drop slave table
+  * @param  index: Slot (0 = primary supply/return temperature board)
+  * @param  address: Slave address on the bus, 0 disables the slot
+  * @param  poll_interval_ms: Base polling period
+  * @retval 1 if configured, 0 on invalid slot
+  */
+uint8_t Modbus_Slave_Configure(uint8_t index, uint8_t address, uint32_t poll_interval_ms) {
+    if (index >= MODBUS_MAX_SLAVES) return 0;
+
+    ModbusSlave_t* slave = &modbus_slaves[index];
+    slave->address = address;
+    slave->enabled = (address != 0);
+    slave->online = slave->enabled;     // Assume alive until proven dead
+    slave->poll_interval = poll_interval_ms;
+    slave->next_poll_time = HAL_GetTick();
+    slave->backoff_ms = 0;
+    slave->consecutive_failures = 0;
+
+    return 1;
+}
+
+const ModbusSlave_t* Modbus_Slave_Get(uint8_t index) {
+    if (index >= MODBUS_MAX_SLAVES) return NULL;
+    return &modbus_slaves[index];
+}
+
+/**
+  * @brief  Health score 0-100: success ratio, zeroed while offline
+  */
+uint8_t Modbus_Slave_HealthScore(uint8_t index) {
+    if (index >= MODBUS_MAX_SLAVES) return 0;
+
+    const ModbusSlave_t* slave = &modbus_slaves[index];
+    if (!slave->enabled || !slave->online) return 0;
+
+    uint32_t total = slave->responses + slave->errors;
+    if (total == 0) return 100;         // No traffic yet - benefit of the doubt
+
+    return (uint8_t)((slave->responses * 100UL) / total);
+}
+
 /**
   * @brief  Process Modbus communication state machine
   */
 void Modbus_ProcessCommunication(void) {
     if (!modbus_initialized) return;
-    
+
+    // Advance any in-flight transaction first
+    Modbus_EngineProcess();
+
+    if (modbus_engine_state != MODBUS_ENGINE_IDLE) return;
+
     uint32_t current_time = HAL_GetTick();
-    
-    // Check if it's time for next request
-    if (current_time - modbus_last_request >= modbus_request_interval) {
-        modbus_last_request = current_time;
-        
-        // Read all registers in one command: 0-11 (12 registers total)
-        if (Modbus_Read_AllData()) {
-            // Show debug output after successful read
-            Modbus_Debug_Status();
+
+    // Round-robin the slave table for the next due slot. The cursor
+    // rotates the starting point so a fast slave cannot starve the
+    // auxiliaries; backed-off (dead) slaves simply are not due.
+    for (uint8_t n = 0; n < MODBUS_MAX_SLAVES; n++) {
+        uint8_t idx = (modbus_rr_cursor + n) % MODBUS_MAX_SLAVES;
+        ModbusSlave_t* slave = &modbus_slaves[idx];
+
+        if (!slave->enabled) continue;
+        if ((int32_t)(current_time - slave->next_poll_time) < 0) continue;
+
+        modbus_rr_cursor = (idx + 1) % MODBUS_MAX_SLAVES;
+
+        if (!slave->use_split_reads) {
+            // One coalesced read spans the whole register block (count +
+            // temperatures + status/uptime/errors): one frame overhead,
+            // one turnaround, one CRC instead of three of each.
+            // Expected response: 1 (ID) + 1 (func) + 1 (count) + 24 + 2 (CRC) = 29
+            Modbus_StartRequest(idx, MODBUS_REQ_ALL_DATA, 0x0000, 12, 29);
+        } else {
+            // Fallback for devices that reject the block range
+            switch (slave->split_phase) {
+                case 0:
+                    Modbus_StartRequest(idx, MODBUS_REQ_SENSOR_COUNT, REG_SENSOR_COUNT, 1, 7);
+                    break;
+                case 1:
+                    Modbus_StartRequest(idx, MODBUS_REQ_TEMPERATURES, REG_TEMP_START, 8, 21);
+                    break;
+                default:
+                    Modbus_StartRequest(idx, MODBUS_REQ_STATUS, REG_STATUS_BITMAP, 3, 11);
+                    break;
+            }
         }
+        break;
     }
 }
 
@@ -184,21 +610,19 @@ void Modbus_ProcessCommunication(void) {
   * @brief  Print clean Modbus debug status - only connected sensors
   */
 void Modbus_Debug_Status(void) {
-    Send_Debug_Data("DEBUG: Modbus_Debug_Status called\r\n");
-    
     char msg[200];
-    
+
     // Show system status
     snprintf(msg, sizeof(msg), "=== Modbus System Status ===\r\n");
     Send_Debug_Data(msg);
-    snprintf(msg, sizeof(msg), "Slave ID: 0x%02X, Sensors: %d, Uptime: %ds, Errors: %d\r\n", 
+    snprintf(msg, sizeof(msg), "Slave ID: 0x%02X, Sensors: %d, Uptime: %ds, Errors: %d\r\n",
              MODBUS_SLAVE_ID, last_sensor_count, last_uptime, last_error_count);
     Send_Debug_Data(msg);
-    
+
     // Show only connected sensors
     snprintf(msg, sizeof(msg), "Connected Sensors:\r\n");
     Send_Debug_Data(msg);
-    
+
     for (int i = 0; i < 8; i++) {
         if (last_temperatures[i] > -999.0f) {
             // Use integer math to avoid float formatting issues
@@ -214,138 +638,56 @@ void Modbus_Debug_Status(void) {
 }
 
 /**
-  * @brief  Read sensor count (Register 0)
-  * @param  count: Pointer to store sensor count
-  * @retval 1 if success, 0 if failure
+  * @brief  Request sensor count (Register 0) - non-blocking, result cached
+  * @param  count: Returns the last cached sensor count
+  * @retval 1 if a new request was queued, 0 if the engine is busy
   */
 uint8_t Modbus_Read_SensorCount(uint8_t *count) {
-    modbus_tx_buf[0] = MODBUS_SLAVE_ID;
-    modbus_tx_buf[1] = 0x03;  // Read Holding Registers
-    modbus_tx_buf[2] = 0x00;  // High byte of address
-    modbus_tx_buf[3] = 0x00;  // Low byte of address (REG_SENSOR_COUNT)
-    modbus_tx_buf[4] = 0x00;  // High byte of count
-    modbus_tx_buf[5] = 0x01;  // Low byte of count (1 register)
-    uint16_t crc = Modbus_CRC16(modbus_tx_buf, 6);
-    modbus_tx_buf[6] = crc & 0xFF;
-    modbus_tx_buf[7] = (crc >> 8) & 0xFF;
-
-    if (!Modbus_Transceive(modbus_tx_buf, 8, modbus_rx_buf, 7, 500)) {
-        return 0;
+    if (count != NULL) {
+        *count = last_sensor_count;
     }
-
-    *count = modbus_rx_buf[3];  // Sensor count is in the first data byte
-    return 1;
+    // Expected response: 1 (ID) + 1 (func) + 1 (byte count) + 2 + 2 (CRC) = 7 bytes
+    return Modbus_StartRequest(0, MODBUS_REQ_SENSOR_COUNT, REG_SENSOR_COUNT, 1, 7);
 }
 
 /**
-  * @brief  Read all 8 temperature sensors (Registers 1-8)
-  * @param  temps: Array of 8 floats to store temperatures
-  * @retval 1 if success, 0 if failure
+  * @brief  Request all 8 temperature sensors (Registers 1-8) - non-blocking
+  * @param  temps: Returns the last cached temperatures (array of 8 floats)
+  * @retval 1 if a new request was queued, 0 if the engine is busy
   */
 uint8_t Modbus_Read_Temperatures(float *temps) {
-    // Build request: Read Holding Registers (0x03), Addr=0x01, Count=8
-    modbus_tx_buf[0] = MODBUS_SLAVE_ID;
-    modbus_tx_buf[1] = 0x03;
-    modbus_tx_buf[2] = 0x00;  // High byte of address
-    modbus_tx_buf[3] = 0x01;  // Low byte of address (REG_TEMP_START)
-    modbus_tx_buf[4] = 0x00;  // High byte of count
-    modbus_tx_buf[5] = 0x08;  // Low byte of count (8 registers)
-    uint16_t crc = Modbus_CRC16(modbus_tx_buf, 6);
-    modbus_tx_buf[6] = crc & 0xFF;
-    modbus_tx_buf[7] = (crc >> 8) & 0xFF;
-
-    // Expected response: 1 (ID) + 1 (func) + 1 (byte count) + 16 (8×2 bytes) + 2 (CRC) = 21 bytes
-    if (!Modbus_Transceive(modbus_tx_buf, 8, modbus_rx_buf, 21, 500)) {
-        return 0;
-    }
-
-    // Parse temperatures
-    for (int i = 0; i < 8; i++) {
-        uint16_t reg_val = (modbus_rx_buf[3 + i*2] << 8) | modbus_rx_buf[4 + i*2];
-        temps[i] = Modbus_Decode_Temperature(reg_val);
+    if (temps != NULL) {
+        memcpy(temps, last_temperatures, sizeof(last_temperatures));
     }
-
-    return 1;
+    // Expected response: 1 (ID) + 1 (func) + 1 (byte count) + 16 (8×2 bytes) + 2 (CRC) = 21 bytes
+    return Modbus_StartRequest(0, MODBUS_REQ_TEMPERATURES, REG_TEMP_START, 8, 21);
 }
 
 /**
-  * @brief  Read system status (Registers 9-11)
-  * @param  status: Pointer to store status bitmap
-  * @param  error_count: Pointer to store error count
-  * @retval 1 if success, 0 if failure
+  * @brief  Request system status (Registers 9-11) - non-blocking, results cached
+  * @param  status: Returns the last cached status bitmap
+  * @param  error_count: Returns the last cached error count
+  * @retval 1 if a new request was queued, 0 if the engine is busy
   */
 uint8_t Modbus_Read_Status(uint16_t *status, uint16_t *error_count) {
-    modbus_tx_buf[0] = MODBUS_SLAVE_ID;
-    modbus_tx_buf[1] = 0x03;
-    modbus_tx_buf[2] = 0x00;
-    modbus_tx_buf[3] = 0x09;  // REG_STATUS_BITMAP
-    modbus_tx_buf[4] = 0x00;
-    modbus_tx_buf[5] = 0x03;  // Read 3 registers (status, uptime, error count)
-    uint16_t crc = Modbus_CRC16(modbus_tx_buf, 6);
-    modbus_tx_buf[6] = crc & 0xFF;
-    modbus_tx_buf[7] = (crc >> 8) & 0xFF;
-
-    if (!Modbus_Transceive(modbus_tx_buf, 8, modbus_rx_buf, 11, 500)) {
-        return 0;
+    if (status != NULL) {
+        *status = last_status;
     }
-
-    *status = (modbus_rx_buf[3] << 8) | modbus_rx_buf[4];        // Register 9
-    last_uptime = (modbus_rx_buf[5] << 8) | modbus_rx_buf[6];    // Register 10
-    *error_count = (modbus_rx_buf[7] << 8) | modbus_rx_buf[8];   // Register 11
-
-    return 1;
+    if (error_count != NULL) {
+        *error_count = last_error_count;
+    }
+    // Expected response: 1 (ID) + 1 (func) + 1 (byte count) + 6 (3×2 bytes) + 2 (CRC) = 11 bytes
+    return Modbus_StartRequest(0, MODBUS_REQ_STATUS, REG_STATUS_BITMAP, 3, 11);
 }
 
 /**
-  * @brief  Read all sensor data with retry logic
-  * @retval 1 if success, 0 if failure
+  * @brief  Request all sensor data in one transaction (12 registers) - non-blocking
+  *         Retries are handled by the engine; results land in the cached values
+  * @retval 1 if the request was queued, 0 if the engine is busy
   */
 uint8_t Modbus_Read_AllData(void) {
-    uint8_t retry_count = 0;
-    uint8_t max_retries = 3;
-    
-    while (retry_count < max_retries) {
-        // Prepare request: Read 12 registers starting from 0
-        modbus_tx_buf[0] = 0x01;  // Slave ID
-        modbus_tx_buf[1] = 0x03;  // Function code (Read Holding Registers)
-        modbus_tx_buf[2] = 0x00;  // High byte of start address
-        modbus_tx_buf[3] = 0x00;  // Low byte of start address
-        modbus_tx_buf[4] = 0x00;  // High byte of register count
-        modbus_tx_buf[5] = 0x0C;  // Low byte of register count (12 registers)
-
-        uint16_t crc = Modbus_CRC16(modbus_tx_buf, 6);
-        modbus_tx_buf[6] = crc & 0xFF;
-        modbus_tx_buf[7] = (crc >> 8) & 0xFF;
-
-        // Expected response: 1 (ID) + 1 (func) + 1 (byte count) + 24 (12×2 bytes) + 2 (CRC) = 29 bytes
-        if (Modbus_Transceive(modbus_tx_buf, 8, modbus_rx_buf, 29, 1000)) {
-            // Success - parse data
-            last_sensor_count = modbus_rx_buf[3];
-            
-            // Registers 1-8: Temperatures
-            for (int i = 0; i < 8; i++) {
-                uint16_t reg_val = (modbus_rx_buf[5 + i*2] << 8) | modbus_rx_buf[6 + i*2];
-                last_temperatures[i] = Modbus_Decode_Temperature(reg_val);
-            }
-            
-            // Registers 9-11: Status, Uptime, Error count
-            last_status = (modbus_rx_buf[21] << 8) | modbus_rx_buf[22];
-            last_uptime = (modbus_rx_buf[23] << 8) | modbus_rx_buf[24];
-            last_error_count = (modbus_rx_buf[25] << 8) | modbus_rx_buf[26];
-            
-            return 1;  // Success
-        }
-        
-        // Failed - wait before retry
-        retry_count++;
-        if (retry_count < max_retries) {
-            HAL_Delay(2000);  // Wait 2 seconds before retry
-            Send_Debug_Data("Modbus: Retrying...\r\n");
-        }
-    }
-    
-    Send_Debug_Data("Modbus: All retries failed\r\n");
-    return 0;
+    // Expected response: 1 (ID) + 1 (func) + 1 (byte count) + 24 (12×2 bytes) + 2 (CRC) = 29 bytes
+    return Modbus_StartRequest(0, MODBUS_REQ_ALL_DATA, 0x0000, 12, 29);
 }
 
 /**
@@ -366,25 +708,29 @@ uint8_t Modbus_System_Init(void) {
 }
 
 /**
-  * @brief  Start Modbus system (perform first read)
+  * @brief  Start Modbus system (queue first read - completes in background)
   */
 void Modbus_System_Start(void) {
     if (modbus_system_enabled) {
-        Send_Debug_Data("--- Performing First Modbus Sensor Read ---\r\n");
-        Modbus_Read_AllData(); // Perform first read
-        Modbus_Debug_Status(); // Show first results
-        Send_Debug_Data("--- First Modbus Read Complete ---\r\n");
+        Send_Debug_Data("--- Queuing First Modbus Sensor Read ---\r\n");
+        Modbus_Read_AllData();  // Completes asynchronously via Modbus_System_Process()
+        modbus_last_request = HAL_GetTick();
     }
 }
 
 /**
-  * @brief  Process Modbus system (main loop function)
+  * @brief  Process Modbus system (main loop function) - never blocks
   */
 void Modbus_System_Process(void) {
+    static uint8_t prof_id = PROFILER_INVALID_SECTION;
+    if (prof_id == PROFILER_INVALID_SECTION) {
+        prof_id = Profiler_RegisterSection("Modbus_ProcComm");
+    }
+
     if (modbus_system_enabled) {
+        Profiler_Begin(prof_id);
         Modbus_ProcessCommunication();
-        // Remove the blocking delay - it was causing the system to freeze
-        // HAL_Delay(2000);  // REMOVED - this was blocking the main loop
+        Profiler_End(prof_id);
     }
 }
 
@@ -418,11 +764,37 @@ void Modbus_System_Disable(void) {
   */
 void Modbus_System_SetInterval(uint32_t interval_ms) {
     modbus_request_interval = interval_ms;
+    modbus_slaves[0].poll_interval = interval_ms;   // Primary temperature board
     char msg[100];
     snprintf(msg, sizeof(msg), "Modbus polling interval set to: %lu ms\r\n", interval_ms);
     Send_Debug_Data(msg);
 }
 
+/**
+  * @brief  Print the multi-drop slave table ('mb_slaves' console command)
+  */
+void Modbus_PrintSlaveTable(void) {
+    char msg[120];
+
+    Send_Debug_Data("=== Modbus Slave Table ===\r\n");
+    Send_Debug_Data("Slot Addr State   Health Period  Backoff  AvgResp MaxResp Resp/Err\r\n");
+
+    for (uint8_t i = 0; i < MODBUS_MAX_SLAVES; i++) {
+        const ModbusSlave_t* slave = &modbus_slaves[i];
+        if (!slave->enabled) continue;
+
+        snprintf(msg, sizeof(msg),
+                 "  %u  0x%02X %-7s %3u%%  %6lu %7lu %6lums %5lums %lu/%lu\r\n",
+                 i, slave->address,
+                 slave->online ? "ONLINE" : "OFFLINE",
+                 Modbus_Slave_HealthScore(i),
+                 slave->poll_interval, slave->backoff_ms,
+                 slave->response_time_avg, slave->response_time_max,
+                 slave->responses, slave->errors);
+        Send_Debug_Data(msg);
+    }
+}
+
 /**
  * @brief Get sensor data by ID (maps to your Modbus register system)
  * @param sensor_id: Sensor ID to read (1-4 for A0-A3)
@@ -432,22 +804,25 @@ void Modbus_System_SetInterval(uint32_t interval_ms) {
 uint8_t ModbusSensor_GetSensorData(uint8_t sensor_id, ModbusSensorData_t* sensor_data)
 {
     if (sensor_data == NULL) return 0;
-    
+
     // Initialize with default values
     sensor_data->value = 0.0f;
     sensor_data->valid = 0;
     sensor_data->timestamp = HAL_GetTick();
-    
-    // Map sensor IDs to your actual temperature readings (A0-A3)
+
+    // Serve from the published snapshot: coherent values, dated, and
+    // aged out deterministically instead of trusting stale globals
+    const ModbusSnapshot_t* snap = Modbus_GetSnapshot();
+
+    // Map sensor IDs to the snapshot temperature slots (A0-A3)
     if (sensor_id >= 1 && sensor_id <= 4) {
-        // Use your existing temperature array (A0-A3)
         int array_index = sensor_id - 1; // Convert 1-4 to 0-3
-        if (array_index >= 0 && array_index < 8) {
-            sensor_data->value = last_temperatures[array_index];
-            sensor_data->valid = (sensor_data->value != -999.0f) ? 1 : 0;
-            return 1;
-        }
+        sensor_data->value = snap->temperatures[array_index];
+        sensor_data->timestamp = snap->timestamp;
+        sensor_data->valid = ((snap->valid_mask & (1 << array_index)) &&
+                              Modbus_SnapshotAge() < MODBUS_SNAPSHOT_MAX_AGE_MS) ? 1 : 0;
+        return 1;
     }
-    
+
     return 0;
 }
@@ -0,0 +1,109 @@
+/**
+ * @file    priority_index.c
+ * @brief   Incrementally Maintained Priority Ordering Implementation
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ */
+
+#include "priority_index.h"
+#include <string.h>
+
+void PriorityIndex_Init(PriorityIndex_t* index, uint8_t unit_count)
+{
+    if (index == NULL) return;
+
+    if (unit_count > PRIORITY_INDEX_MAX_UNITS) {
+        unit_count = PRIORITY_INDEX_MAX_UNITS;
+    }
+
+    memset(index, 0, sizeof(PriorityIndex_t));
+    index->count = unit_count;
+
+    for (uint8_t i = 0; i < unit_count; i++) {
+        index->order[i] = i;
+    }
+}
+
+/**
+ * @brief Find a unit's current position in the order array
+ */
+static uint8_t PriorityIndex_FindPosition(const PriorityIndex_t* index, uint8_t unit)
+{
+    for (uint8_t pos = 0; pos < index->count; pos++) {
+        if (index->order[pos] == unit) {
+            return pos;
+        }
+    }
+    return PRIORITY_INDEX_NONE;
+}
+
+bool PriorityIndex_UpdateScore(PriorityIndex_t* index, uint8_t unit, float score)
+{
+    if (index == NULL || unit >= index->count) return false;
+
+    if (index->scores[unit] == score) {
+        return false;                   // Nothing changed, order untouched
+    }
+    index->scores[unit] = score;
+
+    uint8_t pos = PriorityIndex_FindPosition(index, unit);
+    if (pos == PRIORITY_INDEX_NONE) return false;
+
+    // Bubble the single changed unit toward its new position; every
+    // other entry keeps its relative order
+    bool moved = false;
+    while (pos > 0 &&
+           index->scores[index->order[pos - 1]] > score) {
+        index->order[pos] = index->order[pos - 1];
+        index->order[pos - 1] = unit;
+        pos--;
+        moved = true;
+    }
+    while (pos < (uint8_t)(index->count - 1) &&
+           index->scores[index->order[pos + 1]] < score) {
+        index->order[pos] = index->order[pos + 1];
+        index->order[pos + 1] = unit;
+        pos++;
+        moved = true;
+    }
+
+    if (moved) {
+        index->reorder_count++;
+    }
+    return moved;
+}
+
+uint8_t PriorityIndex_FirstEligible(const PriorityIndex_t* index,
+                                    PriorityIndexEligible_fn eligible)
+{
+    if (index == NULL) return PRIORITY_INDEX_NONE;
+
+    for (uint8_t pos = 0; pos < index->count; pos++) {
+        uint8_t unit = index->order[pos];
+        if (eligible == NULL || eligible(unit)) {
+            return unit;
+        }
+    }
+    return PRIORITY_INDEX_NONE;
+}
+
+uint8_t PriorityIndex_LastEligible(const PriorityIndex_t* index,
+                                   PriorityIndexEligible_fn eligible)
+{
+    if (index == NULL) return PRIORITY_INDEX_NONE;
+
+    for (uint8_t pos = index->count; pos > 0; pos--) {
+        uint8_t unit = index->order[pos - 1];
+        if (eligible == NULL || eligible(unit)) {
+            return unit;
+        }
+    }
+    return PRIORITY_INDEX_NONE;
+}
+
+float PriorityIndex_GetScore(const PriorityIndex_t* index, uint8_t unit)
+{
+    if (index == NULL || unit >= index->count) return 0.0f;
+    return index->scores[unit];
+}
@@ -0,0 +1,121 @@
+/**
+ * @file    profiler.c
+ * @brief   DWT Cycle-Counter Profiler Implementation
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ */
+
+#include "profiler.h"
+#include "uart_comm.h"
+#include <stdio.h>
+#include <string.h>
+
+/* ========================================================================== */
+/* PRIVATE VARIABLES                                                          */
+/* ========================================================================== */
+
+static profiler_section_t sections[PROFILER_MAX_SECTIONS];
+static uint8_t section_count = 0;
+static uint8_t profiler_initialized = 0;
+static uint32_t cycles_per_us = 1;
+
+/* ========================================================================== */
+/* PUBLIC FUNCTIONS                                                           */
+/* ========================================================================== */
+
+uint8_t Profiler_Init(void) {
+    memset(sections, 0, sizeof(sections));
+    section_count = 0;
+
+    // The scheduler may already have enabled CYCCNT - enabling twice is fine
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55;              // Unlock DWT on Cortex-M7
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    cycles_per_us = SystemCoreClock / 1000000U;
+    if (cycles_per_us == 0) {
+        cycles_per_us = 1;
+    }
+
+    profiler_initialized = 1;
+    Send_Debug_Data("Profiler: Initialized (DWT cycle counter)\r\n");
+    return 1;
+}
+
+uint8_t Profiler_RegisterSection(const char *name) {
+    if (!profiler_initialized || section_count >= PROFILER_MAX_SECTIONS) {
+        return PROFILER_INVALID_SECTION;
+    }
+
+    profiler_section_t *section = &sections[section_count];
+    section->name = (name != NULL) ? name : "?";
+    section->min_cycles = 0xFFFFFFFFU;
+
+    return section_count++;
+}
+
+void Profiler_Begin(uint8_t section_id) {
+    if (section_id >= section_count) return;
+    sections[section_id].start_cycles = DWT->CYCCNT;
+}
+
+void Profiler_End(uint8_t section_id) {
+    if (section_id >= section_count) return;
+
+    profiler_section_t *section = &sections[section_id];
+    // CYCCNT wraps every ~5 s at 280 MHz; unsigned subtraction stays correct
+    // across a single wrap, which covers any realistic section length.
+    uint32_t elapsed = DWT->CYCCNT - section->start_cycles;
+
+    if (elapsed < section->min_cycles) section->min_cycles = elapsed;
+    if (elapsed > section->max_cycles) section->max_cycles = elapsed;
+    section->total_cycles += elapsed;
+    section->call_count++;
+}
+
+void Profiler_Reset(void) {
+    for (uint8_t i = 0; i < section_count; i++) {
+        sections[i].call_count = 0;
+        sections[i].min_cycles = 0xFFFFFFFFU;
+        sections[i].max_cycles = 0;
+        sections[i].total_cycles = 0;
+    }
+    Send_Debug_Data("Profiler: Statistics reset\r\n");
+}
+
+uint8_t Profiler_GetSection(uint8_t section_id, profiler_section_t *section) {
+    if (section_id >= section_count || section == NULL) return 0;
+    *section = sections[section_id];
+    return 1;
+}
+
+void Profiler_PrintReport(void) {
+    char msg[140];
+
+    Send_Debug_Data("\r\n=== Profiler Report (cycles) ===\r\n");
+    snprintf(msg, sizeof(msg), "Core clock: %lu MHz (%lu cycles/us)\r\n",
+             (unsigned long)(SystemCoreClock / 1000000U),
+             (unsigned long)cycles_per_us);
+    Send_Debug_Data(msg);
+    Send_Debug_Data("Section               Calls    Min      Avg      Max      Max us\r\n");
+
+    for (uint8_t i = 0; i < section_count; i++) {
+        profiler_section_t *section = &sections[i];
+        uint32_t avg = 0;
+        uint32_t min = 0;
+        if (section->call_count > 0) {
+            avg = (uint32_t)(section->total_cycles / section->call_count);
+            min = section->min_cycles;
+        }
+        snprintf(msg, sizeof(msg), "%-21s %-8lu %-8lu %-8lu %-8lu %lu\r\n",
+                 section->name,
+                 (unsigned long)section->call_count,
+                 (unsigned long)min,
+                 (unsigned long)avg,
+                 (unsigned long)section->max_cycles,
+                 (unsigned long)(section->max_cycles / cycles_per_us));
+        Send_Debug_Data(msg);
+    }
+    Send_Debug_Data("================================\r\n\r\n");
+}
@@ -0,0 +1,113 @@
+/**
+ * @file    rtc_backup.c
+ * @brief   Runtime-Hours Accounting in RTC Backup Registers
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ */
+
+#include "rtc_backup.h"
+#include "flash_config.h"
+#include "uart_comm.h"
+#include <stdio.h>
+
+/* Backup register indices (see header map) */
+#define BKP_MAGIC               0
+#define BKP_COMP_HOURS          1   // 1..8
+#define BKP_COND_HOURS          9   // 9..12
+#define BKP_COMP_STARTS         13  // 13..20
+#define BKP_COND_STARTS         21  // 21..24
+#define BKP_TOTAL_HOURS         25
+#define BKP_START_COUNT         26
+#define BKP_COMMIT_MINUTES      27
+
+/* Private Variables ---------------------------------------------------------*/
+static uint8_t rtc_backup_available = 0;
+
+/* Private Functions ---------------------------------------------------------*/
+
+/**
+ * @brief Access one backup register by index
+ */
+static volatile uint32_t* RTCBackup_Reg(uint8_t index)
+{
+    return (&RTC->BKP0R) + index;
+}
+
+/* Public Functions ----------------------------------------------------------*/
+
+uint8_t RTCBackup_Init(void)
+{
+    // Unlock the backup domain - registers keep content on VBAT
+    __HAL_RCC_RTC_CLK_ENABLE();
+    HAL_PWR_EnableBkUpAccess();
+
+    rtc_backup_available = 1;
+
+    if (*RTCBackup_Reg(BKP_MAGIC) == RTC_BACKUP_MAGIC) {
+        // Valid counters survived - if they are ahead of what flash
+        // replayed, power was cut between commits and they win
+        if (*RTCBackup_Reg(BKP_TOTAL_HOURS) >= g_flash_config.runtime_data.system_total_hours) {
+            RuntimeData_t *rd = &g_flash_config.runtime_data;
+            for (uint8_t i = 0; i < MAX_COMPRESSORS; i++) {
+                rd->compressor_hours[i] = *RTCBackup_Reg(BKP_COMP_HOURS + i);
+                rd->compressor_starts[i] = *RTCBackup_Reg(BKP_COMP_STARTS + i);
+            }
+            for (uint8_t i = 0; i < MAX_CONDENSER_BANKS; i++) {
+                rd->condenser_hours[i] = *RTCBackup_Reg(BKP_COND_HOURS + i);
+                rd->condenser_starts[i] = *RTCBackup_Reg(BKP_COND_STARTS + i);
+            }
+            rd->system_total_hours = *RTCBackup_Reg(BKP_TOTAL_HOURS);
+            rd->system_start_count = *RTCBackup_Reg(BKP_START_COUNT);
+            Send_Debug_Data("RTC Backup: Runtime counters restored from backup domain\r\n");
+        } else {
+            // Flash copy is newer (fresh battery / replaced board)
+            RTCBackup_Sync();
+        }
+    } else {
+        // First boot or lost backup power - seed from the flash copy
+        RTCBackup_Sync();
+        *RTCBackup_Reg(BKP_COMMIT_MINUTES) = 0;
+        *RTCBackup_Reg(BKP_MAGIC) = RTC_BACKUP_MAGIC;
+        Send_Debug_Data("RTC Backup: Backup registers seeded from flash\r\n");
+    }
+
+    return rtc_backup_available;
+}
+
+void RTCBackup_Sync(void)
+{
+    if (!rtc_backup_available) return;
+
+    RuntimeData_t *rd = &g_flash_config.runtime_data;
+    for (uint8_t i = 0; i < MAX_COMPRESSORS; i++) {
+        *RTCBackup_Reg(BKP_COMP_HOURS + i) = rd->compressor_hours[i];
+        *RTCBackup_Reg(BKP_COMP_STARTS + i) = rd->compressor_starts[i];
+    }
+    for (uint8_t i = 0; i < MAX_CONDENSER_BANKS; i++) {
+        *RTCBackup_Reg(BKP_COND_HOURS + i) = rd->condenser_hours[i];
+        *RTCBackup_Reg(BKP_COND_STARTS + i) = rd->condenser_starts[i];
+    }
+    *RTCBackup_Reg(BKP_TOTAL_HOURS) = rd->system_total_hours;
+    *RTCBackup_Reg(BKP_START_COUNT) = rd->system_start_count;
+}
+
+uint32_t RTCBackup_MinuteTick(void)
+{
+    if (!rtc_backup_available) return 0;
+
+    uint32_t minutes = *RTCBackup_Reg(BKP_COMMIT_MINUTES) + 1;
+    *RTCBackup_Reg(BKP_COMMIT_MINUTES) = minutes;
+    return minutes;
+}
+
+void RTCBackup_MarkCommitted(void)
+{
+    if (!rtc_backup_available) return;
+    *RTCBackup_Reg(BKP_COMMIT_MINUTES) = 0;
+}
+
+uint8_t RTCBackup_IsAvailable(void)
+{
+    return rtc_backup_available;
+}
@@ -0,0 +1,122 @@
+/**
+ * @file    run_stats.c
+ * @brief   O(1) Incremental Statistics Implementation
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ *
+ * @description
+ * Running-sum mean, monotonic-deque min/max and exponentially-weighted
+ * variance, all updated in constant time per sample. The deques hold
+ * (sequence, value) pairs: entries older than the window expire off the
+ * front, dominated entries pop off the back, so the front entry is
+ * always the exact windowed extreme. Each sample is pushed and popped
+ * at most once, making the update amortized O(1).
+ */
+
+#include "run_stats.h"
+#include <string.h>
+
+/* Deque index arithmetic (power-of-two ring) */
+#define DQ_NEXT(i)      (uint8_t)(((i) + 1) & (RUN_STATS_MAX_WINDOW - 1))
+#define DQ_PREV(i)      (uint8_t)(((i) - 1) & (RUN_STATS_MAX_WINDOW - 1))
+
+void RunStats_Init(RunStats_t* stats, uint8_t window_size, float ema_alpha)
+{
+    if (stats == NULL) return;
+
+    memset(stats, 0, sizeof(RunStats_t));
+
+    if (window_size == 0) window_size = 1;
+    if (window_size > RUN_STATS_MAX_WINDOW) window_size = RUN_STATS_MAX_WINDOW;
+
+    stats->window_size = window_size;
+    stats->ema_alpha = ema_alpha;
+}
+
+void RunStats_Add(RunStats_t* stats, float sample)
+{
+    if (stats == NULL) return;
+
+    // Running sum: evict the overwritten sample, add the new one
+    if (stats->count == stats->window_size) {
+        stats->running_sum -= stats->window[stats->index];
+    } else {
+        stats->count++;
+    }
+    stats->running_sum += sample;
+    stats->window[stats->index] = sample;
+    stats->index = (stats->index + 1) % stats->window_size;
+
+    uint32_t expire_before = (stats->seq >= stats->window_size)
+                           ? stats->seq - stats->window_size + 1 : 0;
+
+    // Min deque: expire aged entries, pop dominated ones, push the sample
+    while (stats->min_head != stats->min_tail &&
+           stats->min_dq[stats->min_head].seq < expire_before) {
+        stats->min_head = DQ_NEXT(stats->min_head);
+    }
+    while (stats->min_head != stats->min_tail &&
+           stats->min_dq[DQ_PREV(stats->min_tail)].value >= sample) {
+        stats->min_tail = DQ_PREV(stats->min_tail);
+    }
+    stats->min_dq[stats->min_tail].seq = stats->seq;
+    stats->min_dq[stats->min_tail].value = sample;
+    stats->min_tail = DQ_NEXT(stats->min_tail);
+
+    // Max deque: same scheme with the comparison flipped
+    while (stats->max_head != stats->max_tail &&
+           stats->max_dq[stats->max_head].seq < expire_before) {
+        stats->max_head = DQ_NEXT(stats->max_head);
+    }
+    while (stats->max_head != stats->max_tail &&
+           stats->max_dq[DQ_PREV(stats->max_tail)].value <= sample) {
+        stats->max_tail = DQ_PREV(stats->max_tail);
+    }
+    stats->max_dq[stats->max_tail].seq = stats->seq;
+    stats->max_dq[stats->max_tail].value = sample;
+    stats->max_tail = DQ_NEXT(stats->max_tail);
+
+    // Exponentially-weighted mean and variance (West's one-pass form)
+    if (stats->seq == 0) {
+        stats->ema_mean = sample;
+        stats->ema_var = 0.0f;
+    } else {
+        float delta = sample - stats->ema_mean;
+        stats->ema_mean += stats->ema_alpha * delta;
+        stats->ema_var = (1.0f - stats->ema_alpha) *
+                         (stats->ema_var + stats->ema_alpha * delta * delta);
+    }
+
+    stats->seq++;
+}
+
+float RunStats_Mean(const RunStats_t* stats)
+{
+    if (stats == NULL || stats->count == 0) return 0.0f;
+    return stats->running_sum / (float)stats->count;
+}
+
+float RunStats_Min(const RunStats_t* stats)
+{
+    if (stats == NULL || stats->min_head == stats->min_tail) return 0.0f;
+    return stats->min_dq[stats->min_head].value;
+}
+
+float RunStats_Max(const RunStats_t* stats)
+{
+    if (stats == NULL || stats->max_head == stats->max_tail) return 0.0f;
+    return stats->max_dq[stats->max_head].value;
+}
+
+float RunStats_EMAMean(const RunStats_t* stats)
+{
+    if (stats == NULL) return 0.0f;
+    return stats->ema_mean;
+}
+
+float RunStats_Variance(const RunStats_t* stats)
+{
+    if (stats == NULL) return 0.0f;
+    return stats->ema_var;
+}
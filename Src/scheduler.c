@@ -0,0 +1,183 @@
+/**
+ * @file    scheduler.c
+ * @brief   Cooperative Task Scheduler Implementation
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ */
+
+#include "scheduler.h"
+#include "watchdog.h"
+#include "uart_comm.h"
+#include <stdio.h>
+#include <string.h>
+
+/* ========================================================================== */
+/* PRIVATE VARIABLES                                                          */
+/* ========================================================================== */
+
+static scheduler_task_t task_table[SCHEDULER_MAX_TASKS];
+static uint8_t task_count = 0;
+static uint8_t scheduler_initialized = 0;
+static uint32_t cycles_per_us = 1;
+
+/* ========================================================================== */
+/* PRIVATE FUNCTIONS                                                          */
+/* ========================================================================== */
+
+/**
+ * @brief Enable the Cortex-M7 DWT cycle counter for sub-ms runtime measurement
+ */
+static void Scheduler_EnableCycleCounter(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55;              // Unlock DWT on Cortex-M7
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    cycles_per_us = SystemCoreClock / 1000000U;
+    if (cycles_per_us == 0) {
+        cycles_per_us = 1;
+    }
+}
+
+/**
+ * @brief Run one task and update its runtime statistics
+ */
+static void Scheduler_RunTask(scheduler_task_t *task, uint32_t now) {
+    // A task that got to run more than 2x its period late missed its deadline
+    if (task->period_ms > 0 && task->run_count > 0) {
+        if ((now - task->last_run) > (task->period_ms * 2U)) {
+            task->deadline_misses++;
+        }
+    }
+    task->last_run = now;
+
+    // Aliveness bit + post-mortem last-task mirror for the watchdog
+    Watchdog_TaskAlive((uint8_t)(task - task_table));
+
+    uint32_t start_cycles = DWT->CYCCNT;
+    task->run();
+    uint32_t elapsed_us = (DWT->CYCCNT - start_cycles) / cycles_per_us;
+
+    task->last_us = elapsed_us;
+    if (elapsed_us > task->max_us) {
+        task->max_us = elapsed_us;
+    }
+    if (task->run_count == 0) {
+        task->avg_us = elapsed_us;
+    } else {
+        // EMA with 1/8 weight - cheap and smooth enough for a stats table
+        task->avg_us = task->avg_us - (task->avg_us >> 3) + (elapsed_us >> 3);
+    }
+    task->run_count++;
+}
+
+/* ========================================================================== */
+/* PUBLIC FUNCTIONS                                                           */
+/* ========================================================================== */
+
+uint8_t Scheduler_Init(void) {
+    memset(task_table, 0, sizeof(task_table));
+    task_count = 0;
+    Scheduler_EnableCycleCounter();
+    scheduler_initialized = 1;
+
+    Send_Debug_Data("Scheduler: Initialized\r\n");
+    return 1;
+}
+
+uint8_t Scheduler_RegisterTask(const char *name, scheduler_task_fn_t run,
+                               uint32_t period_ms, uint8_t priority) {
+    if (!scheduler_initialized || run == NULL || task_count >= SCHEDULER_MAX_TASKS) {
+        Send_Debug_Data("Scheduler: Task registration failed\r\n");
+        return SCHEDULER_INVALID_TASK;
+    }
+
+    scheduler_task_t *task = &task_table[task_count];
+    task->name = (name != NULL) ? name : "?";
+    task->run = run;
+    task->period_ms = period_ms;
+    task->priority = priority;
+    task->enabled = 1;
+    task->last_run = HAL_GetTick();
+
+    // Critical tasks join the watchdog's aliveness set automatically
+    if (priority == SCHED_PRIO_CRITICAL) {
+        Watchdog_ExpectTask(task_count);
+    }
+
+    return task_count++;
+}
+
+void Scheduler_Process(void) {
+    if (!scheduler_initialized) return;
+
+    uint32_t now = HAL_GetTick();
+
+    // One due task per priority sweep: highest-priority due task runs first,
+    // and lower classes never starve a critical task that became due while
+    // a long task was running.
+    for (uint8_t prio = SCHED_PRIO_CRITICAL; prio <= SCHED_PRIO_LOW; prio++) {
+        for (uint8_t i = 0; i < task_count; i++) {
+            scheduler_task_t *task = &task_table[i];
+            if (!task->enabled || task->priority != prio) continue;
+
+            if (task->run_request || task->period_ms == 0 ||
+                (now - task->last_run) >= task->period_ms) {
+                task->run_request = 0;
+                Scheduler_RunTask(task, now);
+                now = HAL_GetTick();
+            }
+        }
+    }
+}
+
+void Scheduler_RequestRun(uint8_t task_id) {
+    if (task_id < task_count) {
+        task_table[task_id].run_request = 1;
+    }
+}
+
+void Scheduler_SetTaskEnabled(uint8_t task_id, uint8_t enable) {
+    if (task_id < task_count) {
+        task_table[task_id].enabled = enable ? 1 : 0;
+    }
+}
+
+void Scheduler_SetTaskPeriod(uint8_t task_id, uint32_t period_ms) {
+    if (task_id < task_count) {
+        task_table[task_id].period_ms = period_ms;
+    }
+}
+
+uint8_t Scheduler_GetTaskStats(uint8_t task_id, scheduler_task_t *task) {
+    if (task_id >= task_count || task == NULL) return 0;
+    *task = task_table[task_id];
+    return 1;
+}
+
+uint8_t Scheduler_GetTaskCount(void) {
+    return task_count;
+}
+
+void Scheduler_PrintTable(void) {
+    char msg[120];
+
+    Send_Debug_Data("\r\n=== Scheduler Task Table ===\r\n");
+    Send_Debug_Data("Name          Prio Period   Runs     Last/Avg/Max us   Missed\r\n");
+
+    for (uint8_t i = 0; i < task_count; i++) {
+        scheduler_task_t *task = &task_table[i];
+        snprintf(msg, sizeof(msg), "%-13s %-4u %-8lu %-8lu %lu/%lu/%lu%s  %lu\r\n",
+                 task->name,
+                 task->priority,
+                 (unsigned long)task->period_ms,
+                 (unsigned long)task->run_count,
+                 (unsigned long)task->last_us,
+                 (unsigned long)task->avg_us,
+                 (unsigned long)task->max_us,
+                 task->enabled ? "" : " (off)",
+                 (unsigned long)task->deadline_misses);
+        Send_Debug_Data(msg);
+    }
+    Send_Debug_Data("============================\r\n\r\n");
+}
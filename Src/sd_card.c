@@ -1,7 +1,10 @@
 #include "stm32h7xx_hal.h"
 #include "stm32h7xx_hal_sd.h"
 #include "sd_card.h"
+#include "sd_ring_log.h"
 #include "uart_comm.h"
+#include "dcache_util.h"
+#include "event_queue.h"
 #include <string.h>
 #include <stdio.h>
 
@@ -18,9 +21,37 @@ static uint32_t auto_test_interval = 60000;  // 60 seconds
 static uint32_t last_auto_test = 0;
 static uint8_t auto_test_sequence = 0;
 
+/* === Card lifecycle state machine (hot-swap without blocking) ===
+ * Detection, debounce and re-initialization are advanced one step per
+ * SD_Card_Process() pass - no HAL_Delay() anywhere in the path, so pulling
+ * a card mid-operation never stalls the control loop. While a card is out,
+ * log writes keep accumulating in the write-behind queue RAM and are
+ * flushed once the lifecycle machine has the replacement card back in
+ * service and the ring log re-mounted. */
+
+typedef enum {
+    SD_LC_ABSENT = 0,       // No card in service; probe periodically
+    SD_LC_SETTLE,           // Bus released by HAL_SD_DeInit; waiting out settle time
+    SD_LC_INIT,             // HAL_SD_Init attempt (one shot per pass)
+    SD_LC_VERIFY,           // Debounce: consecutive good card-state reads
+    SD_LC_MOUNT,            // Re-mount the ring log on the (re)inserted card
+    SD_LC_READY             // Card in service; watch for removal
+} SD_CardLifecycle_t;
+
+#define SD_LC_PROBE_INTERVAL_MS     2000    // Insertion probe cadence while absent
+#define SD_LC_SETTLE_TIME_MS        100     // Bus settle after HAL_SD_DeInit
+#define SD_LC_CHECK_INTERVAL_MS     1000    // Presence poll while in service
+#define SD_LC_DEBOUNCE_READS        2       // Consecutive good states to accept a card
+
+static SD_CardLifecycle_t sd_lc_state = SD_LC_ABSENT;
+static uint32_t sd_lc_next_action = 0;      // Tick the current state waits for
+static uint8_t sd_lc_good_reads = 0;
+static uint32_t sd_lc_swap_count = 0;       // Cards accepted into service
+
 /* Function prototypes */
 static void MX_SDMMC1_SD_Init(void);
 static void MX_SDMMC1_GPIO_Init(void);
+static void SD_Card_Lifecycle_CardLost(void);
 
 /**
   * @brief  Initialize SD Card
@@ -35,9 +66,15 @@ SD_Card_Status_t SD_Card_Init(void)
     if (HAL_SD_Init(&hsd1) == HAL_OK) {
         sd_card_initialized = 1;
         sd_card_present = 1;
+        // Boot mounts the ring log itself; hand the lifecycle machine a
+        // card that is already in service
+        sd_lc_state = SD_LC_READY;
+        sd_lc_next_action = HAL_GetTick() + SD_LC_CHECK_INTERVAL_MS;
         return SD_CARD_OK;
     }
-    
+
+    sd_lc_state = SD_LC_ABSENT;
+    sd_lc_next_action = HAL_GetTick() + SD_LC_PROBE_INTERVAL_MS;
     return SD_CARD_ERROR;
 }
 
@@ -75,6 +112,25 @@ SD_Card_Status_t SD_Card_WriteSingleBlock(uint8_t *data, uint32_t block_address)
     return SD_CARD_WRITE_FAILED;
 }
 
+/**
+  * @brief  Read consecutive blocks from SD Card in one multi-block command
+  * @note   Used by the log-export path - one CMD18 burst instead of a
+  *         single-block read per sector
+  */
+SD_Card_Status_t SD_Card_ReadBlocks(uint8_t *pData, uint32_t BlockAdd, uint32_t NumberOfBlocks)
+{
+    if (!sd_card_initialized || pData == NULL || NumberOfBlocks == 0) {
+        return SD_CARD_ERROR;
+    }
+
+    if (HAL_SD_ReadBlocks(&hsd1, pData, BlockAdd, NumberOfBlocks,
+                          SD_CARD_TIMEOUT_MS) == HAL_OK) {
+        return SD_CARD_OK;
+    }
+
+    return SD_CARD_READ_FAILED;
+}
+
 /**
   * @brief  Read single block from SD Card
   */
@@ -83,14 +139,155 @@ SD_Card_Status_t SD_Card_ReadSingleBlock(uint8_t *data, uint32_t block_address)
     if (!sd_card_initialized) {
         return SD_CARD_ERROR;
     }
-    
+
     if (HAL_SD_ReadBlocks(&hsd1, data, block_address, 1, 5000) == HAL_OK) {
         return SD_CARD_OK;
     }
-    
+
     return SD_CARD_READ_FAILED;
 }
 
+/* === Write-behind queue with multi-block DMA flush ===
+ * Loggers enqueue 512-byte blocks (a microsecond memcpy) and continue; the
+ * queue is flushed from SD_Card_Process() with HAL_SD_WriteBlocks_DMA.
+ * Consecutive queue slots with sequential block addresses are merged into
+ * one multi-block burst, and completion is handled in the SDMMC1
+ * interrupt - the main loop never waits on the card. */
+
+#define SD_WQ_DEPTH             8   // 4 KB of staging RAM
+
+typedef struct {
+    uint8_t data[SD_CARD_BLOCK_SIZE];
+} SD_WriteQueueBlock_t;
+
+static SD_WriteQueueBlock_t sd_wq_blocks[SD_WQ_DEPTH] DCACHE_ALIGNED;
+static uint32_t sd_wq_addr[SD_WQ_DEPTH];    // Target block address per slot
+static volatile uint8_t sd_wq_head = 0;     // Next slot to fill
+static volatile uint8_t sd_wq_tail = 0;     // Next slot to flush
+static volatile uint8_t sd_wq_in_flight = 0;    // Blocks in the active DMA burst
+static volatile uint8_t sd_wq_busy = 0;
+static uint32_t sd_wq_queued_total = 0;
+static uint32_t sd_wq_flushed_total = 0;
+static uint32_t sd_wq_dropped = 0;          // Blocks rejected on full queue
+static uint32_t sd_wq_errors = 0;
+
+/**
+  * @brief  Queue one 512-byte block for background DMA write
+  * @param  data: Block contents (copied into the staging queue)
+  * @param  block_address: Target SD block address
+  * @retval SD_CARD_OK if queued, SD_CARD_WRITE_FAILED if the queue is full
+  */
+SD_Card_Status_t SD_Card_QueueWriteBlock(const uint8_t *data, uint32_t block_address)
+{
+    if (data == NULL) {
+        return SD_CARD_ERROR;
+    }
+
+    // Blocks are accepted even with no card in the slot: they sit in the
+    // staging RAM and flush once the lifecycle machine brings a card back
+    // into service, so log capture survives a hot swap
+
+    uint8_t next_head = (sd_wq_head + 1) % SD_WQ_DEPTH;
+    if (next_head == sd_wq_tail) {
+        sd_wq_dropped++;
+        return SD_CARD_WRITE_FAILED;
+    }
+
+    memcpy(sd_wq_blocks[sd_wq_head].data, data, SD_CARD_BLOCK_SIZE);
+    sd_wq_addr[sd_wq_head] = block_address;
+    sd_wq_head = next_head;
+    sd_wq_queued_total++;
+    return SD_CARD_OK;
+}
+
+/**
+  * @brief  Blocks currently waiting (or in flight) in the write queue
+  */
+uint8_t SD_Card_WriteQueue_Pending(void)
+{
+    return (uint8_t)((sd_wq_head - sd_wq_tail + SD_WQ_DEPTH) % SD_WQ_DEPTH);
+}
+
+/**
+  * @brief  Start the next DMA burst if the queue has data and the bus is idle
+  * @note   Called from SD_Card_Process(); merges consecutive slots with
+  *         sequential addresses into a single multi-block write
+  */
+static void SD_Card_WriteQueue_Flush(void)
+{
+    if (sd_wq_busy || sd_wq_head == sd_wq_tail || !sd_card_initialized) {
+        return;
+    }
+
+    if (HAL_SD_GetCardState(&hsd1) != HAL_SD_CARD_TRANSFER) {
+        return;     // Card still programming a previous burst
+    }
+
+    // Count contiguous slots (no ring wrap) with sequential block addresses
+    uint8_t count = 1;
+    while ((sd_wq_tail + count) < SD_WQ_DEPTH &&
+           ((sd_wq_tail + count) % SD_WQ_DEPTH) != sd_wq_head &&
+           sd_wq_addr[sd_wq_tail + count] == sd_wq_addr[sd_wq_tail] + count) {
+        count++;
+    }
+
+    sd_wq_busy = 1;
+    sd_wq_in_flight = count;
+
+    // Write staged blocks back to memory before the SDMMC DMA reads them
+    DCache_CleanRange(sd_wq_blocks[sd_wq_tail].data,
+                      (uint32_t)count * SD_CARD_BLOCK_SIZE);
+
+    if (HAL_SD_WriteBlocks_DMA(&hsd1, sd_wq_blocks[sd_wq_tail].data,
+                               sd_wq_addr[sd_wq_tail], count) != HAL_OK) {
+        sd_wq_busy = 0;
+        sd_wq_in_flight = 0;
+        sd_wq_errors++;
+    }
+}
+
+/**
+  * @brief  DMA write burst complete - advance the queue tail
+  * @note   Interrupt context (SDMMC1 IRQ via HAL_SD_TxCpltCallback)
+  */
+void HAL_SD_TxCpltCallback(SD_HandleTypeDef *hsd)
+{
+    if (hsd->Instance == SDMMC1) {
+        sd_wq_tail = (sd_wq_tail + sd_wq_in_flight) % SD_WQ_DEPTH;
+        sd_wq_flushed_total += sd_wq_in_flight;
+        sd_wq_in_flight = 0;
+        sd_wq_busy = 0;
+        EventQueue_Post(EVENT_SD_WRITE_DONE, 0, 0);  // Wake the SD task for the next burst
+    }
+}
+
+/**
+  * @brief  SD transfer error - drop the burst so logging can continue
+  * @note   Interrupt context
+  */
+void HAL_SD_ErrorCallback(SD_HandleTypeDef *hsd)
+{
+    if (hsd->Instance == SDMMC1) {
+        sd_wq_tail = (sd_wq_tail + sd_wq_in_flight) % SD_WQ_DEPTH;
+        sd_wq_in_flight = 0;
+        sd_wq_busy = 0;
+        sd_wq_errors++;
+    }
+}
+
+/**
+  * @brief  Print write-behind queue statistics
+  */
+void SD_Card_WriteQueue_Stats(void)
+{
+    char msg[120];
+    snprintf(msg, sizeof(msg),
+             "SD write queue: pending=%u queued=%lu flushed=%lu dropped=%lu errors=%lu\r\n",
+             SD_Card_WriteQueue_Pending(), sd_wq_queued_total,
+             sd_wq_flushed_total, sd_wq_dropped, sd_wq_errors);
+    Send_Debug_Data(msg);
+}
+
 /**
   * @brief  SD Card simple diagnostic
   */
@@ -157,6 +354,10 @@ static void MX_SDMMC1_SD_Init(void)
     hsd1.Init.BusWide = SDMMC_BUS_WIDE_1B;
     hsd1.Init.HardwareFlowControl = SDMMC_HARDWARE_FLOW_CONTROL_DISABLE;
     hsd1.Init.ClockDiv = 8;
+
+    /* SDMMC1 interrupt - DMA transfer completion for the write-behind queue */
+    HAL_NVIC_SetPriority(SDMMC1_IRQn, 6, 0);
+    HAL_NVIC_EnableIRQ(SDMMC1_IRQn);
 }
 
 static void MX_SDMMC1_GPIO_Init(void)
@@ -277,74 +478,109 @@ void SD_Card_Communication_Diagnostic(void)
 }
 
 /**
-  * @brief  Process SD card insertion/removal detection - ONLY INSERT/REMOVE
+  * @brief  Card was pulled or stopped responding - take it out of service
+  * @note   Queued write-behind blocks are kept: the tail is not advanced,
+  *         so an abandoned in-flight burst is re-flushed after remount
+  */
+static void SD_Card_Lifecycle_CardLost(void)
+{
+    sd_card_initialized = 0;
+    sd_card_present = 0;
+    sd_wq_busy = 0;
+    sd_wq_in_flight = 0;
+    HAL_SD_DeInit(&hsd1);
+    sd_lc_state = SD_LC_ABSENT;
+    sd_lc_next_action = HAL_GetTick() + SD_LC_PROBE_INTERVAL_MS;
+}
+
+/**
+  * @brief  Advance the card lifecycle machine and flush pending writes
+  * @note   One lifecycle step per pass; every wait is a deadline
+  *         comparison, never a HAL_Delay()
   */
 void SD_Card_Process(void)
 {
-    static uint8_t last_card_state = 0;
-    static uint32_t last_detection_time = 0;
-    
-    // Only check every 1 second to avoid spam
-    if (HAL_GetTick() - last_detection_time < 1000) {
-        return;
-    }
-    last_detection_time = HAL_GetTick();
-    
-    // Check current card state
-    uint8_t current_card_state = 0;
-    
-    if (sd_card_initialized) {
-        HAL_SD_CardStateTypeDef state = HAL_SD_GetCardState(&hsd1);
-        if (state == HAL_SD_CARD_TRANSFER || 
-            state == HAL_SD_CARD_SENDING || 
-            state == HAL_SD_CARD_RECEIVING ||
-            state == HAL_SD_CARD_PROGRAMMING ||
-            state == HAL_SD_CARD_STANDBY) {
-            current_card_state = 1;  // Card present and working
-        } else {
-            current_card_state = 0;  // Card removed or error
+    uint32_t now = HAL_GetTick();
+
+    // Flush pending write-behind blocks on every pass (DMA start only)
+    SD_Card_WriteQueue_Flush();
+
+    switch (sd_lc_state) {
+    case SD_LC_READY: {
+        if ((int32_t)(now - sd_lc_next_action) < 0) {
+            break;
         }
-    } else {
-        // Try to detect card insertion
-        HAL_StatusTypeDef result = HAL_SD_Init(&hsd1);
-        if (result == HAL_OK) {
-            HAL_SD_CardStateTypeDef state = HAL_SD_GetCardState(&hsd1);
-            if (state == HAL_SD_CARD_TRANSFER || state == HAL_SD_CARD_STANDBY) {
-                current_card_state = 1;  // Card inserted
-                sd_card_initialized = 1;
-                sd_card_present = 1;
-            }
+        sd_lc_next_action = now + SD_LC_CHECK_INTERVAL_MS;
+
+        HAL_SD_CardStateTypeDef state = HAL_SD_GetCardState(&hsd1);
+        if (state != HAL_SD_CARD_TRANSFER &&
+            state != HAL_SD_CARD_SENDING &&
+            state != HAL_SD_CARD_RECEIVING &&
+            state != HAL_SD_CARD_PROGRAMMING &&
+            state != HAL_SD_CARD_STANDBY) {
+            Send_Debug_Data("SD Card: REMOVED (log capture buffering in RAM)\r\n");
+            SD_Card_Lifecycle_CardLost();
         }
+        break;
     }
-    
-    // Check for state changes - ONLY show insert/remove
-    if (current_card_state != last_card_state) {
-        if (current_card_state == 1) {
-            // Card inserted or reconnected
-            if (!sd_card_initialized) {
-                // Initialize the card silently
-                if (HAL_SD_Init(&hsd1) == HAL_OK) {
-                    HAL_SD_CardStateTypeDef state = HAL_SD_GetCardState(&hsd1);
-                    if (state == HAL_SD_CARD_TRANSFER || state == HAL_SD_CARD_STANDBY) {
-                        sd_card_initialized = 1;
-                        sd_card_present = 1;
-                        Send_Debug_Data("SD Card: INSERTED\r\n");
-                    }
-                }
-            } else {
-                Send_Debug_Data("SD Card: RECONNECTED\r\n");
+
+    case SD_LC_ABSENT:
+        if ((int32_t)(now - sd_lc_next_action) < 0) {
+            break;
+        }
+        // Release the bus before a fresh probe, then let it settle
+        HAL_SD_DeInit(&hsd1);
+        sd_lc_state = SD_LC_SETTLE;
+        sd_lc_next_action = now + SD_LC_SETTLE_TIME_MS;
+        break;
+
+    case SD_LC_SETTLE:
+        if ((int32_t)(now - sd_lc_next_action) < 0) {
+            break;
+        }
+        sd_lc_state = SD_LC_INIT;
+        break;
+
+    case SD_LC_INIT:
+        if (HAL_SD_Init(&hsd1) == HAL_OK) {
+            sd_lc_good_reads = 0;
+            sd_lc_state = SD_LC_VERIFY;
+        } else {
+            // No card (or not ready yet) - back off until the next probe
+            sd_lc_state = SD_LC_ABSENT;
+            sd_lc_next_action = now + SD_LC_PROBE_INTERVAL_MS;
+        }
+        break;
+
+    case SD_LC_VERIFY: {
+        HAL_SD_CardStateTypeDef state = HAL_SD_GetCardState(&hsd1);
+        if (state == HAL_SD_CARD_TRANSFER || state == HAL_SD_CARD_STANDBY) {
+            if (++sd_lc_good_reads >= SD_LC_DEBOUNCE_READS) {
+                sd_lc_state = SD_LC_MOUNT;
             }
         } else {
-            // Card removed
-            Send_Debug_Data("SD Card: REMOVED\r\n");
-            sd_card_initialized = 0;
-            sd_card_present = 0;
-            
-            // Deinitialize to free resources
-            HAL_SD_DeInit(&hsd1);
+            sd_lc_state = SD_LC_ABSENT;
+            sd_lc_next_action = now + SD_LC_PROBE_INTERVAL_MS;
         }
-        
-        last_card_state = current_card_state;
+        break;
+    }
+
+    case SD_LC_MOUNT:
+        sd_card_initialized = 1;
+        sd_card_present = 1;
+        sd_lc_swap_count++;
+        // Recover the ring-log write position on the (re)inserted card;
+        // a handful of superblock/scan reads, once per insertion
+        SDLog_Init();
+        Send_Debug_Data("SD Card: INSERTED - buffered log writes flushing\r\n");
+        sd_lc_state = SD_LC_READY;
+        sd_lc_next_action = now + SD_LC_CHECK_INTERVAL_MS;
+        break;
+
+    default:
+        sd_lc_state = SD_LC_ABSENT;
+        sd_lc_next_action = now + SD_LC_PROBE_INTERVAL_MS;
+        break;
     }
 }
 
@@ -591,7 +827,17 @@ void SD_Card_Status_Display(void)
     
     snprintf(msg, sizeof(msg), "Present: %s\r\n", sd_card_present ? "YES" : "NO");
     Send_Debug_Data(msg);
-    
+
+    {
+        static const char *lc_names[] = {
+            "ABSENT", "SETTLE", "INIT", "VERIFY", "MOUNT", "READY"
+        };
+        snprintf(msg, sizeof(msg), "Lifecycle: %s (swaps: %lu, buffered: %u)\r\n",
+                 lc_names[sd_lc_state], sd_lc_swap_count,
+                 SD_Card_WriteQueue_Pending());
+        Send_Debug_Data(msg);
+    }
+
     if (sd_card_initialized) {
         // Get card state
         HAL_SD_CardStateTypeDef card_state = HAL_SD_GetCardState(&hsd1);
@@ -621,32 +867,21 @@ void SD_Card_Status_Display(void)
 }
 
 /**
-  * @brief  Manual SD card detection - CLEAN OUTPUT
+  * @brief  Manual SD card re-detection - schedules a fresh lifecycle pass
+  * @note   Returns immediately; the result ("SD Card: INSERTED") is
+  *         reported from SD_Card_Process() once the staged init completes
   */
 void SD_Card_Manual_Detection(void)
 {
-    // Force deinitialize first
-    HAL_SD_DeInit(&hsd1);
-    HAL_Delay(100);
-    
-    // Reset state
     sd_card_initialized = 0;
     sd_card_present = 0;
-    
-    // Try to detect card
-    HAL_StatusTypeDef result = HAL_SD_Init(&hsd1);
-    if (result == HAL_OK) {
-        HAL_SD_CardStateTypeDef state = HAL_SD_GetCardState(&hsd1);
-        if (state == HAL_SD_CARD_TRANSFER || state == HAL_SD_CARD_STANDBY) {
-            sd_card_initialized = 1;
-            sd_card_present = 1;
-            Send_Debug_Data("SD Card: DETECTED\r\n");
-        } else {
-            Send_Debug_Data("SD Card: NOT DETECTED\r\n");
-        }
-    } else {
-        Send_Debug_Data("SD Card: NOT DETECTED\r\n");
-    }
+    sd_wq_busy = 0;
+    sd_wq_in_flight = 0;
+
+    // Probe on the next Process pass instead of blocking here
+    sd_lc_state = SD_LC_ABSENT;
+    sd_lc_next_action = HAL_GetTick();
+    Send_Debug_Data("SD Card: re-detection scheduled\r\n");
 }
 
 /**
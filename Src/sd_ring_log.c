@@ -0,0 +1,350 @@
+/**
+ * @file    sd_ring_log.c
+ * @brief   Append-Only SD Ring Log Implementation
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ */
+
+#include "sd_ring_log.h"
+#include "sd_card.h"
+#include "crc_util.h"
+#include "uart_comm.h"
+#include <string.h>
+#include <stdio.h>
+
+/* ========================================================================== */
+/* PRIVATE VARIABLES                                                          */
+/* ========================================================================== */
+
+static SDLog_Superblock_t sdlog_super;
+static uint8_t sdlog_ready = 0;
+
+/* RAM sector being filled - appended through the write-behind queue when full */
+static uint8_t sdlog_sector[SD_CARD_BLOCK_SIZE];
+static uint8_t sdlog_sector_fill = 0;       // Records in the RAM sector
+
+static uint32_t sdlog_appends = 0;
+static uint32_t sdlog_drops = 0;            // Records lost to queue-full
+static uint32_t sdlog_sectors_since_sync = 0;
+
+/* ========================================================================== */
+/* PRIVATE FUNCTIONS                                                          */
+/* ========================================================================== */
+
+/**
+ * @brief Queue the superblock sector to the card
+ */
+static SDLog_Status_t SDLog_WriteSuperblock(void)
+{
+    uint8_t sector[SD_CARD_BLOCK_SIZE];
+
+    sdlog_super.crc32 = CRC32_Calculate((const uint8_t*)&sdlog_super,
+                                        sizeof(SDLog_Superblock_t) - sizeof(uint32_t));
+    memset(sector, 0xFF, sizeof(sector));
+    memcpy(sector, &sdlog_super, sizeof(SDLog_Superblock_t));
+
+    if (SD_Card_QueueWriteBlock(sector, SDLOG_SUPERBLOCK_BLOCK) != SD_CARD_OK) {
+        return SDLOG_ERROR;
+    }
+    return SDLOG_OK;
+}
+
+/**
+ * @brief Start a fresh, empty log (new card or corrupt superblock)
+ */
+static void SDLog_Format(void)
+{
+    memset(&sdlog_super, 0, sizeof(sdlog_super));
+    sdlog_super.magic = SDLOG_MAGIC;
+    sdlog_super.version = SDLOG_VERSION;
+    sdlog_super.head_sector = 0;
+    sdlog_super.tail_sector = 0;
+    sdlog_super.next_sequence = 1;      // 0 marks never-written sectors
+    sdlog_super.wrap_count = 0;
+
+    SDLog_WriteSuperblock();
+    Send_Debug_Data("SDLog: Formatted new ring log\r\n");
+}
+
+/**
+ * @brief First record sequence of a data sector, 0 if unreadable/blank
+ */
+static uint32_t SDLog_SectorFirstSequence(uint32_t ring_sector)
+{
+    uint8_t sector[SD_CARD_BLOCK_SIZE];
+    SDLog_Record_t *rec = (SDLog_Record_t*)sector;
+
+    if (SD_Card_ReadSingleBlock(sector, SDLOG_DATA_START_BLOCK + ring_sector) != SD_CARD_OK) {
+        return 0;
+    }
+    if (rec->type == SDLOG_REC_EMPTY || rec->type > SDLOG_REC_ALARM) {
+        return 0;
+    }
+    return rec->sequence;
+}
+
+/**
+ * @brief Append the filled RAM sector to the ring and advance the head
+ */
+static SDLog_Status_t SDLog_CommitSector(void)
+{
+    uint32_t block = SDLOG_DATA_START_BLOCK + sdlog_super.head_sector;
+
+    if (SD_Card_QueueWriteBlock(sdlog_sector, block) != SD_CARD_OK) {
+        sdlog_drops += sdlog_sector_fill;
+        sdlog_sector_fill = 0;
+        memset(sdlog_sector, 0, sizeof(sdlog_sector));
+        return SDLOG_ERROR;
+    }
+
+    sdlog_super.head_sector = (sdlog_super.head_sector + 1) % SDLOG_DATA_BLOCKS;
+    if (sdlog_super.head_sector == sdlog_super.tail_sector) {
+        // Ring full - oldest sector is consumed by the new head
+        sdlog_super.tail_sector = (sdlog_super.tail_sector + 1) % SDLOG_DATA_BLOCKS;
+    }
+    if (sdlog_super.head_sector == 0) {
+        sdlog_super.wrap_count++;
+    }
+
+    sdlog_sector_fill = 0;
+    memset(sdlog_sector, 0, sizeof(sdlog_sector));
+
+    // Re-write the superblock every few sectors; boot recovery covers the gap
+    if (++sdlog_sectors_since_sync >= SDLOG_SUPERBLOCK_SYNC) {
+        sdlog_sectors_since_sync = 0;
+        SDLog_WriteSuperblock();
+    }
+    return SDLOG_OK;
+}
+
+/**
+ * @brief Append one record of the given type
+ */
+static SDLog_Status_t SDLog_Append(uint8_t type, const void *payload, uint8_t length)
+{
+    if (!sdlog_ready) return SDLOG_NOT_READY;
+    if (length > sizeof(((SDLog_Record_t*)0)->payload)) return SDLOG_ERROR;
+
+    SDLog_Record_t *rec = (SDLog_Record_t*)&sdlog_sector[sdlog_sector_fill * SDLOG_RECORD_SIZE];
+    memset(rec, 0, SDLOG_RECORD_SIZE);
+    rec->sequence = sdlog_super.next_sequence++;
+    rec->type = type;
+    rec->length = length;
+    memcpy(rec->payload, payload, length);
+    rec->crc16 = CRC16_Modbus(rec->payload, length);
+
+    sdlog_appends++;
+    if (++sdlog_sector_fill >= SDLOG_RECORDS_PER_SECTOR) {
+        return SDLog_CommitSector();
+    }
+    return SDLOG_OK;
+}
+
+/* ========================================================================== */
+/* PUBLIC FUNCTIONS                                                           */
+/* ========================================================================== */
+
+SDLog_Status_t SDLog_Init(void)
+{
+    uint8_t sector[SD_CARD_BLOCK_SIZE];
+
+    sdlog_ready = 0;
+    sdlog_sector_fill = 0;
+    memset(sdlog_sector, 0, sizeof(sdlog_sector));
+
+    if (!SD_Card_Is_Initialized()) {
+        Send_Debug_Data("SDLog: SD card not available\r\n");
+        return SDLOG_ERROR;
+    }
+
+    if (SD_Card_ReadSingleBlock(sector, SDLOG_SUPERBLOCK_BLOCK) != SD_CARD_OK) {
+        return SDLOG_ERROR;
+    }
+
+    memcpy(&sdlog_super, sector, sizeof(SDLog_Superblock_t));
+    uint32_t crc = CRC32_Calculate((const uint8_t*)&sdlog_super,
+                                   sizeof(SDLog_Superblock_t) - sizeof(uint32_t));
+
+    if (sdlog_super.magic != SDLOG_MAGIC || sdlog_super.version != SDLOG_VERSION ||
+        sdlog_super.crc32 != crc) {
+        SDLog_Format();
+        sdlog_ready = 1;
+        return SDLOG_OK;
+    }
+
+    /* The superblock can lag the true head by up to SDLOG_SUPERBLOCK_SYNC
+     * sectors. Walk forward while sequence numbers keep increasing - at
+     * most SDLOG_SUPERBLOCK_SYNC reads, independent of log size. */
+    uint32_t last_seq = sdlog_super.next_sequence - 1;
+    for (uint32_t i = 0; i < SDLOG_SUPERBLOCK_SYNC; i++) {
+        uint32_t seq = SDLog_SectorFirstSequence(sdlog_super.head_sector);
+        if (seq == 0 || seq < sdlog_super.next_sequence) {
+            break;      // Blank or stale sector - head found
+        }
+        last_seq = seq + SDLOG_RECORDS_PER_SECTOR - 1;
+        sdlog_super.head_sector = (sdlog_super.head_sector + 1) % SDLOG_DATA_BLOCKS;
+        if (sdlog_super.head_sector == sdlog_super.tail_sector) {
+            sdlog_super.tail_sector = (sdlog_super.tail_sector + 1) % SDLOG_DATA_BLOCKS;
+        }
+    }
+    sdlog_super.next_sequence = last_seq + 1;
+
+    sdlog_ready = 1;
+
+    char msg[100];
+    snprintf(msg, sizeof(msg), "SDLog: Mounted, head=%lu tail=%lu seq=%lu\r\n",
+             sdlog_super.head_sector, sdlog_super.tail_sector,
+             sdlog_super.next_sequence);
+    Send_Debug_Data(msg);
+    return SDLOG_OK;
+}
+
+SDLog_Status_t SDLog_AppendSensor(const SensorLogEntry_t *entry)
+{
+    if (entry == NULL) return SDLOG_ERROR;
+    return SDLog_Append(SDLOG_REC_SENSOR, entry, sizeof(SensorLogEntry_t));
+}
+
+SDLog_Status_t SDLog_AppendAlarm(const AlarmLogEntry_t *entry)
+{
+    if (entry == NULL) return SDLOG_ERROR;
+    return SDLog_Append(SDLOG_REC_ALARM, entry, sizeof(AlarmLogEntry_t));
+}
+
+SDLog_Status_t SDLog_AppendPerf(const PerfLogEntry_t *entry)
+{
+    if (entry == NULL) return SDLOG_ERROR;
+    return SDLog_Append(SDLOG_REC_PERF, entry, sizeof(PerfLogEntry_t));
+}
+
+SDLog_Status_t SDLog_Flush(void)
+{
+    if (!sdlog_ready) return SDLOG_NOT_READY;
+    if (sdlog_sector_fill == 0) return SDLOG_OK;
+
+    // Remaining slots stay zeroed (SDLOG_REC_EMPTY) - readers skip them
+    SDLog_Status_t status = SDLog_CommitSector();
+    SDLog_WriteSuperblock();
+    sdlog_sectors_since_sync = 0;
+    return status;
+}
+
+SDLog_Status_t SDLog_ReadRecord(uint32_t index, SDLog_Record_t *record)
+{
+    if (!sdlog_ready || record == NULL) return SDLOG_NOT_READY;
+
+    uint32_t used_sectors = (sdlog_super.head_sector - sdlog_super.tail_sector +
+                             SDLOG_DATA_BLOCKS) % SDLOG_DATA_BLOCKS;
+    uint32_t sector_off = index / SDLOG_RECORDS_PER_SECTOR;
+    uint32_t rec_off = index % SDLOG_RECORDS_PER_SECTOR;
+
+    if (sector_off >= used_sectors) return SDLOG_ERROR;
+
+    uint8_t sector[SD_CARD_BLOCK_SIZE];
+    uint32_t ring_sector = (sdlog_super.tail_sector + sector_off) % SDLOG_DATA_BLOCKS;
+    if (SD_Card_ReadSingleBlock(sector, SDLOG_DATA_START_BLOCK + ring_sector) != SD_CARD_OK) {
+        return SDLOG_ERROR;
+    }
+
+    memcpy(record, &sector[rec_off * SDLOG_RECORD_SIZE], SDLOG_RECORD_SIZE);
+    if (record->type == SDLOG_REC_EMPTY ||
+        record->crc16 != CRC16_Modbus(record->payload, record->length)) {
+        return SDLOG_ERROR;
+    }
+    return SDLOG_OK;
+}
+
+uint32_t SDLog_ReadSectors(uint32_t sector_off, uint8_t *buffer, uint32_t max_sectors)
+{
+    if (!sdlog_ready || buffer == NULL || max_sectors == 0) return 0;
+
+    uint32_t used_sectors = (sdlog_super.head_sector - sdlog_super.tail_sector +
+                             SDLOG_DATA_BLOCKS) % SDLOG_DATA_BLOCKS;
+    if (sector_off >= used_sectors) return 0;
+
+    uint32_t count = used_sectors - sector_off;
+    if (count > max_sectors) count = max_sectors;
+
+    // Clip at the physical end of the ring so the card sees one
+    // contiguous multi-block read; the caller comes back for the rest
+    uint32_t ring_sector = (sdlog_super.tail_sector + sector_off) % SDLOG_DATA_BLOCKS;
+    if (ring_sector + count > SDLOG_DATA_BLOCKS) {
+        count = SDLOG_DATA_BLOCKS - ring_sector;
+    }
+
+    if (SD_Card_ReadBlocks(buffer, SDLOG_DATA_START_BLOCK + ring_sector,
+                           count) != SD_CARD_OK) {
+        return 0;
+    }
+    return count;
+}
+
+uint32_t SDLog_GetRecordCount(void)
+{
+    uint32_t used_sectors = (sdlog_super.head_sector - sdlog_super.tail_sector +
+                             SDLOG_DATA_BLOCKS) % SDLOG_DATA_BLOCKS;
+    return used_sectors * SDLOG_RECORDS_PER_SECTOR + sdlog_sector_fill;
+}
+
+uint8_t SDLog_IsReady(void)
+{
+    return sdlog_ready;
+}
+
+void SDLog_PrintStatus(void)
+{
+    char msg[140];
+
+    Send_Debug_Data("\r\n=== SD Ring Log ===\r\n");
+    snprintf(msg, sizeof(msg), "State: %s, head=%lu tail=%lu wraps=%lu\r\n",
+             sdlog_ready ? "MOUNTED" : "OFFLINE",
+             sdlog_super.head_sector, sdlog_super.tail_sector,
+             sdlog_super.wrap_count);
+    Send_Debug_Data(msg);
+    snprintf(msg, sizeof(msg), "Records: %lu on card, %u in RAM, %lu appended, %lu dropped\r\n",
+             SDLog_GetRecordCount(), sdlog_sector_fill, sdlog_appends, sdlog_drops);
+    Send_Debug_Data(msg);
+    Send_Debug_Data("===================\r\n\r\n");
+}
+
+void SDLog_DumpPerfRecords(uint32_t max_records)
+{
+    if (!sdlog_ready) {
+        Send_Debug_Data("SDLog: not mounted\r\n");
+        return;
+    }
+
+    uint32_t count = SDLog_GetRecordCount();
+    uint32_t start = (count > max_records) ? (count - max_records) : 0;
+    uint32_t dumped = 0;
+    SDLog_Record_t record;
+    char msg[120];
+
+    Send_Debug_Data("=== Performance Snapshots ===\r\n");
+    Send_Debug_Data("Seq        Time     Unit   Hours    Starts  Faults  Eff     Trend\r\n");
+
+    for (uint32_t i = start; i < count; i++) {
+        if (SDLog_ReadRecord(i, &record) != SDLOG_OK) continue;
+        if (record.type != SDLOG_REC_PERF ||
+            record.length < sizeof(PerfLogEntry_t)) continue;
+
+        PerfLogEntry_t entry;
+        memcpy(&entry, record.payload, sizeof(PerfLogEntry_t));
+
+        snprintf(msg, sizeof(msg),
+                 "%-10lu %-8lu %s%-2u  %-8lu %-7lu %-7u %-7.3f %.5f\r\n",
+                 record.sequence, entry.timestamp,
+                 (entry.unit_type == SDLOG_PERF_UNIT_COMPRESSOR) ? "CP" : "CD",
+                 entry.unit_index + 1, entry.runtime_hours, entry.start_cycles,
+                 entry.fault_count,
+                 (float)entry.efficiency_q16 / 65536.0f,
+                 (float)entry.trend_q16 / 65536.0f);
+        Send_Debug_Data(msg);
+        dumped++;
+    }
+
+    snprintf(msg, sizeof(msg), "%lu records (scanned %lu)\r\n",
+             dumped, count - start);
+    Send_Debug_Data(msg);
+}
@@ -1,6 +1,7 @@
 #include "spi_w5500.h"
 #include "spi.h"
 #include "uart_comm.h"
+#include "dcache_util.h"
 #include <string.h>
 #include <stdio.h>
 
@@ -24,7 +25,44 @@ void SPI_W5500_Init(void) {
     Send_Debug_Data("SPI_W5500: Initialized\r\n");
 }
 
+/* Every W5500 access asserts CS exactly once, so counting CS assertions
+ * counts SPI transactions - the number we need when deciding whether a
+ * throughput problem lives on the bus or in the socket layer. */
+static uint32_t spi_w5500_transactions = 0;
+
+uint32_t SPI_W5500_GetTransactionCount(void) {
+    return spi_w5500_transactions;
+}
+
+/* Set while a DMA burst owns the bus (CS held asserted) - declared up
+ * here because every polled transaction must wait for it */
+static volatile uint8_t spi_w5500_dma_busy = 0;
+
+/**
+ * @brief Block until any in-flight DMA burst releases the bus
+ * A polled transaction during a DMA burst would toggle CS mid-transfer
+ * and clock bytes into the middle of it, so every CS assertion waits
+ * here first. The timeout covers a lost completion interrupt - forcing
+ * the bus free beats hanging the loop.
+ */
+static void SPI_W5500_WaitDmaIdle(void) {
+    if (!spi_w5500_dma_busy) return;
+
+    uint32_t start = HAL_GetTick();
+    while (spi_w5500_dma_busy) {
+        if ((HAL_GetTick() - start) > 10) {
+            HAL_SPI_DMAStop(&hspi4);
+            HAL_GPIO_WritePin(W5500_CS_PORT, W5500_CS_PIN, GPIO_PIN_SET);
+            spi_w5500_dma_busy = 0;
+            Send_Debug_Data("SPI_W5500: DMA completion timeout, bus forced free\r\n");
+            return;
+        }
+    }
+}
+
 void SPI_W5500_CS_Enable(void) {
+    SPI_W5500_WaitDmaIdle();
+    spi_w5500_transactions++;
     HAL_GPIO_WritePin(W5500_CS_PORT, W5500_CS_PIN, GPIO_PIN_RESET);
 }
 
@@ -32,33 +70,182 @@ void SPI_W5500_CS_Disable(void) {
     HAL_GPIO_WritePin(W5500_CS_PORT, W5500_CS_PIN, GPIO_PIN_SET);
 }
 
+/* Note: the HAL_Delay(1) guards that used to bracket every transfer are gone.
+ * The W5500 needs no settling time between CS and clocking at our SPI rates,
+ * and the two delays cost 2 ms per single-byte register access. */
+
 HAL_StatusTypeDef SPI_W5500_TransmitReceive(uint8_t *tx_data, uint8_t *rx_data, uint16_t size) {
     SPI_W5500_CS_Enable();
-    HAL_Delay(1);
     HAL_StatusTypeDef status = HAL_SPI_TransmitReceive(&hspi4, tx_data, rx_data, size, 1000);
-    HAL_Delay(1);
     SPI_W5500_CS_Disable();
     return status;
 }
 
 HAL_StatusTypeDef SPI_W5500_Transmit(uint8_t *tx_data, uint16_t size) {
     SPI_W5500_CS_Enable();
-    HAL_Delay(1);
     HAL_StatusTypeDef status = HAL_SPI_Transmit(&hspi4, tx_data, size, 1000);
-    HAL_Delay(1);
     SPI_W5500_CS_Disable();
     return status;
 }
 
 HAL_StatusTypeDef SPI_W5500_Receive(uint8_t *rx_data, uint16_t size) {
     SPI_W5500_CS_Enable();
-    HAL_Delay(1);
     HAL_StatusTypeDef status = HAL_SPI_Receive(&hspi4, rx_data, size, 1000);
-    HAL_Delay(1);
     SPI_W5500_CS_Disable();
     return status;
 }
 
+/* === Burst (sequential) transfers ===
+ * The W5500 auto-increments the address after every data byte, so a whole
+ * block can be moved with a single 3-byte address phase instead of paying
+ * 3 bytes of overhead per data byte. The control byte selects the register
+ * block (BSB) and direction - needed for the socket TX/RX data buffers,
+ * which have no direct-address aliases. */
+
+HAL_StatusTypeDef SPI_W5500_WriteBurst(uint16_t addr, uint8_t control_byte, const uint8_t *data, uint16_t len) {
+    uint8_t header[3];
+    header[0] = (addr >> 8) & 0xFF;
+    header[1] = addr & 0xFF;
+    header[2] = control_byte | 0x04;  // RWB=1: write
+
+    SPI_W5500_CS_Enable();
+    HAL_StatusTypeDef status = HAL_SPI_Transmit(&hspi4, header, 3, 1000);
+    if (status == HAL_OK && len > 0) {
+        status = HAL_SPI_Transmit(&hspi4, (uint8_t*)data, len, 1000);
+    }
+    SPI_W5500_CS_Disable();
+    return status;
+}
+
+HAL_StatusTypeDef SPI_W5500_ReadBurst(uint16_t addr, uint8_t control_byte, uint8_t *data, uint16_t len) {
+    uint8_t header[3];
+    header[0] = (addr >> 8) & 0xFF;
+    header[1] = addr & 0xFF;
+    header[2] = control_byte & ~0x04;  // RWB=0: read
+
+    SPI_W5500_CS_Enable();
+    HAL_StatusTypeDef status = HAL_SPI_Transmit(&hspi4, header, 3, 1000);
+    if (status == HAL_OK && len > 0) {
+        status = HAL_SPI_Receive(&hspi4, data, len, 1000);
+    }
+    SPI_W5500_CS_Disable();
+    return status;
+}
+
+/* === DMA burst transfers ===
+ * The payload phase runs on SPI4 DMA so the CPU is free during large socket
+ * buffer moves - the W5500 server can kick off a transfer and come back
+ * next loop pass. CS stays asserted until the completion interrupt fires.
+ * Only one DMA transfer can be in flight; callers check SPI_W5500_IsDmaBusy()
+ * or register a completion callback. Polled transactions arriving while a
+ * burst is in flight block in SPI_W5500_WaitDmaIdle (see CS_Enable). */
+static spi_w5500_dma_callback_t spi_w5500_dma_callback = NULL;
+
+/* Active DMA read destination - invalidated again on completion so
+ * speculative cache fills during the transfer cannot mask DMA data */
+static uint8_t *spi_w5500_dma_rx_buf = NULL;
+static uint16_t spi_w5500_dma_rx_len = 0;
+
+uint8_t SPI_W5500_IsDmaBusy(void) {
+    return spi_w5500_dma_busy;
+}
+
+void SPI_W5500_SetDmaCallback(spi_w5500_dma_callback_t callback) {
+    spi_w5500_dma_callback = callback;
+}
+
+HAL_StatusTypeDef SPI_W5500_WriteBurst_DMA(uint16_t addr, uint8_t control_byte, const uint8_t *data, uint16_t len) {
+    if (spi_w5500_dma_busy || len == 0) return HAL_BUSY;
+
+    uint8_t header[3];
+    header[0] = (addr >> 8) & 0xFF;
+    header[1] = addr & 0xFF;
+    header[2] = control_byte | 0x04;  // RWB=1: write
+
+    // CS_Enable first: it waits out any previous burst, and nothing can
+    // start a new one between it and the busy flag (single-threaded loop)
+    SPI_W5500_CS_Enable();
+    spi_w5500_dma_busy = 1;
+
+    // Address phase is 3 bytes - cheaper polled than a second DMA setup
+    HAL_StatusTypeDef status = HAL_SPI_Transmit(&hspi4, header, 3, 1000);
+    if (status == HAL_OK) {
+        DCache_CleanRange(data, len);   // DMA reads memory, not cache
+        status = HAL_SPI_Transmit_DMA(&hspi4, (uint8_t*)data, len);
+    }
+
+    if (status != HAL_OK) {
+        SPI_W5500_CS_Disable();
+        spi_w5500_dma_busy = 0;
+    }
+    return status;
+}
+
+HAL_StatusTypeDef SPI_W5500_ReadBurst_DMA(uint16_t addr, uint8_t control_byte, uint8_t *data, uint16_t len) {
+    if (spi_w5500_dma_busy || len == 0) return HAL_BUSY;
+
+    uint8_t header[3];
+    header[0] = (addr >> 8) & 0xFF;
+    header[1] = addr & 0xFF;
+    header[2] = control_byte & ~0x04;  // RWB=0: read
+
+    SPI_W5500_CS_Enable();
+    spi_w5500_dma_busy = 1;
+
+    HAL_StatusTypeDef status = HAL_SPI_Transmit(&hspi4, header, 3, 1000);
+    if (status == HAL_OK) {
+        /* Drop stale lines now and remember the range - it is invalidated
+         * again on completion in case of speculative refills mid-transfer */
+        DCache_InvalidateRange(data, len);
+        spi_w5500_dma_rx_buf = data;
+        spi_w5500_dma_rx_len = len;
+        status = HAL_SPI_Receive_DMA(&hspi4, data, len);
+    }
+
+    if (status != HAL_OK) {
+        SPI_W5500_CS_Disable();
+        spi_w5500_dma_busy = 0;
+        spi_w5500_dma_rx_buf = NULL;
+    }
+    return status;
+}
+
+/**
+ * @brief DMA transfer complete - release CS, clear busy, notify the owner
+ * @note  Interrupt context
+ */
+static void SPI_W5500_DmaComplete(void) {
+    SPI_W5500_CS_Disable();
+    if (spi_w5500_dma_rx_buf != NULL) {
+        DCache_InvalidateRange(spi_w5500_dma_rx_buf, spi_w5500_dma_rx_len);
+        spi_w5500_dma_rx_buf = NULL;
+    }
+    spi_w5500_dma_busy = 0;
+    if (spi_w5500_dma_callback != NULL) {
+        spi_w5500_dma_callback();
+    }
+}
+
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef *hspi) {
+    if (hspi->Instance == SPI4) {
+        SPI_W5500_DmaComplete();
+    }
+}
+
+void HAL_SPI_RxCpltCallback(SPI_HandleTypeDef *hspi) {
+    if (hspi->Instance == SPI4) {
+        SPI_W5500_DmaComplete();
+    }
+}
+
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi) {
+    if (hspi->Instance == SPI4) {
+        SPI_W5500_CS_Disable();
+        spi_w5500_dma_busy = 0;
+        Send_Debug_Data("SPI_W5500: DMA transfer error\r\n");
+    }
+}
+
 void SPI_W5500_Test_Communication(void) {
     uint8_t tx_data[4] = {0x55, 0xAA, 0x55, 0xAA};
     uint8_t rx_data[4] = {0x00, 0x00, 0x00, 0x00};
@@ -20,8 +20,13 @@
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
 #include "stm32h7xx_it.h"
+#include "gpio_manager.h"
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include "hmi.h"
+#include "watchdog.h"
+#include "control_tick.h"
+#include "cpu_load.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -58,6 +63,15 @@
 
 /* USER CODE BEGIN EV */
 extern UART_HandleTypeDef huart4;
+extern UART_HandleTypeDef huart7;
+extern UART_HandleTypeDef huart8;
+extern DMA_HandleTypeDef hdma_uart8_rx;
+extern DMA_HandleTypeDef hdma_uart7_tx;
+extern DMA_HandleTypeDef hdma_uart4_rx;
+extern SPI_HandleTypeDef hspi4;
+extern DMA_HandleTypeDef hdma_spi4_tx;
+extern DMA_HandleTypeDef hdma_spi4_rx;
+extern SD_HandleTypeDef hsd1;
 /* USER CODE END EV */
 
 /******************************************************************************/
@@ -84,7 +98,14 @@ void NMI_Handler(void)
 void HardFault_Handler(void)
 {
   /* USER CODE BEGIN HardFault_IRQn 0 */
-
+  /* Hand the stacked exception frame to the post-mortem capture */
+  __asm volatile(
+      "tst lr, #4              \n"
+      "ite eq                  \n"
+      "mrseq r0, msp           \n"
+      "mrsne r0, psp           \n"
+      "mov r1, #1              \n"   /* WDG_FAULT_HARDFAULT */
+      "b Watchdog_FaultCapture \n");
   /* USER CODE END HardFault_IRQn 0 */
   while (1)
   {
@@ -99,7 +120,13 @@ void HardFault_Handler(void)
 void MemManage_Handler(void)
 {
   /* USER CODE BEGIN MemoryManagement_IRQn 0 */
-
+  __asm volatile(
+      "tst lr, #4              \n"
+      "ite eq                  \n"
+      "mrseq r0, msp           \n"
+      "mrsne r0, psp           \n"
+      "mov r1, #2              \n"   /* WDG_FAULT_MEMMANAGE */
+      "b Watchdog_FaultCapture \n");
   /* USER CODE END MemoryManagement_IRQn 0 */
   while (1)
   {
@@ -114,7 +141,13 @@ void MemManage_Handler(void)
 void BusFault_Handler(void)
 {
   /* USER CODE BEGIN BusFault_IRQn 0 */
-
+  __asm volatile(
+      "tst lr, #4              \n"
+      "ite eq                  \n"
+      "mrseq r0, msp           \n"
+      "mrsne r0, psp           \n"
+      "mov r1, #3              \n"   /* WDG_FAULT_BUSFAULT */
+      "b Watchdog_FaultCapture \n");
   /* USER CODE END BusFault_IRQn 0 */
   while (1)
   {
@@ -129,7 +162,13 @@ void BusFault_Handler(void)
 void UsageFault_Handler(void)
 {
   /* USER CODE BEGIN UsageFault_IRQn 0 */
-
+  __asm volatile(
+      "tst lr, #4              \n"
+      "ite eq                  \n"
+      "mrseq r0, msp           \n"
+      "mrsne r0, psp           \n"
+      "mov r1, #4              \n"   /* WDG_FAULT_USAGEFAULT */
+      "b Watchdog_FaultCapture \n");
   /* USER CODE END UsageFault_IRQn 0 */
   while (1)
   {
@@ -183,11 +222,13 @@ void PendSV_Handler(void)
 void SysTick_Handler(void)
 {
   /* USER CODE BEGIN SysTick_IRQn 0 */
-
+  uint32_t t0 = CpuLoad_IrqEnter();
   /* USER CODE END SysTick_IRQn 0 */
   HAL_IncTick();
   /* USER CODE BEGIN SysTick_IRQn 1 */
-
+  Input_DebounceTick();     /* Port-wide 1ms input debounce (gpio_manager.c) */
+  HMI_TX_Tick();
+  CpuLoad_IrqExit(CPU_IRQ_SYSTICK, t0);
   /* USER CODE END SysTick_IRQn 1 */
 }
 
@@ -200,12 +241,134 @@ void SysTick_Handler(void)
 
 /* USER CODE BEGIN 1 */
 
+/**
+  * @brief This function handles EXTI line 0 interrupt (E-stop, PA0).
+  */
+void EXTI0_IRQHandler(void)
+{
+  uint32_t t0 = CpuLoad_IrqEnter();
+  HAL_GPIO_EXTI_IRQHandler(GPIO_PIN_0);
+  CpuLoad_IrqExit(CPU_IRQ_EXTI0, t0);
+}
+
+/**
+  * @brief This function handles EXTI lines 9:5 interrupt (phase monitor, PC6).
+  */
+void EXTI9_5_IRQHandler(void)
+{
+  uint32_t t0 = CpuLoad_IrqEnter();
+  HAL_GPIO_EXTI_IRQHandler(GPIO_PIN_6);
+  CpuLoad_IrqExit(CPU_IRQ_EXTI9_5, t0);
+}
+
 /**
   * @brief This function handles UART4 global interrupt.
   */
 void UART4_IRQHandler(void)
 {
+  uint32_t t0 = CpuLoad_IrqEnter();
   HAL_UART_IRQHandler(&huart4);
+  CpuLoad_IrqExit(CPU_IRQ_UART4, t0);
+}
+
+/**
+  * @brief This function handles UART8 global interrupt (Modbus RTU).
+  */
+void UART8_IRQHandler(void)
+{
+  uint32_t t0 = CpuLoad_IrqEnter();
+  HAL_UART_IRQHandler(&huart8);
+  CpuLoad_IrqExit(CPU_IRQ_UART8, t0);
+}
+
+/**
+  * @brief This function handles UART7 global interrupt (debug console).
+  */
+void UART7_IRQHandler(void)
+{
+  uint32_t t0 = CpuLoad_IrqEnter();
+  HAL_UART_IRQHandler(&huart7);
+  CpuLoad_IrqExit(CPU_IRQ_UART7, t0);
+}
+
+/**
+  * @brief This function handles DMA1 stream0 global interrupt (UART8 RX DMA).
+  */
+void DMA1_Stream0_IRQHandler(void)
+{
+  uint32_t t0 = CpuLoad_IrqEnter();
+  HAL_DMA_IRQHandler(&hdma_uart8_rx);
+  CpuLoad_IrqExit(CPU_IRQ_DMA_UART8_RX, t0);
+}
+
+/**
+  * @brief This function handles DMA1 stream1 global interrupt (UART7 TX DMA).
+  */
+void DMA1_Stream1_IRQHandler(void)
+{
+  uint32_t t0 = CpuLoad_IrqEnter();
+  HAL_DMA_IRQHandler(&hdma_uart7_tx);
+  CpuLoad_IrqExit(CPU_IRQ_DMA_UART7_TX, t0);
+}
+
+/**
+  * @brief This function handles SPI4 global interrupt (W5500).
+  */
+void SPI4_IRQHandler(void)
+{
+  uint32_t t0 = CpuLoad_IrqEnter();
+  HAL_SPI_IRQHandler(&hspi4);
+  CpuLoad_IrqExit(CPU_IRQ_SPI4, t0);
+}
+
+/**
+  * @brief This function handles DMA1 stream2 global interrupt (SPI4 TX DMA).
+  */
+void DMA1_Stream2_IRQHandler(void)
+{
+  uint32_t t0 = CpuLoad_IrqEnter();
+  HAL_DMA_IRQHandler(&hdma_spi4_tx);
+  CpuLoad_IrqExit(CPU_IRQ_DMA_SPI4_TX, t0);
+}
+
+/**
+  * @brief This function handles DMA1 stream3 global interrupt (SPI4 RX DMA).
+  */
+void DMA1_Stream3_IRQHandler(void)
+{
+  uint32_t t0 = CpuLoad_IrqEnter();
+  HAL_DMA_IRQHandler(&hdma_spi4_rx);
+  CpuLoad_IrqExit(CPU_IRQ_DMA_SPI4_RX, t0);
+}
+
+/**
+  * @brief This function handles DMA1 stream4 global interrupt (UART4 RX DMA).
+  */
+void DMA1_Stream4_IRQHandler(void)
+{
+  uint32_t t0 = CpuLoad_IrqEnter();
+  HAL_DMA_IRQHandler(&hdma_uart4_rx);
+  CpuLoad_IrqExit(CPU_IRQ_DMA_UART4_RX, t0);
+}
+
+/**
+  * @brief This function handles SDMMC1 global interrupt (write-behind DMA).
+  */
+void SDMMC1_IRQHandler(void)
+{
+  uint32_t t0 = CpuLoad_IrqEnter();
+  HAL_SD_IRQHandler(&hsd1);
+  CpuLoad_IrqExit(CPU_IRQ_SDMMC1, t0);
+}
+
+/**
+  * @brief This function handles TIM7 global interrupt (10ms control tick).
+  */
+void TIM7_IRQHandler(void)
+{
+  uint32_t t0 = CpuLoad_IrqEnter();
+  ControlTick_IRQHandler();
+  CpuLoad_IrqExit(CPU_IRQ_TIM7_TICK, t0);
 }
 
 /* USER CODE END 1 */
@@ -0,0 +1,200 @@
+/**
+ * @file    tcp_cli.c
+ * @brief   Telnet-Style Debug CLI over TCP Implementation
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ */
+
+#include "tcp_cli.h"
+#include "w5500_socket.h"
+#include "uart_comm.h"
+#include <string.h>
+
+/* The command dispatcher lives in main.c next to the serial console */
+extern void Process_DebugCommands(char* command);
+
+/* Connection state machine */
+typedef enum {
+    CLI_STATE_CLOSED = 0,
+    CLI_STATE_LISTENING,
+    CLI_STATE_CONNECTED
+} cli_state_t;
+
+/* Private Variables ---------------------------------------------------------*/
+static cli_state_t cli_state = CLI_STATE_CLOSED;
+static uint32_t cli_last_activity = 0;
+
+/* Line assembly */
+static char cli_line[TCP_CLI_LINE_MAX];
+static uint8_t cli_line_len = 0;
+
+/* Output ring - filled by the debug mirror while a command runs,
+ * drained to the socket as the TX window allows */
+static uint8_t cli_tx_ring[TCP_CLI_TX_RING_SIZE];
+static volatile uint16_t cli_tx_head = 0;
+static volatile uint16_t cli_tx_tail = 0;
+static uint32_t cli_tx_dropped = 0;
+
+static const char cli_banner[] = "Chiller debug CLI - same commands as the serial console\r\n> ";
+static const char cli_prompt[] = "> ";
+
+/* Private Functions ---------------------------------------------------------*/
+
+/**
+ * @brief Debug mirror target: buffer command output for the client
+ */
+static void TCP_CLI_CaptureOutput(const char *message)
+{
+    uint16_t len = (uint16_t)strlen(message);
+    uint16_t used = (cli_tx_head - cli_tx_tail) % TCP_CLI_TX_RING_SIZE;
+    uint16_t free_space = TCP_CLI_TX_RING_SIZE - 1 - used;
+
+    if (len > free_space) {
+        cli_tx_dropped++;
+        return;     // Drop whole messages, never partial lines
+    }
+
+    uint16_t first = TCP_CLI_TX_RING_SIZE - cli_tx_head;
+    if (first > len) first = len;
+    memcpy(&cli_tx_ring[cli_tx_head], message, first);
+    if (len > first) {
+        memcpy(&cli_tx_ring[0], message + first, len - first);
+    }
+    cli_tx_head = (cli_tx_head + len) % TCP_CLI_TX_RING_SIZE;
+}
+
+/**
+ * @brief Drain buffered output into the socket TX window
+ */
+static void TCP_CLI_DrainOutput(void)
+{
+    uint16_t used = (cli_tx_head - cli_tx_tail) % TCP_CLI_TX_RING_SIZE;
+    if (used == 0) return;
+
+    uint16_t window = W5500_Socket_GetTxFreeSize(TCP_CLI_SOCKET);
+    if (window == 0) return;
+    if (used > window) used = window;
+
+    /* Send up to the wrap point; the rest goes next pass */
+    uint16_t chunk = TCP_CLI_TX_RING_SIZE - cli_tx_tail;
+    if (chunk > used) chunk = used;
+
+    uint16_t sent = W5500_Socket_SendData(TCP_CLI_SOCKET,
+                                          &cli_tx_ring[cli_tx_tail], chunk);
+    cli_tx_tail = (cli_tx_tail + sent) % TCP_CLI_TX_RING_SIZE;
+    if (sent > 0) {
+        cli_last_activity = HAL_GetTick();
+    }
+}
+
+/**
+ * @brief Run one assembled command line through the shared dispatcher,
+ *        capturing its debug output for the remote client
+ */
+static void TCP_CLI_ExecuteLine(void)
+{
+    cli_line[cli_line_len] = '\0';
+    cli_line_len = 0;
+
+    if (cli_line[0] == '\0') {
+        TCP_CLI_CaptureOutput(cli_prompt);
+        return;
+    }
+
+    Debug_SetMirror(TCP_CLI_CaptureOutput);
+    Process_DebugCommands(cli_line);
+    Debug_SetMirror(NULL);
+
+    TCP_CLI_CaptureOutput(cli_prompt);
+}
+
+/**
+ * @brief Feed received bytes into the line assembler
+ */
+static void TCP_CLI_FeedInput(const uint8_t *data, uint16_t length)
+{
+    for (uint16_t i = 0; i < length; i++) {
+        uint8_t byte = data[i];
+
+        if (byte == '\n') {
+            TCP_CLI_ExecuteLine();
+        } else if (byte == '\r') {
+            continue;   // Telnet clients send CRLF
+        } else if (byte >= 0x20 && byte < 0x7F) {
+            if (cli_line_len < TCP_CLI_LINE_MAX - 1) {
+                cli_line[cli_line_len++] = (char)byte;
+            }
+        }
+        /* Telnet IAC negotiation and other control bytes are ignored */
+    }
+}
+
+/* Public Functions ----------------------------------------------------------*/
+
+void TCP_CLI_Init(void)
+{
+    cli_line_len = 0;
+    cli_tx_head = 0;
+    cli_tx_tail = 0;
+
+    if (W5500_Socket_Init_TCP_Server(TCP_CLI_SOCKET, TCP_CLI_PORT)) {
+        cli_state = CLI_STATE_LISTENING;
+        Send_Debug_Data("TCP CLI: Listening on port 2323\r\n");
+    } else {
+        cli_state = CLI_STATE_CLOSED;
+        Send_Debug_Data("TCP CLI: Socket init failed\r\n");
+    }
+}
+
+void TCP_CLI_Process(void)
+{
+    if (cli_state == CLI_STATE_CLOSED) return;
+
+    uint8_t status = W5500_Socket_GetStatus(TCP_CLI_SOCKET);
+
+    switch (status) {
+        case W5500_SOCK_ESTABLISHED:
+            if (cli_state == CLI_STATE_LISTENING) {
+                cli_state = CLI_STATE_CONNECTED;
+                cli_last_activity = HAL_GetTick();
+                cli_tx_head = 0;
+                cli_tx_tail = 0;
+                cli_line_len = 0;
+                TCP_CLI_CaptureOutput(cli_banner);
+            }
+
+            if (W5500_Socket_GetRxReceivedSize(TCP_CLI_SOCKET) > 0) {
+                uint8_t rx_buf[64];
+                uint16_t len = W5500_Socket_ReceiveData(TCP_CLI_SOCKET,
+                                                        rx_buf, sizeof(rx_buf));
+                if (len > 0) {
+                    cli_last_activity = HAL_GetTick();
+                    TCP_CLI_FeedInput(rx_buf, len);
+                }
+            }
+
+            TCP_CLI_DrainOutput();
+
+            if (HAL_GetTick() - cli_last_activity > TCP_CLI_IDLE_TIMEOUT_MS) {
+                W5500_Socket_Disconnect(TCP_CLI_SOCKET);
+            }
+            break;
+
+        case W5500_SOCK_CLOSE_WAIT:
+            W5500_Socket_Disconnect(TCP_CLI_SOCKET);
+            break;
+
+        case W5500_SOCK_CLOSED:
+            TCP_CLI_Init();     // Re-arm the listener
+            break;
+
+        default:
+            break;      // LISTEN and transient states
+    }
+}
+
+uint8_t TCP_CLI_IsConnected(void)
+{
+    return (cli_state == CLI_STATE_CONNECTED) ? 1 : 0;
+}
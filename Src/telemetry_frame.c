@@ -0,0 +1,154 @@
+/**
+ * @file    telemetry_frame.c
+ * @brief   Compact Binary Telemetry Frame Builder
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ */
+
+#include "telemetry_frame.h"
+#include "ch_control_core.h"
+#include "ch_staging.h"
+#include "ch_safety.h"
+#include "crc_util.h"
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * @brief Convert a float temperature to centidegrees with clamping
+ */
+static int16_t Telemetry_TempToCC(float temp)
+{
+    if (temp > 327.0f) return 32700;
+    if (temp < -327.0f) return -32700;
+    return (int16_t)(temp * 100.0f);
+}
+
+/* Field bit -> payload offset/size, in payload order (delta encoding) */
+typedef struct {
+    uint8_t offset;
+    uint8_t size;
+} TelemetryFieldDesc_t;
+
+static const TelemetryFieldDesc_t telem_fields[TELEM_FIELD_COUNT] = {
+    { offsetof(TelemetrySensorPayload_t, uptime_ms),          4 },
+    { offsetof(TelemetrySensorPayload_t, supply_temp_cc),     2 },
+    { offsetof(TelemetrySensorPayload_t, return_temp_cc),     2 },
+    { offsetof(TelemetrySensorPayload_t, ambient_temp_cc),    2 },
+    { offsetof(TelemetrySensorPayload_t, pressure),           2 },
+    { offsetof(TelemetrySensorPayload_t, flow_rate),          2 },
+    { offsetof(TelemetrySensorPayload_t, system_state),       1 },
+    { offsetof(TelemetrySensorPayload_t, capacity_mode),      1 },
+    { offsetof(TelemetrySensorPayload_t, active_compressors), 1 },
+    { offsetof(TelemetrySensorPayload_t, active_condensers),  1 },
+    { offsetof(TelemetrySensorPayload_t, capacity_pct_x10),   2 },
+    { offsetof(TelemetrySensorPayload_t, fault_bits),         4 },
+    { offsetof(TelemetrySensorPayload_t, alarm_count),        2 },
+};
+
+void Telemetry_FillSensorPayload(TelemetrySensorPayload_t *pl)
+{
+    memset(pl, 0, sizeof(TelemetrySensorPayload_t));
+    pl->uptime_ms = HAL_GetTick();
+
+    // Latest performance sample carries the sensor snapshot
+    if (g_chiller_core_initialized && g_chiller_core.performance_count > 0) {
+        uint16_t idx = (g_chiller_core.performance_index + CH_PERFORMANCE_HISTORY_SIZE - 1)
+                       % CH_PERFORMANCE_HISTORY_SIZE;
+        const ChillerPerformanceData_t *perf = &g_chiller_core.performance_history[idx];
+
+        pl->supply_temp_cc = Telemetry_TempToCC(perf->supply_temperature);
+        pl->return_temp_cc = Telemetry_TempToCC(perf->return_temperature);
+        pl->ambient_temp_cc = Telemetry_TempToCC(perf->ambient_temperature);
+        pl->pressure = perf->system_pressure;
+        pl->flow_rate = perf->flow_rate;
+        pl->active_compressors = perf->active_compressors;
+        pl->active_condensers = perf->active_condensers;
+    }
+
+    pl->system_state = (uint8_t)ChillerCore_GetSystemState();
+    pl->capacity_mode = (uint8_t)ChillerCore_GetCurrentMode();
+    pl->capacity_pct_x10 = (uint16_t)(Staging_GetCurrentCapacityPercent() * 10.0f);
+    pl->fault_bits = (uint32_t)ChillerCore_GetActiveFaults();
+    pl->alarm_count = Safety_GetActiveAlarmCount();
+}
+
+uint16_t Telemetry_BuildKeyFrame(uint8_t *buffer, uint16_t max_length,
+                                 const TelemetrySensorPayload_t *pl)
+{
+    if (buffer == NULL || pl == NULL ||
+        max_length < sizeof(TelemetryHeader_t) + sizeof(TelemetrySensorPayload_t)) {
+        return 0;
+    }
+
+    TelemetryHeader_t *hdr = (TelemetryHeader_t*)buffer;
+    memcpy(buffer + sizeof(TelemetryHeader_t), pl, sizeof(TelemetrySensorPayload_t));
+
+    hdr->magic = TELEM_MAGIC;
+    hdr->version = TELEM_VERSION;
+    hdr->type = TELEM_TYPE_SENSOR;
+    hdr->length = sizeof(TelemetrySensorPayload_t);
+    hdr->crc16 = CRC16_Modbus(buffer + sizeof(TelemetryHeader_t),
+                              sizeof(TelemetrySensorPayload_t));
+
+    return sizeof(TelemetryHeader_t) + sizeof(TelemetrySensorPayload_t);
+}
+
+uint16_t Telemetry_BuildSensorFrame(uint8_t *buffer, uint16_t max_length)
+{
+    TelemetrySensorPayload_t pl;
+
+    Telemetry_FillSensorPayload(&pl);
+    return Telemetry_BuildKeyFrame(buffer, max_length, &pl);
+}
+
+uint16_t Telemetry_BuildDeltaFrame(uint8_t *buffer, uint16_t max_length,
+                                   const TelemetrySensorPayload_t *current,
+                                   const TelemetrySensorPayload_t *previous,
+                                   uint16_t subscribe_mask)
+{
+    if (buffer == NULL || current == NULL || previous == NULL ||
+        max_length < TELEM_MAX_FRAME) {
+        return 0;
+    }
+
+    const uint8_t *cur = (const uint8_t*)current;
+    const uint8_t *prev = (const uint8_t*)previous;
+    uint8_t *payload = buffer + sizeof(TelemetryHeader_t);
+    uint8_t *out = payload + sizeof(uint16_t);   // Field data after the mask
+    uint16_t mask = 0;
+
+    for (uint8_t f = 0; f < TELEM_FIELD_COUNT; f++) {
+        if (!(subscribe_mask & (1 << f))) continue;
+
+        // uptime_ms is always-changed by definition; everything else is
+        // a byte compare against what the client last received
+        if (f != 0 && memcmp(cur + telem_fields[f].offset,
+                             prev + telem_fields[f].offset,
+                             telem_fields[f].size) == 0) {
+            continue;
+        }
+
+        memcpy(out, cur + telem_fields[f].offset, telem_fields[f].size);
+        out += telem_fields[f].size;
+        mask |= (1 << f);
+    }
+
+    // A frame carrying only the timestamp is no information - skip it
+    if ((mask & ~TELEM_FIELD_UPTIME) == 0) {
+        return 0;
+    }
+
+    memcpy(payload, &mask, sizeof(uint16_t));
+
+    TelemetryHeader_t *hdr = (TelemetryHeader_t*)buffer;
+    uint16_t payload_len = (uint16_t)(out - payload);
+
+    hdr->magic = TELEM_MAGIC;
+    hdr->version = TELEM_VERSION;
+    hdr->type = TELEM_TYPE_DELTA;
+    hdr->length = payload_len;
+    hdr->crc16 = CRC16_Modbus(payload, payload_len);
+
+    return sizeof(TelemetryHeader_t) + payload_len;
+}
@@ -0,0 +1,210 @@
+/**
+ * @file    timebase.c
+ * @brief   Software Timers and 64-bit Microsecond Clock Implementation
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ */
+
+#include "timebase.h"
+#include "event_queue.h"
+#include "mem_placement.h"
+#include "uart_comm.h"
+#include <stdio.h>
+#include <string.h>
+
+/* ========================================================================== */
+/* PRIVATE TYPES AND VARIABLES                                                */
+/* ========================================================================== */
+
+typedef struct {
+    const char *name;               // Short name for the status table
+    timebase_fn_t fn;               // Callback, NULL = post EVENT_TIMER
+    uint32_t period_ms;             // Delay (one-shot) or period (periodic)
+    uint32_t due_tick;              // Next fire tick (valid while armed)
+    uint32_t fire_count;
+    uint8_t mode;                   // TIMEBASE_ONESHOT / TIMEBASE_PERIODIC
+    uint8_t armed;
+} timebase_timer_t;
+
+static timebase_timer_t timers[TIMEBASE_MAX_TIMERS];
+static uint8_t timer_count = 0;
+
+/* Earliest armed deadline - the O(1) gate for the service pass. Signed
+ * tick differences keep the comparison correct across the 49-day
+ * HAL_GetTick rollover, the one place that story now lives. */
+static uint32_t earliest_due = 0;
+static uint8_t any_armed = 0;
+
+/* 64-bit microsecond clock: CYCCNT deltas accumulate into a 64-bit
+ * cycle count under a short PRIMASK guard. Correct as long as the
+ * accumulator is topped up at least once per counter wrap (~15s at
+ * 280MHz) - Timebase_Process does that every main-loop pass. */
+static uint64_t cycles_accum = 0;
+static uint32_t cycles_last = 0;
+static uint32_t cycles_per_us = 1;
+
+/* ========================================================================== */
+/* PRIVATE FUNCTIONS                                                          */
+/* ========================================================================== */
+
+/**
+ * @brief Recompute the earliest armed deadline after an arm/fire/stop
+ */
+static void Timebase_UpdateEarliest(void)
+{
+    any_armed = 0;
+    for (uint8_t i = 0; i < timer_count; i++) {
+        if (!timers[i].armed) continue;
+        if (!any_armed || (int32_t)(timers[i].due_tick - earliest_due) < 0) {
+            earliest_due = timers[i].due_tick;
+        }
+        any_armed = 1;
+    }
+}
+
+/**
+ * @brief Fold the CYCCNT delta since the last visit into the 64-bit count
+ */
+static void Timebase_AccumulateCycles(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    uint32_t now = DWT->CYCCNT;
+    cycles_accum += (uint32_t)(now - cycles_last);  // Wrap-safe delta
+    cycles_last = now;
+
+    if (!primask) __enable_irq();
+}
+
+/* ========================================================================== */
+/* PUBLIC FUNCTIONS                                                           */
+/* ========================================================================== */
+
+void Timebase_Init(void)
+{
+    memset(timers, 0, sizeof(timers));
+    timer_count = 0;
+    any_armed = 0;
+
+    cycles_per_us = HAL_RCC_GetSysClockFreq() / 1000000u;
+    if (cycles_per_us == 0) cycles_per_us = 1;
+    cycles_accum = 0;
+    cycles_last = DWT->CYCCNT;
+
+    Send_Debug_Data("Timebase: Ready\r\n");
+}
+
+uint8_t Timebase_Register(const char *name, timebase_fn_t fn,
+                          uint32_t period_ms, uint8_t mode)
+{
+    if (timer_count >= TIMEBASE_MAX_TIMERS || period_ms == 0) {
+        return TIMEBASE_INVALID_TIMER;
+    }
+
+    timebase_timer_t *timer = &timers[timer_count];
+    timer->name = name;
+    timer->fn = fn;
+    timer->period_ms = period_ms;
+    timer->due_tick = HAL_GetTick() + period_ms;
+    timer->fire_count = 0;
+    timer->mode = mode;
+    timer->armed = 1;
+
+    Timebase_UpdateEarliest();
+    return timer_count++;
+}
+
+void Timebase_Restart(uint8_t timer_id, uint32_t delay_ms)
+{
+    if (timer_id >= timer_count) return;
+
+    timers[timer_id].due_tick = HAL_GetTick() + delay_ms;
+    timers[timer_id].armed = 1;
+    Timebase_UpdateEarliest();
+}
+
+void Timebase_Stop(uint8_t timer_id)
+{
+    if (timer_id >= timer_count) return;
+
+    timers[timer_id].armed = 0;
+    Timebase_UpdateEarliest();
+}
+
+ITCM_FUNC void Timebase_Process(void)
+{
+    // Side effect first: the 64-bit clock only stays monotonic while
+    // someone folds CYCCNT in faster than it wraps
+    Timebase_AccumulateCycles();
+
+    if (!any_armed) return;
+
+    uint32_t now = HAL_GetTick();
+    if ((int32_t)(now - earliest_due) < 0) {
+        return;     // Nothing due - one compare and out
+    }
+
+    for (uint8_t i = 0; i < timer_count; i++) {
+        timebase_timer_t *timer = &timers[i];
+        if (!timer->armed || (int32_t)(now - timer->due_tick) < 0) {
+            continue;
+        }
+
+        timer->fire_count++;
+        if (timer->mode == TIMEBASE_PERIODIC) {
+            // Re-arm from the scheduled deadline, not from now, so a
+            // late pass does not accumulate drift
+            timer->due_tick += timer->period_ms;
+            if ((int32_t)(now - timer->due_tick) >= 0) {
+                timer->due_tick = now + timer->period_ms;   // Missed whole periods
+            }
+        } else {
+            timer->armed = 0;
+        }
+
+        if (timer->fn != NULL) {
+            timer->fn();
+        } else {
+            EventQueue_Post(EVENT_TIMER, i, (uint16_t)timer->fire_count);
+        }
+    }
+
+    Timebase_UpdateEarliest();
+}
+
+uint64_t Timebase_Micros64(void)
+{
+    Timebase_AccumulateCycles();
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint64_t cycles = cycles_accum;
+    if (!primask) __enable_irq();
+
+    return cycles / cycles_per_us;
+}
+
+void Timebase_PrintStatus(void)
+{
+    char msg[120];
+    uint64_t us = Timebase_Micros64();
+
+    Send_Debug_Data("\r\n=== Timebase ===\r\n");
+    snprintf(msg, sizeof(msg), "Clock: %lu.%06lu s, %lu cycles/us\r\n",
+             (uint32_t)(us / 1000000u), (uint32_t)(us % 1000000u), cycles_per_us);
+    Send_Debug_Data(msg);
+
+    Send_Debug_Data("Timer     Mode      Period    Fires     State\r\n");
+    for (uint8_t i = 0; i < timer_count; i++) {
+        timebase_timer_t *timer = &timers[i];
+        snprintf(msg, sizeof(msg), "%-9s %-9s %-9lu %-9lu %s\r\n",
+                 timer->name,
+                 (timer->mode == TIMEBASE_PERIODIC) ? "periodic" : "one-shot",
+                 timer->period_ms, timer->fire_count,
+                 timer->armed ? "armed" : "stopped");
+        Send_Debug_Data(msg);
+    }
+    Send_Debug_Data("================\r\n\r\n");
+}
@@ -2,6 +2,9 @@
 #include "main.h"
 #include "usart.h"
 #include "gpio.h"
+#include "modbus_sensor.h"
+#include "hmi.h"
+#include "dcache_util.h"
 #include <string.h>
 
 // External UART handles
@@ -9,6 +12,62 @@ extern UART_HandleTypeDef huart4;
 extern UART_HandleTypeDef huart8;
 extern UART_HandleTypeDef huart7;  // Add UART7
 
+/* === Asynchronous debug TX ring buffer (UART7) ===
+ * Send_Debug_Data() used to block in HAL_UART_Transmit() for up to 9 ms per
+ * message. Messages are now copied into this ring and clocked out by DMA;
+ * the caller returns immediately. Full ring drops the whole message (never
+ * a partial one) and counts the drop. */
+#define DEBUG_TX_RING_SIZE      4096
+static uint8_t debug_tx_ring[DEBUG_TX_RING_SIZE] DCACHE_ALIGNED;
+static volatile uint16_t debug_tx_head = 0;   // Write index (producer: main loop)
+static volatile uint16_t debug_tx_tail = 0;   // Read index (consumer: DMA)
+static volatile uint16_t debug_tx_dma_len = 0;
+static volatile uint8_t  debug_tx_busy = 0;
+static volatile uint32_t debug_tx_dropped = 0;
+static uint8_t debug_tx_async = 0;            // Set once DMA path is ready
+
+/**
+  * @brief  Start the next DMA transfer if data is pending
+  * @note   Must be called with interrupts masked or from the TX ISR
+  */
+static void Debug_TX_StartLocked(void) {
+    if (debug_tx_busy || debug_tx_head == debug_tx_tail) {
+        return;
+    }
+
+    // Transfer the contiguous chunk up to the ring wrap point
+    uint16_t chunk;
+    if (debug_tx_head > debug_tx_tail) {
+        chunk = debug_tx_head - debug_tx_tail;
+    } else {
+        chunk = DEBUG_TX_RING_SIZE - debug_tx_tail;
+    }
+
+    debug_tx_dma_len = chunk;
+    debug_tx_busy = 1;
+    DCache_CleanRange(&debug_tx_ring[debug_tx_tail], chunk);  // DMA reads memory, not cache
+    if (HAL_UART_Transmit_DMA(&huart7, &debug_tx_ring[debug_tx_tail], chunk) != HAL_OK) {
+        debug_tx_busy = 0;
+    }
+}
+
+/**
+  * @brief  DMA TX complete for UART7 - advance tail, chain the next chunk
+  * @note   Interrupt context (dispatched from HAL_UART_TxCpltCallback below)
+  */
+static void Debug_TxCpltCallback(void) {
+    debug_tx_tail = (debug_tx_tail + debug_tx_dma_len) % DEBUG_TX_RING_SIZE;
+    debug_tx_busy = 0;
+    Debug_TX_StartLocked();
+}
+
+/**
+  * @brief  Number of debug messages dropped because the TX ring was full
+  */
+uint32_t Debug_GetOverflowDrops(void) {
+    return debug_tx_dropped;
+}
+
 // Initialize UART peripherals
 void Init_UARTs(void) {
     // Enable UART clocks
@@ -48,27 +107,120 @@ void Init_UARTs(void) {
     huart7.Init.HwFlowCtl = UART_HWCONTROL_NONE;
     huart7.Init.OverSampling = UART_OVERSAMPLING_16;
     HAL_UART_Init(&huart7);
+
+    // Debug output goes through the DMA ring from here on
+    debug_tx_head = 0;
+    debug_tx_tail = 0;
+    debug_tx_busy = 0;
+    debug_tx_async = 1;
 }
 
 // Send data to HMI UART (UART4) - for future DWIN HMI
 void Send_HMI_Data(const char *message) {
+    // Same DE handling as Send_RS485_Data below - HAL_UART_Transmit()
+    // returns on TC, so no settling delays are needed around DE
     HAL_GPIO_WritePin(HMI_DE_RE_GPIO_Port, HMI_DE_RE_Pin, GPIO_PIN_SET); // DE HIGH
-    HAL_Delay(1);
     HAL_UART_Transmit(&huart4, (uint8_t*)message, strlen(message), 1000);
-    HAL_Delay(1);
     HAL_GPIO_WritePin(HMI_DE_RE_GPIO_Port, HMI_DE_RE_Pin, GPIO_PIN_RESET); // DE LOW
 }
 
 // Send data to Debug UART (UART7) - for debug output
+// Non-blocking: copies the message into the TX ring and returns. Falls back
+// to the blocking path only before Init_UARTs() has run.
+/* Optional mirror for debug output (e.g. the TCP CLI captures command
+ * results for a remote client); NULL when nobody is listening */
+static void (*debug_mirror)(const char *message) = NULL;
+
+void Debug_SetMirror(void (*mirror)(const char *message)) {
+    debug_mirror = mirror;
+}
+
 void Send_Debug_Data(const char *message) {
-    HAL_UART_Transmit(&huart7, (uint8_t*)message, strlen(message), 1000);
+    uint16_t len = (uint16_t)strlen(message);
+    if (len == 0) return;
+
+    if (debug_mirror) {
+        debug_mirror(message);
+    }
+
+    if (!debug_tx_async) {
+        HAL_UART_Transmit(&huart7, (uint8_t*)message, len, 1000);
+        return;
+    }
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    // Free space (one slot kept open to distinguish full from empty)
+    uint16_t used = (debug_tx_head - debug_tx_tail) % DEBUG_TX_RING_SIZE;
+    uint16_t free_space = DEBUG_TX_RING_SIZE - 1 - used;
+
+    if (len > free_space) {
+        // Drop the whole message - partial debug lines are worse than none
+        debug_tx_dropped++;
+        if (!primask) __enable_irq();
+        return;
+    }
+
+    // Copy in (may wrap)
+    uint16_t first = DEBUG_TX_RING_SIZE - debug_tx_head;
+    if (first > len) first = len;
+    memcpy(&debug_tx_ring[debug_tx_head], message, first);
+    if (len > first) {
+        memcpy(&debug_tx_ring[0], message + first, len - first);
+    }
+    debug_tx_head = (debug_tx_head + len) % DEBUG_TX_RING_SIZE;
+
+    Debug_TX_StartLocked();
+
+    if (!primask) __enable_irq();
 }
 
 // Send data to Modbus UART (UART8) - for RS485 Modbus
 void Send_RS485_Data(const char *message) {
+    /* The board routes DE/RE to PD5 (plain GPIO), so the UART8 hardware
+     * driver-enable (its RTS pin) is not available. The fixed HAL_Delay(1)
+     * guards are gone instead: the MAX485 enables its driver in
+     * nanoseconds, and HAL_UART_Transmit() only returns once the TC flag
+     * is set (last stop bit on the wire), so DE can drop immediately. */
     HAL_GPIO_WritePin(U485_DE_RE_GPIO_Port, U485_DE_RE_Pin, GPIO_PIN_SET); // DE HIGH
-    HAL_Delay(1);
     HAL_UART_Transmit(&huart8, (uint8_t*)message, strlen(message), 1000);
-    HAL_Delay(1);
     HAL_GPIO_WritePin(U485_DE_RE_GPIO_Port, U485_DE_RE_Pin, GPIO_PIN_RESET); // DE LOW
+}
+
+/* === Central HAL UART callback dispatchers ===
+ * HAL defines one weak callback per event for all UART instances, so all
+ * per-module interrupt handling is routed from here. */
+
+// TX complete - Modbus engine drops DE and arms its receiver from here
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart) {
+    if (huart->Instance == UART8) {
+        Modbus_TxCpltCallback();
+    }
+    else if (huart->Instance == UART7) {
+        Debug_TxCpltCallback();
+    }
+    else if (huart->Instance == UART4) {
+        HMI_TxCpltCallback();
+    }
+}
+
+// RX event (IDLE line / buffer full) - end of a received frame
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size) {
+    if (huart->Instance == UART8) {
+        Modbus_RxEventCallback(Size);
+    }
+    else if (huart->Instance == UART4) {
+        HMI_RxEventCallback(Size);
+    }
+}
+
+// UART error (framing, noise, overrun) - let the owning module recover
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart) {
+    if (huart->Instance == UART8) {
+        Modbus_ErrorCallback();
+    }
+    else if (huart->Instance == UART4) {
+        HMI_ErrorCallback();
+    }
 }
\ No newline at end of file
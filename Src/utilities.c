@@ -1,6 +1,6 @@
 #include "utilities.h"
 #include "main.h"
-#include <stdio.h>  // ADDED for snprintf
+#include "fmt_util.h"
 
 void Utilities_Delay(uint32_t ms) {
     HAL_Delay(ms);
@@ -10,11 +10,11 @@ uint32_t Utilities_GetTick(void) {
     return HAL_GetTick();
 }
 
+/* Thin wrappers over the append formatters - kept for existing callers */
 void Utilities_FormatIP(char *buffer, uint8_t *ip) {
-    snprintf(buffer, 16, "%d.%d.%d.%d", ip[0], ip[1], ip[2], ip[3]);
+    Fmt_IP(buffer, ip);
 }
 
 void Utilities_FormatMAC(char *buffer, uint8_t *mac) {
-    snprintf(buffer, 18, "%02X:%02X:%02X:%02X:%02X:%02X",
-             mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+    Fmt_MAC(buffer, mac);
 }
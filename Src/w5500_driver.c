@@ -23,6 +23,16 @@ uint8_t W5500_ReadByte(uint16_t addr) {
     return SPI_W5500_ReadRegByte(addr);
 }
 
+// Burst block write - one 3-byte address phase for the whole block
+void W5500_WriteBuffer(uint16_t addr, const uint8_t *data, uint16_t len) {
+    SPI_W5500_WriteBurst(addr, 0x00, data, len);
+}
+
+// Burst block read - one 3-byte address phase for the whole block
+void W5500_ReadBuffer(uint16_t addr, uint8_t *data, uint16_t len) {
+    SPI_W5500_ReadBurst(addr, 0x00, data, len);
+}
+
 // --- GPIO & Reset ---
 void W5500_Reset(void) {
     W5500_Debug_Message("W5500: Performing hardware reset...\r\n");
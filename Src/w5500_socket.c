@@ -10,17 +10,67 @@
 #include "w5500_driver.h"
 #include "spi_w5500.h"
 #include "uart_comm.h"
+#include "event_queue.h"
 #include <string.h>
 #include <stdio.h>
 
 /* Global socket state array */
 static w5500_socket_t socket_states[W5500_MAX_SOCKETS];
 
+/* Socket event layer: Sn_IR bits accumulated per socket by Events_Poll */
+static volatile uint8_t socket_event_flags[W5500_MAX_SOCKETS];
+static volatile uint8_t w5500_int_pending = 0;  // Set by the INTn EXTI hook
+static uint8_t w5500_int_wired = 0;             // INTn routed on this board rev
+
+/* Shadow cache: register snapshots served from RAM between events so
+ * repeated queries in one loop pass cost zero SPI traffic */
+#define SOCKET_CACHE_MAX_AGE_MS     100
+
+typedef struct {
+    uint8_t status;                 // Last Sn_SR value
+    uint16_t tx_free;               // Last Sn_TX_FSR value
+    uint16_t rx_pending;            // Last Sn_RX_RSR value
+    uint8_t status_valid;
+    uint8_t tx_valid;
+    uint8_t rx_valid;
+    uint32_t refresh_time;          // Tick of last register read
+} w5500_socket_cache_t;
+
+static w5500_socket_cache_t socket_cache[W5500_MAX_SOCKETS];
+
+/* Cache hit/miss counters for the diagnostic report */
+static uint32_t socket_cache_hits = 0;
+static uint32_t socket_cache_misses = 0;
+
+/* Per-socket traffic counters - updated inline on every send/receive and
+ * from the event layer, so the numbers are always current */
+static w5500_socket_stats_t socket_stats[W5500_MAX_SOCKETS];
+
+/* Async (DMA) send state: one transfer in flight at a time, matching the
+ * single-transfer SPI DMA layer underneath. The SEND commit is deferred
+ * to W5500_Socket_AsyncPump so no chip access happens in the completion
+ * interrupt. Payloads below the threshold go polled - the DMA setup
+ * costs more than it saves on short frames. */
+#define SOCKET_ASYNC_MIN_DMA_LEN    64
+
+#define SOCKET_ASYNC_IDLE           0
+#define SOCKET_ASYNC_IN_FLIGHT      1
+#define SOCKET_ASYNC_COMPLETE       2
+
+static volatile uint8_t async_state = SOCKET_ASYNC_IDLE;
+static uint8_t async_socket = 0;
+static const uint8_t *async_data = NULL;    // For the error-path polled retry
+static uint16_t async_len = 0;
+static uint16_t async_tx_wr = 0;            // Write pointer at transfer start
+static uint32_t async_sends = 0;            // DMA sends started
+static uint32_t async_fallbacks = 0;        // Polled because DMA unavailable
+
 /* Private function prototypes */
 static uint16_t W5500_Socket_GetRegAddress(uint8_t socket, uint16_t offset);
 static uint8_t W5500_Socket_WriteReg(uint8_t socket, uint16_t offset, uint8_t data);
 static uint8_t W5500_Socket_ReadReg(uint8_t socket, uint16_t offset);
 static void W5500_Socket_InitState(uint8_t socket);
+static void W5500_Socket_DmaDone(void);
 
 /**
  * @brief Initialize all socket buffers according to datasheet
@@ -40,6 +90,10 @@ uint8_t W5500_Socket_InitBuffers(void) {
         socket_states[i].rx_buffer_size = 2;  // 2KB (default)
     }
 
+    /* Async sends ride the SPI DMA layer; completion lands in
+     * W5500_Socket_DmaDone and is committed from AsyncPump */
+    SPI_W5500_SetDmaCallback(W5500_Socket_DmaDone);
+
     W5500_Debug_Message("W5500_Socket: Using default buffer allocation\r\n");
     return 1;
 }
@@ -47,15 +101,61 @@ uint8_t W5500_Socket_InitBuffers(void) {
 /**
  * @brief Configure buffer sizes for specific socket
  */
+/**
+ * @brief Write one socket's buffer sizes to the chip (KB granularity)
+ * W5500 sizes live in per-socket Sn_TXBUF_SIZE/Sn_RXBUF_SIZE - the
+ * global TMSR/RMSR addresses are W5100 legacy and do not apply here.
+ */
+static uint8_t W5500_Socket_ApplyBufferKB(uint8_t socket, uint8_t tx_kb, uint8_t rx_kb) {
+    W5500_Socket_WriteReg(socket, W5500_Sn_TXBUF_SIZE, tx_kb);
+    W5500_Socket_WriteReg(socket, W5500_Sn_RXBUF_SIZE, rx_kb);
+
+    socket_states[socket].tx_buffer_size = tx_kb;
+    socket_states[socket].rx_buffer_size = rx_kb;
+    W5500_Socket_CacheInvalidate(socket);
+    return 1;
+}
+
 uint8_t W5500_Socket_SetBufferSize(uint8_t socket, socket_buffer_size_t tx_size, socket_buffer_size_t rx_size) {
     if (socket >= W5500_MAX_SOCKETS) return 0;
 
-    /* Note: Individual socket buffer sizing requires recalculating total memory allocation
-     * For now, using standard 2KB per socket. Advanced buffer management can be added later.
-     */
-    socket_states[socket].tx_buffer_size = (1 << tx_size);  // Convert enum to KB
-    socket_states[socket].rx_buffer_size = (1 << rx_size);
+    return W5500_Socket_ApplyBufferKB(socket, (1 << tx_size), (1 << rx_size));
+}
+
+/**
+ * @brief Partition the 16KB TX / 16KB RX memory by socket role
+ */
+uint8_t W5500_Socket_SetBufferPlan(const socket_role_t roles[W5500_MAX_SOCKETS]) {
+    /* TX/RX KB per role: idle, server, stream, data */
+    static const uint8_t role_tx_kb[] = {1, 4, 8, 2};
+    static const uint8_t role_rx_kb[] = {1, 2, 2, 2};
+
+    if (roles == NULL) return 0;
 
+    /* Validate the plan against the 16KB budget per direction */
+    uint8_t tx_total = 0;
+    uint8_t rx_total = 0;
+    for (uint8_t i = 0; i < W5500_MAX_SOCKETS; i++) {
+        if (roles[i] > SOCKET_ROLE_DATA) return 0;
+        tx_total += role_tx_kb[roles[i]];
+        rx_total += role_rx_kb[roles[i]];
+    }
+    if (tx_total > 16 || rx_total > 16) {
+        char msg[80];
+        snprintf(msg, sizeof(msg), "Buffer plan rejected: %dKB TX / %dKB RX over budget\r\n",
+                 tx_total, rx_total);
+        W5500_Debug_Message(msg);
+        return 0;
+    }
+
+    for (uint8_t i = 0; i < W5500_MAX_SOCKETS; i++) {
+        W5500_Socket_ApplyBufferKB(i, role_tx_kb[roles[i]], role_rx_kb[roles[i]]);
+    }
+
+    char msg[80];
+    snprintf(msg, sizeof(msg), "Buffer plan applied: %dKB TX / %dKB RX in use\r\n",
+             tx_total, rx_total);
+    W5500_Debug_Message(msg);
     return 1;
 }
 
@@ -116,13 +216,38 @@ uint8_t W5500_Socket_Init(uint8_t socket, uint8_t mode, uint16_t port) {
 uint8_t W5500_Socket_GetStatus(uint8_t socket) {
     if (socket >= W5500_MAX_SOCKETS) return 0;
 
+    /* Serve from the shadow cache while it is fresh and no event has
+     * invalidated it - repeat queries in a loop pass cost no SPI */
+    w5500_socket_cache_t *cache = &socket_cache[socket];
+    if (cache->status_valid &&
+        (HAL_GetTick() - cache->refresh_time) < SOCKET_CACHE_MAX_AGE_MS) {
+        socket_cache_hits++;
+        return cache->status;
+    }
+    socket_cache_misses++;
+
     uint8_t status = W5500_Socket_ReadReg(socket, W5500_Sn_SR);
+    cache->status = status;
+    cache->status_valid = 1;
+    cache->refresh_time = HAL_GetTick();
+
     socket_states[socket].status = status;
     socket_states[socket].last_activity = HAL_GetTick();
 
     return status;
 }
 
+/**
+ * @brief Drop the cached register snapshot for a socket
+ * Called on socket events and after commands that change chip state.
+ */
+void W5500_Socket_CacheInvalidate(uint8_t socket) {
+    if (socket >= W5500_MAX_SOCKETS) return;
+    socket_cache[socket].status_valid = 0;
+    socket_cache[socket].tx_valid = 0;
+    socket_cache[socket].rx_valid = 0;
+}
+
 /**
  * @brief Close specific socket
  */
@@ -148,6 +273,57 @@ uint8_t W5500_Socket_Close(uint8_t socket) {
 /**
  * @brief Close all sockets (used during system reset)
  */
+/**
+ * @brief Graceful TCP close - sends FIN and lets the stack finish
+ * Non-blocking: the socket walks through the closing states on its own.
+ */
+uint8_t W5500_Socket_Disconnect(uint8_t socket) {
+    if (socket >= W5500_MAX_SOCKETS) return 0;
+
+    W5500_Socket_WriteReg(socket, W5500_Sn_CR, W5500_CMD_DISCON);
+    return 1;
+}
+
+/**
+ * @brief Set TCP mode/port and issue OPEN - no completion wait
+ */
+uint8_t W5500_Socket_OpenTCP(uint8_t socket, uint16_t port) {
+    if (socket >= W5500_MAX_SOCKETS) return 0;
+
+    W5500_Socket_WriteReg(socket, W5500_Sn_MR, W5500_MODE_TCP);
+    W5500_Socket_WriteReg(socket, W5500_Sn_PORT0, (port >> 8) & 0xFF);
+    W5500_Socket_WriteReg(socket, W5500_Sn_PORT1, port & 0xFF);
+    W5500_Socket_WriteReg(socket, W5500_Sn_CR, W5500_CMD_OPEN);
+    return 1;
+}
+
+/**
+ * @brief Issue the LISTEN command - no completion wait
+ */
+uint8_t W5500_Socket_Listen(uint8_t socket) {
+    if (socket >= W5500_MAX_SOCKETS) return 0;
+
+    W5500_Socket_WriteReg(socket, W5500_Sn_CR, W5500_CMD_LISTEN);
+    return 1;
+}
+
+/**
+ * @brief Read the connected peer's address registers
+ */
+void W5500_Socket_GetRemote(uint8_t socket, uint8_t *ip, uint16_t *port) {
+    if (socket >= W5500_MAX_SOCKETS) return;
+
+    if (ip != NULL) {
+        for (uint8_t i = 0; i < 4; i++) {
+            ip[i] = W5500_Socket_ReadReg(socket, W5500_Sn_DIPR0 + i);
+        }
+    }
+    if (port != NULL) {
+        *port = ((uint16_t)W5500_Socket_ReadReg(socket, W5500_Sn_DPORT0) << 8) |
+                W5500_Socket_ReadReg(socket, W5500_Sn_DPORT0 + 1);
+    }
+}
+
 uint8_t W5500_Socket_CloseAll(void) {
     W5500_Debug_Message("Closing all sockets...\r\n");
 
@@ -223,6 +399,10 @@ void W5500_Socket_Debug(uint8_t socket) {
         for (uint8_t i = 0; i < W5500_MAX_SOCKETS; i++) {
             W5500_Socket_Debug(i);
         }
+        char cache_msg[80];
+        snprintf(cache_msg, sizeof(cache_msg), "Register cache: %lu hits, %lu misses\r\n",
+                 socket_cache_hits, socket_cache_misses);
+        W5500_Debug_Message(cache_msg);
         return;
     }
 
@@ -550,6 +730,384 @@ void W5500_TCP_Server_Process(void) {
     }
 }
 
+/**
+ * @brief Read a 16-bit socket register pair with stable-read verification
+ * The W5500 updates FSR/RSR asynchronously; read until two passes agree.
+ */
+static uint16_t W5500_Socket_ReadReg16_Stable(uint8_t socket, uint16_t offset) {
+    uint16_t val = 0, prev;
+    do {
+        prev = val;
+        val = ((uint16_t)W5500_Socket_ReadReg(socket, offset) << 8) |
+               W5500_Socket_ReadReg(socket, offset + 1);
+    } while (val != prev);
+    return val;
+}
+
+/**
+ * @brief Get free space in socket TX buffer
+ */
+uint16_t W5500_Socket_GetTxFreeSize(uint8_t socket) {
+    if (socket >= W5500_MAX_SOCKETS) return 0;
+
+    w5500_socket_cache_t *cache = &socket_cache[socket];
+    if (cache->tx_valid &&
+        (HAL_GetTick() - cache->refresh_time) < SOCKET_CACHE_MAX_AGE_MS) {
+        socket_cache_hits++;
+        return cache->tx_free;
+    }
+    socket_cache_misses++;
+
+    cache->tx_free = W5500_Socket_ReadReg16_Stable(socket, W5500_Sn_TX_FSR0);
+    cache->tx_valid = 1;
+    cache->refresh_time = HAL_GetTick();
+    return cache->tx_free;
+}
+
+/**
+ * @brief Get pending byte count in socket RX buffer
+ */
+uint16_t W5500_Socket_GetRxReceivedSize(uint8_t socket) {
+    if (socket >= W5500_MAX_SOCKETS) return 0;
+
+    w5500_socket_cache_t *cache = &socket_cache[socket];
+    if (cache->rx_valid &&
+        (HAL_GetTick() - cache->refresh_time) < SOCKET_CACHE_MAX_AGE_MS) {
+        socket_cache_hits++;
+        return cache->rx_pending;
+    }
+    socket_cache_misses++;
+
+    cache->rx_pending = W5500_Socket_ReadReg16_Stable(socket, W5500_Sn_RX_RSR0);
+    cache->rx_valid = 1;
+    cache->refresh_time = HAL_GetTick();
+    return cache->rx_pending;
+}
+
+/**
+ * @brief Send data through socket TX buffer using burst SPI
+ * One address phase for the whole payload instead of 3 bytes + 2 delays
+ * per data byte - a 512-byte send drops from >1s to ~1ms of bus time.
+ */
+uint16_t W5500_Socket_SendData(uint8_t socket, const uint8_t *data, uint16_t len) {
+    if (socket >= W5500_MAX_SOCKETS || data == NULL || len == 0) return 0;
+
+    /* Clamp to available TX window */
+    uint16_t free_size = W5500_Socket_GetTxFreeSize(socket);
+    if (free_size == 0) {
+        socket_stats[socket].tx_window_full++;
+        return 0;
+    }
+    if (len > free_size) len = free_size;
+
+    /* Burst-write the payload at the current write pointer.
+     * The chip masks the address to the buffer size internally, so the
+     * raw pointer can be used directly and wrap is handled in hardware. */
+    uint16_t tx_wr = W5500_Socket_ReadReg16_Stable(socket, W5500_Sn_TX_WR0);
+    SPI_W5500_WriteBurst(tx_wr, W5500_BSB_SOCKET_TX(socket), data, len);
+
+    /* Advance the write pointer and commit with a single SEND */
+    tx_wr += len;
+    W5500_Socket_WriteReg(socket, W5500_Sn_TX_WR0, (tx_wr >> 8) & 0xFF);
+    W5500_Socket_WriteReg(socket, W5500_Sn_TX_WR0 + 1, tx_wr & 0xFF);
+    W5500_Socket_WriteReg(socket, W5500_Sn_CR, W5500_CMD_SEND);
+
+    socket_stats[socket].tx_bytes += len;
+    socket_stats[socket].tx_sends++;
+    socket_states[socket].last_activity = HAL_GetTick();
+    return len;
+}
+
+/**
+ * @brief SPI DMA completion (interrupt context) - flag the transfer and
+ *        wake the socket consumers; the SEND commit runs from AsyncPump
+ */
+static void W5500_Socket_DmaDone(void) {
+    async_state = SOCKET_ASYNC_COMPLETE;
+    EventQueue_Post(EVENT_SOCKET_EVENT, async_socket, async_len);
+}
+
+/**
+ * @brief Start a socket send with the payload phase on DMA
+ * The burst write into the TX window runs in the background and the
+ * caller returns to the loop; W5500_Socket_AsyncPump commits the SEND
+ * once the transfer completes. Falls back to the polled path (committed
+ * before return) for short payloads or when DMA is unavailable, so the
+ * return value always means "these bytes will reach the wire".
+ */
+uint16_t W5500_Socket_SendDataAsync(uint8_t socket, const uint8_t *data, uint16_t len) {
+    if (socket >= W5500_MAX_SOCKETS || data == NULL || len == 0) return 0;
+
+    if (async_state != SOCKET_ASYNC_IDLE) {
+        return 0;   // One transfer in flight - caller retries next pass
+    }
+    if (len < SOCKET_ASYNC_MIN_DMA_LEN) {
+        return W5500_Socket_SendData(socket, data, len);
+    }
+
+    uint16_t free_size = W5500_Socket_GetTxFreeSize(socket);
+    if (free_size == 0) {
+        socket_stats[socket].tx_window_full++;
+        return 0;
+    }
+    if (len > free_size) len = free_size;
+
+    uint16_t tx_wr = W5500_Socket_ReadReg16_Stable(socket, W5500_Sn_TX_WR0);
+
+    async_socket = socket;
+    async_data = data;
+    async_len = len;
+    async_tx_wr = tx_wr;
+    async_state = SOCKET_ASYNC_IN_FLIGHT;
+
+    if (SPI_W5500_WriteBurst_DMA(tx_wr, W5500_BSB_SOCKET_TX(socket),
+                                 data, len) != HAL_OK) {
+        /* DMA engine busy or errored on setup - polled path instead */
+        async_state = SOCKET_ASYNC_IDLE;
+        async_fallbacks++;
+        return W5500_Socket_SendData(socket, data, len);
+    }
+
+    async_sends++;
+    return len;
+}
+
+/**
+ * @brief Whether an async send still owns its caller buffer
+ */
+uint8_t W5500_Socket_AsyncInFlight(void) {
+    return (async_state != SOCKET_ASYNC_IDLE) ? 1 : 0;
+}
+
+/**
+ * @brief Commit a completed async send (TX pointer advance + SEND)
+ * @return Bytes committed, 0 if idle or the payload is still moving
+ */
+uint16_t W5500_Socket_AsyncPump(void) {
+    if (async_state == SOCKET_ASYNC_IDLE) return 0;
+
+    if (async_state == SOCKET_ASYNC_IN_FLIGHT) {
+        if (SPI_W5500_IsDmaBusy()) {
+            return 0;   // Payload still moving
+        }
+        /* Transfer ended without a completion callback - the SPI layer
+         * hit an error mid-burst. The TX pointer was never advanced, so
+         * nothing partial went out; redo the burst polled to keep the
+         * caller's accounting (bytes already reported sent) honest. */
+        SPI_W5500_WriteBurst(async_tx_wr, W5500_BSB_SOCKET_TX(async_socket),
+                             async_data, async_len);
+        async_fallbacks++;
+    }
+
+    uint16_t tx_wr = async_tx_wr + async_len;
+    W5500_Socket_WriteReg(async_socket, W5500_Sn_TX_WR0, (tx_wr >> 8) & 0xFF);
+    W5500_Socket_WriteReg(async_socket, W5500_Sn_TX_WR0 + 1, tx_wr & 0xFF);
+    W5500_Socket_WriteReg(async_socket, W5500_Sn_CR, W5500_CMD_SEND);
+
+    socket_stats[async_socket].tx_bytes += async_len;
+    socket_stats[async_socket].tx_sends++;
+    socket_states[async_socket].last_activity = HAL_GetTick();
+
+    uint16_t committed = async_len;
+    async_data = NULL;
+    async_state = SOCKET_ASYNC_IDLE;
+    return committed;
+}
+
+/**
+ * @brief Unmask all socket interrupts so SIR accumulates events
+ */
+void W5500_Events_Enable(void) {
+    W5500_WriteByte(W5500_SIMR, 0xFF);
+    for (uint8_t i = 0; i < W5500_MAX_SOCKETS; i++) {
+        socket_event_flags[i] = 0;
+    }
+}
+
+/**
+ * @brief EXTI hook for the W5500 INTn pin. The current board layout
+ * does not route INTn, so the hook is never called and Events_Poll
+ * falls back to one SIR read per pass; a board spin that wires the pin
+ * only needs to call this from its EXTI callback.
+ */
+void W5500_Events_IRQHook(void) {
+    w5500_int_wired = 1;
+    w5500_int_pending = 1;
+    EventQueue_Post(EVENT_SOCKET_EVENT, 0, 0);  // Wake the socket consumers
+}
+
+/**
+ * @brief Collect pending socket events from SIR/Sn_IR
+ * Idle cost is a single SIR byte read (zero with INTn wired) instead of
+ * a status register read per socket per pass.
+ */
+uint8_t W5500_Events_Poll(void) {
+    if (w5500_int_wired && !w5500_int_pending) {
+        return 0;
+    }
+    w5500_int_pending = 0;
+
+    uint8_t sir = W5500_ReadByte(W5500_SIR);
+    if (sir == 0 || sir == 0xFF) {
+        return 0;   // Nothing pending (0xFF = chip not responding)
+    }
+
+    for (uint8_t socket = 0; socket < W5500_MAX_SOCKETS; socket++) {
+        if (!(sir & (1 << socket))) continue;
+
+        uint8_t events = W5500_Socket_ReadReg(socket, W5500_Sn_IR);
+        if (events) {
+            W5500_Socket_WriteReg(socket, W5500_Sn_IR, events);  // Write-1-to-clear
+            socket_event_flags[socket] |= events;
+            W5500_Socket_CacheInvalidate(socket);   // Chip state moved
+
+            /* Connection lifecycle counters ride the event bits for free */
+            if (events & W5500_Sn_IR_CON)     socket_stats[socket].connects++;
+            if (events & W5500_Sn_IR_DISCON)  socket_stats[socket].disconnects++;
+            if (events & W5500_Sn_IR_TIMEOUT) socket_stats[socket].timeouts++;
+        }
+    }
+    return sir;
+}
+
+/**
+ * @brief Fetch and clear accumulated event bits for a socket
+ */
+uint8_t W5500_Events_Get(uint8_t socket) {
+    if (socket >= W5500_MAX_SOCKETS) return 0;
+
+    uint8_t events = socket_event_flags[socket];
+    socket_event_flags[socket] = 0;
+    return events;
+}
+
+/**
+ * @brief Scatter-gather send: fragments go straight from caller memory
+ * into the TX window, one burst each, with a single SEND commit.
+ * All-or-nothing: a frame is never split across the window boundary.
+ */
+uint16_t W5500_Socket_SendVectored(uint8_t socket, const w5500_tx_fragment_t *fragments,
+                                   uint8_t count) {
+    if (socket >= W5500_MAX_SOCKETS || fragments == NULL || count == 0) return 0;
+
+    /* Total frame must fit - partial telemetry frames are useless */
+    uint16_t total = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        if (fragments[i].data == NULL && fragments[i].length > 0) return 0;
+        total += fragments[i].length;
+    }
+    if (total == 0) return 0;
+    if (W5500_Socket_GetTxFreeSize(socket) < total) {
+        socket_stats[socket].tx_window_full++;
+        return 0;
+    }
+
+    /* Burst each fragment at the advancing write pointer; the chip masks
+     * the address to the buffer size, so wrap is handled in hardware */
+    uint16_t tx_wr = W5500_Socket_ReadReg16_Stable(socket, W5500_Sn_TX_WR0);
+    for (uint8_t i = 0; i < count; i++) {
+        if (fragments[i].length == 0) continue;
+        SPI_W5500_WriteBurst(tx_wr, W5500_BSB_SOCKET_TX(socket),
+                             fragments[i].data, fragments[i].length);
+        tx_wr += fragments[i].length;
+    }
+
+    /* One pointer update, one SEND for the whole frame */
+    W5500_Socket_WriteReg(socket, W5500_Sn_TX_WR0, (tx_wr >> 8) & 0xFF);
+    W5500_Socket_WriteReg(socket, W5500_Sn_TX_WR0 + 1, tx_wr & 0xFF);
+    W5500_Socket_WriteReg(socket, W5500_Sn_CR, W5500_CMD_SEND);
+
+    socket_stats[socket].tx_bytes += total;
+    socket_stats[socket].tx_sends++;
+    socket_states[socket].last_activity = HAL_GetTick();
+    return total;
+}
+
+/**
+ * @brief Read received data from socket RX buffer using burst SPI
+ */
+uint16_t W5500_Socket_ReceiveData(uint8_t socket, uint8_t *buffer, uint16_t max_len) {
+    if (socket >= W5500_MAX_SOCKETS || buffer == NULL || max_len == 0) return 0;
+
+    uint16_t pending = W5500_Socket_GetRxReceivedSize(socket);
+    if (pending == 0) return 0;
+
+    /* A completely full RX window means the chip is (or is about to start)
+     * dropping peer data - count it so backpressure shows up in the stats */
+    if (pending >= (uint16_t)(socket_states[socket].rx_buffer_size * 1024)) {
+        socket_stats[socket].rx_buffer_full++;
+    }
+    if (pending > max_len) pending = max_len;
+
+    /* Burst-read from the current read pointer (hardware handles wrap) */
+    uint16_t rx_rd = W5500_Socket_ReadReg16_Stable(socket, W5500_Sn_RX_RD0);
+    SPI_W5500_ReadBurst(rx_rd, W5500_BSB_SOCKET_RX(socket), buffer, pending);
+
+    /* Advance the read pointer and acknowledge with RECV */
+    rx_rd += pending;
+    W5500_Socket_WriteReg(socket, W5500_Sn_RX_RD0, (rx_rd >> 8) & 0xFF);
+    W5500_Socket_WriteReg(socket, W5500_Sn_RX_RD0 + 1, rx_rd & 0xFF);
+    W5500_Socket_WriteReg(socket, W5500_Sn_CR, W5500_CMD_RECV);
+
+    socket_stats[socket].rx_bytes += pending;
+    socket_states[socket].last_activity = HAL_GetTick();
+    return pending;
+}
+
+/**
+ * @brief Copy the accumulated traffic counters for a socket
+ */
+uint8_t W5500_Socket_GetStats(uint8_t socket, w5500_socket_stats_t *stats) {
+    if (socket >= W5500_MAX_SOCKETS || stats == NULL) return 0;
+
+    memcpy(stats, &socket_stats[socket], sizeof(w5500_socket_stats_t));
+    return 1;
+}
+
+/**
+ * @brief Zero all per-socket traffic counters
+ */
+void W5500_Socket_ResetStats(void) {
+    memset(socket_stats, 0, sizeof(socket_stats));
+    W5500_Debug_Message("Socket traffic counters reset\r\n");
+}
+
+/**
+ * @brief Print per-socket throughput/error counters
+ * Sockets with no traffic at all are skipped to keep the report short.
+ */
+void W5500_Socket_PrintStats(void) {
+    char msg[120];
+
+    Send_Debug_Data("=== SOCKET TRAFFIC COUNTERS ===\r\n");
+    for (uint8_t i = 0; i < W5500_MAX_SOCKETS; i++) {
+        w5500_socket_stats_t *s = &socket_stats[i];
+        if (s->tx_bytes == 0 && s->rx_bytes == 0 && s->connects == 0 &&
+            s->tx_window_full == 0 && s->timeouts == 0) {
+            continue;
+        }
+
+        snprintf(msg, sizeof(msg), "Socket %d: TX=%lub/%lu sends, RX=%lub\r\n",
+                 i, s->tx_bytes, s->tx_sends, s->rx_bytes);
+        Send_Debug_Data(msg);
+        snprintf(msg, sizeof(msg),
+                 "  TXfull=%lu RXfull=%lu Conn=%lu Disc=%lu Timeout=%lu\r\n",
+                 s->tx_window_full, s->rx_buffer_full,
+                 s->connects, s->disconnects, s->timeouts);
+        Send_Debug_Data(msg);
+    }
+
+    snprintf(msg, sizeof(msg), "SPI transactions: %lu\r\n",
+             SPI_W5500_GetTransactionCount());
+    Send_Debug_Data(msg);
+    snprintf(msg, sizeof(msg), "Register cache: %lu hits, %lu misses\r\n",
+             socket_cache_hits, socket_cache_misses);
+    Send_Debug_Data(msg);
+    snprintf(msg, sizeof(msg), "Async sends: %lu DMA, %lu polled fallback\r\n",
+             async_sends, async_fallbacks);
+    Send_Debug_Data(msg);
+}
+
 /* Private Functions */
 
 /**
@@ -581,6 +1139,11 @@ static uint8_t W5500_Socket_WriteReg(uint8_t socket, uint16_t offset, uint8_t da
     // Use your working SPI_W5500_WriteRegByte function
     SPI_W5500_WriteRegByte(reg_addr, data);
 
+    // Socket commands change chip state - drop the shadow cache
+    if (offset == W5500_Sn_CR) {
+        W5500_Socket_CacheInvalidate(socket);
+    }
+
     return 1;
 }
 
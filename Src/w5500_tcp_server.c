@@ -10,8 +10,34 @@
 #include "w5500_driver.h"
 #include "w5500_socket.h"
 #include "spi_w5500.h"
+#include "profiler.h"
+#include "telemetry_frame.h"
+#include "sd_ring_log.h"
+#include "sd_card.h"
+#include "fmt_util.h"
 #include <string.h>
 #include <stdio.h>
+#include <stdlib.h>
+
+/* === Per-socket service plan ===
+ * Every W5500 socket has a descriptor. HTTP and the debug CLI keep
+ * their dedicated sockets; the rest form the data-service pool, each
+ * one an independent listener on server_port with its own non-blocking
+ * state machine. The W5500 "accept" model: an established listener IS
+ * the connection, and respawning the listen just means every pool
+ * socket that is not connected sits in LISTEN - so as long as one slot
+ * is free, the port keeps accepting. */
+static const tcp_service_t socket_services[W5500_MAX_SOCKETS] = {
+    TCP_SVC_HTTP,                       // 0: HTTP status server (http_server.c)
+    TCP_SVC_DATA,                       // 1: data pool
+    TCP_SVC_CLI,                        // 2: debug CLI (tcp_cli.c)
+    TCP_SVC_DATA, TCP_SVC_DATA,         // 3-7: data pool
+    TCP_SVC_DATA, TCP_SVC_DATA, TCP_SVC_DATA,
+};
+static const char* const service_names[] = { "none", "http", "cli", "data" };
+
+/* Client slot n <-> its fixed data-pool socket */
+static const uint8_t tcp_client_sockets[TCP_MAX_CLIENTS] = {1, 3, 4, 5, 6, 7};
 
 /* Global variables */
 static tcp_client_t tcp_clients[TCP_MAX_CLIENTS];
@@ -23,6 +49,49 @@ static uint8_t data_streaming_enabled = 0;
 static uint32_t streaming_interval = 5000; // Default 5 seconds
 static uint32_t last_stream_time = 0;
 
+/* === Log export: streaming ring-log download over TCP ===
+ * A client sends "LOGGET [<start_record> <count>]" and receives a text
+ * header, the requested range as raw 64-byte SDLog records (whole
+ * sectors), and a "LOGGET DONE" footer. The transfer is pumped from
+ * TCP_Server_Process(): each pass does at most a few multi-block SD
+ * reads into a staging buffer and drains it into the W5500 TX window,
+ * gated on Sn_TX_FSR free size - a month of history streams out in the
+ * background without ever stalling the server loop or live telemetry. */
+
+#define LOG_EXPORT_SECTORS_PER_READ 4   // Staging size: one CMD18 burst (2 KB)
+#define LOG_EXPORT_READS_PER_PASS   4   // SD read budget per Process pass
+#define LOG_EXPORT_MIN_TX_FREE      SD_CARD_BLOCK_SIZE  // Send gate (Sn_TX_FSR)
+
+static uint8_t log_export_active = 0;
+static uint8_t log_export_client = 0;
+static uint32_t log_export_sector = 0;      // Next sector offset from tail
+static uint32_t log_export_end_sector = 0;  // One past the last sector to send
+static uint8_t log_export_staging[LOG_EXPORT_SECTORS_PER_READ * SD_CARD_BLOCK_SIZE];
+static uint16_t log_export_staged = 0;      // Bytes in the staging buffer
+static uint16_t log_export_drained = 0;     // Bytes of staging already sent
+static uint32_t log_export_bytes_total = 0;
+static uint32_t log_export_start_tick = 0;
+
+/* === Delta telemetry subscriptions ===
+ * A client sends "SUB <interval_ms> [<mask_hex>]" and gets a keyframe
+ * followed by TELEM_TYPE_DELTA frames at its own rate, carrying only
+ * the subscribed fields that changed since its last frame (byte compare
+ * against last_sent). A fresh keyframe every TELEM_KEYFRAME_EVERY
+ * frames resyncs clients that joined mid-stream or dropped a packet. */
+
+#define TELEM_KEYFRAME_EVERY        32  // Delta frames between keyframe resyncs
+
+typedef struct {
+    uint8_t active;                     // Subscription live
+    uint16_t field_mask;                // TELEM_FIELD_* bits the client wants
+    uint32_t interval_ms;               // Client-selected send rate
+    uint32_t next_send;                 // HAL tick of the next due frame
+    uint8_t frames_until_key;           // 0 = next frame is a keyframe
+    TelemetrySensorPayload_t last_sent; // Delta reference (what the client has)
+} telem_sub_t;
+
+static telem_sub_t telem_subs[TCP_MAX_CLIENTS];
+
 /* Callback function pointers */
 static tcp_client_connect_callback_t client_connect_cb = NULL;
 static tcp_client_disconnect_callback_t client_disconnect_cb = NULL;
@@ -30,12 +99,18 @@ static tcp_data_received_callback_t data_received_cb = NULL;
 
 /* Private function prototypes */
 static void TCP_Server_InitClient(uint8_t client_id);
-static uint8_t TCP_Server_FindFreeClient(void);
-static void TCP_Server_HandleNewConnection(void);
+static void TCP_Server_ServiceSocket(uint8_t client_id, uint8_t events, uint8_t full_sweep);
+static void TCP_Server_AcceptClient(uint8_t client_id);
+static void TCP_Server_ReleaseClient(uint8_t client_id);
 static void TCP_Server_HandleClientData(uint8_t client_id);
 static void TCP_Server_HandleClientDisconnect(uint8_t client_id);
 static void TCP_Server_CheckTimeouts(void);
 static void TCP_Server_UpdateStats(void);
+static void TCP_Server_LogExport_HandleRequest(uint8_t client_id, const char *args);
+static void TCP_Server_LogExport_Finish(const char *reason);
+static void TCP_Server_LogExport_Pump(void);
+static void TCP_Server_Subscribe_HandleRequest(uint8_t client_id, const char *args);
+static void TCP_Server_Subscribe_Pump(void);
 static uint16_t TCP_Server_SocketSend(uint8_t socket, uint8_t *data, uint16_t length);
 static uint16_t TCP_Server_SocketReceive(uint8_t socket, uint8_t *buffer, uint16_t max_length);
 static void TCP_Server_FormatSensorData(char *buffer, uint16_t *temp_sensors, uint16_t *press_sensors);
@@ -60,11 +135,23 @@ uint8_t TCP_Server_Init(uint16_t port) {
     /* Reset statistics */
     memset(&server_stats, 0, sizeof(tcp_server_stats_t));
 
-    /* Initialize Socket 1 for TCP server */
-    if (!W5500_Socket_Init(TCP_SERVER_SOCKET, W5500_MODE_TCP, server_port)) {
-        W5500_Debug_Message("TCP Server: Socket initialization failed!\r\n");
-        return 0;
-    }
+    /* Partition the 16KB TX budget by service: HTTP keeps a 4KB window,
+     * four pool sockets get 2KB, the last two run on 1KB - every socket
+     * stays usable (roles indexed by the service plan above) */
+    socket_role_t roles[W5500_MAX_SOCKETS] = {
+        SOCKET_ROLE_SERVER,             // 0: HTTP
+        SOCKET_ROLE_DATA,               // 1: data pool
+        SOCKET_ROLE_DATA,               // 2: CLI
+        SOCKET_ROLE_DATA, SOCKET_ROLE_DATA, SOCKET_ROLE_DATA,
+        SOCKET_ROLE_IDLE, SOCKET_ROLE_IDLE,
+    };
+    W5500_Socket_SetBufferPlan(roles);
+
+    /* The pool sockets are opened by their state machines from
+     * TCP_Server_Process - nothing blocks here */
+
+    /* Event-driven processing: unmask socket interrupts in the chip */
+    W5500_Events_Enable();
 
     W5500_Debug_Message("TCP Server: Initialization complete\r\n");
     return 1;
@@ -76,23 +163,14 @@ uint8_t TCP_Server_Init(uint16_t port) {
 uint8_t TCP_Server_Start(void) {
     W5500_Debug_Message("TCP Server: Starting server...\r\n");
 
-    /* Put socket in LISTEN mode */
-    uint8_t status = W5500_Socket_GetStatus(TCP_SERVER_SOCKET);
-    if (status != W5500_SOCK_INIT) {
-        W5500_Debug_Message("TCP Server: Socket not in INIT state, reinitializing...\r\n");
-        if (!W5500_Socket_Init(TCP_SERVER_SOCKET, W5500_MODE_TCP, server_port)) {
-            return 0;
-        }
-    }
-
-    /* Send LISTEN command */
-    // Note: This would require implementing socket command sending
-    // For now, assume socket is ready
+    /* Arm the per-socket state machines: each pool socket walks
+     * CLOSED -> OPEN -> LISTEN from TCP_Server_Process without blocking */
     server_state = TCP_STATE_LISTENING;
     server_start_time = HAL_GetTick();
 
-    char msg[60];
-    snprintf(msg, sizeof(msg), "TCP Server: Listening on port %d\r\n", server_port);
+    char msg[80];
+    snprintf(msg, sizeof(msg), "TCP Server: %d listeners spinning up on port %d\r\n",
+             TCP_MAX_CLIENTS, server_port);
     W5500_Debug_Message(msg);
 
     return 1;
@@ -104,15 +182,11 @@ uint8_t TCP_Server_Start(void) {
 uint8_t TCP_Server_Stop(void) {
     W5500_Debug_Message("TCP Server: Stopping server...\r\n");
 
-    /* Disconnect all clients */
+    /* Hard-close every pool socket - listeners and connections alike */
     for (uint8_t i = 0; i < TCP_MAX_CLIENTS; i++) {
-        if (tcp_clients[i].state != TCP_STATE_IDLE) {
-            TCP_Server_DisconnectClient(i);
-        }
+        W5500_Socket_Close(tcp_clients[i].socket_id);
+        TCP_Server_InitClient(i);
     }
-
-    /* Close server socket */
-    W5500_Socket_Close(TCP_SERVER_SOCKET);
     server_state = TCP_STATE_IDLE;
 
     W5500_Debug_Message("TCP Server: Stopped\r\n");
@@ -123,46 +197,64 @@ uint8_t TCP_Server_Stop(void) {
  * @brief Main TCP server processing function
  */
 void TCP_Server_Process(void) {
-    static uint32_t last_process_time = 0;
-
-    /* Throttle processing to avoid overwhelming the system */
-    if (HAL_GetTick() - last_process_time < 100) return; // Process every 100ms
-    last_process_time = HAL_GetTick();
+    static uint8_t prof_id = PROFILER_INVALID_SECTION;
+    static uint8_t rr_start = 0;
 
     if (server_state == TCP_STATE_IDLE) return;
 
+    if (prof_id == PROFILER_INVALID_SECTION) {
+        prof_id = Profiler_RegisterSection("TCP_Server_Process");
+    }
+    Profiler_Begin(prof_id);
+
     /* Update server statistics */
     TCP_Server_UpdateStats();
 
     /* Check for timeouts */
     TCP_Server_CheckTimeouts();
 
-    /* Handle server socket */
-    if (server_state == TCP_STATE_LISTENING) {
-        TCP_Server_HandleNewConnection();
+    /* Collect socket events (one SIR read when idle); a slow full sweep
+     * backstops any event the edge-triggered flags might miss */
+    uint8_t event_mask = W5500_Events_Poll();
+    static uint32_t last_full_sweep = 0;
+    uint8_t full_sweep = (HAL_GetTick() - last_full_sweep >= 1000);
+    if (full_sweep) {
+        last_full_sweep = HAL_GetTick();
     }
 
-    /* Process existing clients */
-    for (uint8_t i = 0; i < TCP_MAX_CLIENTS; i++) {
-        if (tcp_clients[i].state == TCP_STATE_CONNECTED ||
-            tcp_clients[i].state == TCP_STATE_DATA_READY) {
-            TCP_Server_HandleClientData(i);
-        }
+    /* Round-robin over the pool sockets: the starting slot rotates each
+     * pass and every socket is capped at TCP_CLIENT_BUDGET_US, so one
+     * greedy client cannot starve the rest */
+    for (uint8_t n = 0; n < TCP_MAX_CLIENTS; n++) {
+        uint8_t i = (uint8_t)((rr_start + n) % TCP_MAX_CLIENTS);
+        uint8_t events = W5500_Events_Get(tcp_clients[i].socket_id);
+        TCP_Server_ServiceSocket(i, (uint8_t)(events ||
+                                   (event_mask & (1 << tcp_clients[i].socket_id))),
+                                 full_sweep);
     }
+    rr_start = (uint8_t)((rr_start + 1) % TCP_MAX_CLIENTS);
+
+    /* Advance any in-progress log export (budgeted SD reads, TX-window
+     * gated sends - never blocks) */
+    TCP_Server_LogExport_Pump();
+
+    /* Send due per-client delta/keyframe telemetry */
+    TCP_Server_Subscribe_Pump();
 
-    /* Handle automatic data streaming */
+    /* Handle automatic data streaming - compact binary frames, no
+     * printf formatting in the streaming path */
     if (data_streaming_enabled &&
         HAL_GetTick() - last_stream_time > streaming_interval) {
         last_stream_time = HAL_GetTick();
 
-        /* Example: Stream current sensor data to all clients */
-        char stream_data[200];
-        snprintf(stream_data, sizeof(stream_data),
-                "STREAM: Time=%lu, Clients=%lu, Uptime=%lu\r\n",
-                HAL_GetTick(), server_stats.active_connections,
-                (HAL_GetTick() - server_start_time) / 1000);
-        TCP_Server_Broadcast((uint8_t*)stream_data, strlen(stream_data));
+        uint8_t frame[TELEM_MAX_FRAME];
+        uint16_t frame_len = Telemetry_BuildSensorFrame(frame, sizeof(frame));
+        if (frame_len > 0) {
+            TCP_Server_Broadcast(frame, frame_len);
+        }
     }
+
+    Profiler_End(prof_id);
 }
 
 /**
@@ -183,6 +275,27 @@ uint16_t TCP_Server_Send(uint8_t client_id, uint8_t *data, uint16_t length) {
     return sent;
 }
 
+/**
+ * @brief Scatter-gather send to specific client (header + payload
+ * fragments go straight into the W5500 TX window, one SEND commit)
+ */
+uint16_t TCP_Server_SendVectored(uint8_t client_id, const w5500_tx_fragment_t *fragments,
+                                 uint8_t count) {
+    if (client_id >= TCP_MAX_CLIENTS) return 0;
+    if (tcp_clients[client_id].state != TCP_STATE_CONNECTED) return 0;
+
+    uint16_t sent = W5500_Socket_SendVectored(tcp_clients[client_id].socket_id,
+                                              fragments, count);
+
+    if (sent > 0) {
+        tcp_clients[client_id].bytes_sent += sent;
+        tcp_clients[client_id].last_activity = HAL_GetTick();
+        server_stats.total_bytes_sent += sent;
+    }
+
+    return sent;
+}
+
 /**
  * @brief Send data to all connected clients
  */
@@ -198,6 +311,22 @@ uint8_t TCP_Server_Broadcast(uint8_t *data, uint16_t length) {
     return clients_sent;
 }
 
+/**
+ * @brief Scatter-gather broadcast: the caller formats the frame once,
+ * and each connected socket gets one burst write per fragment
+ */
+uint8_t TCP_Server_BroadcastVectored(const w5500_tx_fragment_t *fragments, uint8_t count) {
+    uint8_t clients_sent = 0;
+
+    for (uint8_t i = 0; i < TCP_MAX_CLIENTS; i++) {
+        if (TCP_Server_SendVectored(i, fragments, count) > 0) {
+            clients_sent++;
+        }
+    }
+
+    return clients_sent;
+}
+
 /**
  * @brief Check if client is connected
  */
@@ -216,16 +345,11 @@ uint8_t TCP_Server_DisconnectClient(uint8_t client_id) {
     snprintf(msg, sizeof(msg), "TCP Server: Disconnecting client %d\r\n", client_id);
     W5500_Debug_Message(msg);
 
-    /* Close client socket */
-    W5500_Socket_Close(tcp_clients[client_id].socket_id);
-
-    /* Call disconnect callback if registered */
-    if (client_disconnect_cb) {
-        client_disconnect_cb(client_id);
-    }
-
-    /* Reset client state */
-    TCP_Server_InitClient(client_id);
+    /* Graceful FIN - the state machine recycles the slot once the
+     * socket reaches CLOSED (hard-close fallback after 2s) */
+    W5500_Socket_Disconnect(tcp_clients[client_id].socket_id);
+    tcp_clients[client_id].last_activity = HAL_GetTick();
+    tcp_clients[client_id].state = TCP_STATE_DISCONNECTING;
 
     return 1;
 }
@@ -296,6 +420,13 @@ void TCP_Server_Debug(void) {
             server_stats.total_bytes_sent, server_stats.total_bytes_received);
     W5500_Debug_Message(msg);
 
+    /* Full socket map: service plan plus live chip status */
+    for (uint8_t s = 0; s < W5500_MAX_SOCKETS; s++) {
+        snprintf(msg, sizeof(msg), "Socket %d: svc=%s status=0x%02X\r\n",
+                s, service_names[socket_services[s]], W5500_Socket_GetStatus(s));
+        W5500_Debug_Message(msg);
+    }
+
     for (uint8_t i = 0; i < TCP_MAX_CLIENTS; i++) {
         if (tcp_clients[i].state != TCP_STATE_IDLE) {
             snprintf(msg, sizeof(msg), "Client %d: Socket=%d, State=%d, IP=%d.%d.%d.%d\r\n",
@@ -305,6 +436,14 @@ void TCP_Server_Debug(void) {
             W5500_Debug_Message(msg);
         }
     }
+
+    if (log_export_active) {
+        snprintf(msg, sizeof(msg),
+                "Log export: client=%d sector=%lu/%lu sent=%lu bytes\r\n",
+                log_export_client, log_export_sector, log_export_end_sector,
+                log_export_bytes_total);
+        W5500_Debug_Message(msg);
+    }
 }
 
 /* Private Functions */
@@ -315,54 +454,138 @@ void TCP_Server_Debug(void) {
 static void TCP_Server_InitClient(uint8_t client_id) {
     memset(&tcp_clients[client_id], 0, sizeof(tcp_client_t));
     tcp_clients[client_id].client_id = client_id;
-    tcp_clients[client_id].socket_id = TCP_SERVER_SOCKET + client_id + 1; // Sockets 2-5
+    tcp_clients[client_id].socket_id = tcp_client_sockets[client_id];
     tcp_clients[client_id].state = TCP_STATE_IDLE;
+    memset(&telem_subs[client_id], 0, sizeof(telem_sub_t));
 }
 
 /**
- * @brief Handle new incoming connections
+ * @brief Advance one pool socket's state machine - never blocks
+ * @note  One Sn_SR read per call; command completion is observed on the
+ *        next pass instead of spin-waiting on Sn_CR
  */
-static void TCP_Server_HandleNewConnection(void) {
-    /* Check if server socket has pending connection */
-    uint8_t socket_status = W5500_Socket_GetStatus(TCP_SERVER_SOCKET);
-
-    /* This is a simplified version - full implementation would check for
-     * SOCK_ESTABLISHED status and handle the connection handshake
-     */
-    if (socket_status == W5500_SOCK_ESTABLISHED) {
-        uint8_t free_client = TCP_Server_FindFreeClient();
-        if (free_client < TCP_MAX_CLIENTS) {
-            /* Accept connection */
-            tcp_clients[free_client].state = TCP_STATE_CONNECTED;
-            tcp_clients[free_client].connect_time = HAL_GetTick();
-            tcp_clients[free_client].last_activity = HAL_GetTick();
-
-            server_stats.total_connections++;
-            server_stats.active_connections++;
-            server_stats.last_client_connect = HAL_GetTick();
+static void TCP_Server_ServiceSocket(uint8_t client_id, uint8_t events, uint8_t full_sweep) {
+    tcp_client_t *client = &tcp_clients[client_id];
+    uint8_t status = W5500_Socket_GetStatus(client->socket_id);
+
+    switch (client->state) {
+        case TCP_STATE_IDLE:
+            /* Respawn the listener: OPEN now, LISTEN once INIT shows */
+            if (status == W5500_SOCK_CLOSED) {
+                W5500_Socket_OpenTCP(client->socket_id, server_port);
+                client->state = TCP_STATE_OPENING;
+            } else {
+                W5500_Socket_Close(client->socket_id);
+            }
+            break;
+
+        case TCP_STATE_OPENING:
+            if (status == W5500_SOCK_INIT) {
+                W5500_Socket_Listen(client->socket_id);
+                client->state = TCP_STATE_LISTENING;
+            } else if (status == W5500_SOCK_CLOSED) {
+                client->state = TCP_STATE_IDLE;      // OPEN failed, retry
+            }
+            break;
 
-            char msg[80];
-            snprintf(msg, sizeof(msg), "TCP Server: Client %d connected\r\n", free_client);
-            W5500_Debug_Message(msg);
+        case TCP_STATE_LISTENING:
+            if (status == W5500_SOCK_ESTABLISHED) {
+                TCP_Server_AcceptClient(client_id);
+            } else if (status == W5500_SOCK_CLOSED) {
+                client->state = TCP_STATE_IDLE;      // Aborted handshake
+            }
+            break;
 
-            if (client_connect_cb) {
-                client_connect_cb(free_client, tcp_clients[free_client].remote_ip);
+        case TCP_STATE_CONNECTED:
+        case TCP_STATE_DATA_READY:
+            if (status == W5500_SOCK_CLOSED) {
+                TCP_Server_ReleaseClient(client_id);
+                break;
             }
-        }
+            if (events || full_sweep) {
+                TCP_Server_HandleClientData(client_id);
+            }
+            if (status == W5500_SOCK_CLOSE_WAIT) {
+                /* Peer sent FIN - answer after draining pending RX */
+                W5500_Socket_Disconnect(client->socket_id);
+                client->state = TCP_STATE_DISCONNECTING;
+            }
+            break;
+
+        case TCP_STATE_DISCONNECTING:
+            if (status == W5500_SOCK_CLOSED) {
+                TCP_Server_ReleaseClient(client_id);
+            } else if (status == W5500_SOCK_FIN_WAIT || status == W5500_SOCK_LAST_ACK ||
+                       status == W5500_SOCK_CLOSING || status == W5500_SOCK_TIME_WAIT) {
+                /* FIN handshake in flight - wait */
+            } else if ((HAL_GetTick() - client->last_activity) > 2000) {
+                W5500_Socket_Close(client->socket_id);   // Peer ignoring FIN
+            }
+            break;
+
+        default:
+            client->state = TCP_STATE_IDLE;
+            break;
+    }
+}
+
+/**
+ * @brief A listening pool socket went ESTABLISHED - book the client in.
+ *        The other pool sockets are already listening, which is the
+ *        W5500 equivalent of respawning the accept socket.
+ */
+static void TCP_Server_AcceptClient(uint8_t client_id) {
+    tcp_client_t *client = &tcp_clients[client_id];
+
+    client->state = TCP_STATE_CONNECTED;
+    client->connect_time = HAL_GetTick();
+    client->last_activity = HAL_GetTick();
+    W5500_Socket_GetRemote(client->socket_id, client->remote_ip, &client->remote_port);
+
+    server_stats.total_connections++;
+    server_stats.last_client_connect = HAL_GetTick();
+
+    char msg[80];
+    snprintf(msg, sizeof(msg), "TCP Server: Client %d connected (%d.%d.%d.%d, socket %d)\r\n",
+             client_id, client->remote_ip[0], client->remote_ip[1],
+             client->remote_ip[2], client->remote_ip[3], client->socket_id);
+    W5500_Debug_Message(msg);
+
+    if (client_connect_cb) {
+        client_connect_cb(client_id, client->remote_ip);
     }
 }
 
 /**
- * @brief Handle data from connected client
+ * @brief Connection fully closed - recycle the slot back into a listener
+ */
+static void TCP_Server_ReleaseClient(uint8_t client_id) {
+    if (log_export_active && log_export_client == client_id) {
+        TCP_Server_LogExport_Finish("ABORT");
+    }
+
+    if (client_disconnect_cb) {
+        client_disconnect_cb(client_id);
+    }
+
+    TCP_Server_InitClient(client_id);   /* state -> IDLE, respawns next pass */
+}
+
+/**
+ * @brief Drain and handle data from one connected client
+ * @note  Capped at TCP_CLIENT_BUDGET_US of DWT time per pass - a client
+ *        blasting requests gets round-robined, not the whole loop
  */
 static void TCP_Server_HandleClientData(uint8_t client_id) {
     uint8_t buffer[TCP_BUFFER_SIZE];
+    uint32_t budget = TCP_CLIENT_BUDGET_US * (SystemCoreClock / 1000000U);
+    uint32_t start = DWT->CYCCNT;
 
-    /* Check for received data */
-    uint16_t received = TCP_Server_SocketReceive(tcp_clients[client_id].socket_id,
-                                                buffer, sizeof(buffer));
+    do {
+        uint16_t received = TCP_Server_SocketReceive(tcp_clients[client_id].socket_id,
+                                                    buffer, sizeof(buffer));
+        if (received == 0) break;
 
-    if (received > 0) {
         tcp_clients[client_id].bytes_received += received;
         tcp_clients[client_id].last_activity = HAL_GetTick();
         server_stats.total_bytes_received += received;
@@ -372,23 +595,272 @@ static void TCP_Server_HandleClientData(uint8_t client_id) {
             data_received_cb(client_id, buffer, received);
         }
 
+        /* Log export request? */
+        if (received >= 6 && strncmp((char*)buffer, "LOGGET", 6) == 0) {
+            buffer[(received < TCP_BUFFER_SIZE) ? received : TCP_BUFFER_SIZE - 1] = 0;
+            TCP_Server_LogExport_HandleRequest(client_id, (char*)&buffer[6]);
+            return;
+        }
+
+        /* Telemetry subscription? */
+        if (received >= 3 && strncmp((char*)buffer, "SUB", 3) == 0) {
+            buffer[(received < TCP_BUFFER_SIZE) ? received : TCP_BUFFER_SIZE - 1] = 0;
+            TCP_Server_Subscribe_HandleRequest(client_id, (char*)&buffer[3]);
+            continue;
+        }
+        if (received >= 5 && strncmp((char*)buffer, "UNSUB", 5) == 0) {
+            telem_subs[client_id].active = 0;
+            TCP_Server_Send(client_id, (uint8_t*)"UNSUB OK\r\n", 10);
+            continue;
+        }
+
         /* Simple echo for testing */
         char echo[100];
         snprintf(echo, sizeof(echo), "ECHO: Received %d bytes\r\n", received);
         TCP_Server_Send(client_id, (uint8_t*)echo, strlen(echo));
+    } while ((DWT->CYCCNT - start) < budget);
+}
+
+/**
+ * @brief Start a log export for a client: "LOGGET [<start_record> <count>]"
+ * @note  The range is rounded out to whole sectors (8 records); with no
+ *        arguments the entire log is exported
+ */
+static void TCP_Server_LogExport_HandleRequest(uint8_t client_id, const char *args) {
+    char msg[100];
+
+    if (log_export_active) {
+        TCP_Server_Send(client_id, (uint8_t*)"LOGGET BUSY\r\n", 13);
+        return;
+    }
+    if (!SDLog_IsReady()) {
+        TCP_Server_Send(client_id, (uint8_t*)"LOGGET NOLOG\r\n", 14);
+        return;
+    }
+
+    uint32_t total_records = SDLog_GetRecordCount();
+    uint32_t start_record = 0;
+    uint32_t record_count = total_records;
+
+    char *end = NULL;
+    uint32_t a = strtoul(args, &end, 10);
+    if (end != args) {
+        start_record = a;
+        char *end2 = NULL;
+        uint32_t b = strtoul(end, &end2, 10);
+        if (end2 != end) {
+            record_count = b;
+        }
+    }
+
+    /* Round out to whole sectors - export works in 512-byte units */
+    log_export_sector = start_record / SDLOG_RECORDS_PER_SECTOR;
+    log_export_end_sector = (start_record + record_count +
+                             SDLOG_RECORDS_PER_SECTOR - 1) / SDLOG_RECORDS_PER_SECTOR;
+    uint32_t avail_sectors = total_records / SDLOG_RECORDS_PER_SECTOR;
+    if (log_export_end_sector > avail_sectors) {
+        log_export_end_sector = avail_sectors;
+    }
+    if (log_export_sector >= log_export_end_sector) {
+        TCP_Server_Send(client_id, (uint8_t*)"LOGGET EMPTY\r\n", 14);
+        return;
+    }
+
+    log_export_client = client_id;
+    log_export_staged = 0;
+    log_export_drained = 0;
+    log_export_bytes_total = 0;
+    log_export_start_tick = HAL_GetTick();
+    log_export_active = 1;
+
+    snprintf(msg, sizeof(msg), "LOGGET OK %lu %u\r\n",
+             (log_export_end_sector - log_export_sector) * SDLOG_RECORDS_PER_SECTOR,
+             SDLOG_RECORD_SIZE);
+    TCP_Server_Send(client_id, (uint8_t*)msg, strlen(msg));
+}
+
+/**
+ * @brief End the current export and tell the client why
+ */
+static void TCP_Server_LogExport_Finish(const char *reason) {
+    char msg[100];
+
+    log_export_active = 0;
+    snprintf(msg, sizeof(msg), "LOGGET %s %lu %lu\r\n", reason,
+             log_export_bytes_total, HAL_GetTick() - log_export_start_tick);
+    TCP_Server_Send(log_export_client, (uint8_t*)msg, strlen(msg));
+    W5500_Debug_Message("TCP Server: log export finished\r\n");
+}
+
+/**
+ * @brief Per-pass export pump: refill staging with multi-block SD reads
+ *        and drain it into the W5500 TX window while Sn_TX_FSR has room
+ */
+static void TCP_Server_LogExport_Pump(void) {
+    if (!log_export_active) return;
+
+    /* A DMA drain kicked off last pass owns the staging buffer until
+     * its SEND commits - no refill or further drain until then. Runs
+     * before the client check so an abort never strands the transfer. */
+    if (W5500_Socket_AsyncInFlight()) {
+        if (W5500_Socket_AsyncPump() == 0) {
+            return;     // Payload still moving - come back next pass
+        }
+    }
+
+    tcp_client_t *client = &tcp_clients[log_export_client];
+    if (client->state != TCP_STATE_CONNECTED) {
+        log_export_active = 0;
+        W5500_Debug_Message("TCP Server: log export aborted (client gone)\r\n");
+        return;
+    }
+
+    uint8_t reads_left = LOG_EXPORT_READS_PER_PASS;
+
+    for (;;) {
+        /* Refill staging when drained */
+        if (log_export_drained >= log_export_staged) {
+            if (log_export_sector >= log_export_end_sector) {
+                TCP_Server_LogExport_Finish("DONE");
+                return;
+            }
+            if (reads_left == 0) {
+                return;     // SD read budget for this pass used up
+            }
+            uint32_t want = log_export_end_sector - log_export_sector;
+            if (want > LOG_EXPORT_SECTORS_PER_READ) {
+                want = LOG_EXPORT_SECTORS_PER_READ;
+            }
+            uint32_t got = SDLog_ReadSectors(log_export_sector,
+                                             log_export_staging, want);
+            if (got == 0) {
+                TCP_Server_LogExport_Finish("ERROR");
+                return;
+            }
+            reads_left--;
+            log_export_sector += got;
+            log_export_staged = (uint16_t)(got * SD_CARD_BLOCK_SIZE);
+            log_export_drained = 0;
+        }
+
+        /* Drain into the TX window - gate on free size so the SEND
+         * never has to wait on the wire */
+        uint16_t tx_free = W5500_Socket_GetTxFreeSize(client->socket_id);
+        if (tx_free < LOG_EXPORT_MIN_TX_FREE) {
+            return;         // Window full - resume next pass
+        }
+
+        uint16_t chunk = log_export_staged - log_export_drained;
+        if (chunk > tx_free) {
+            chunk = tx_free;
+        }
+
+        /* Large chunks move on SPI DMA: the burst into the TX window
+         * runs while the loop goes back to control work, and the SEND
+         * commits at the top of the next pass */
+        uint16_t sent = W5500_Socket_SendDataAsync(client->socket_id,
+                                        &log_export_staging[log_export_drained],
+                                        chunk);
+        if (sent == 0) {
+            return;         // Transient send failure - retry next pass
+        }
+        client->bytes_sent += sent;
+        client->last_activity = HAL_GetTick();
+        server_stats.total_bytes_sent += sent;
+        log_export_drained += sent;
+        log_export_bytes_total += sent;
+
+        if (W5500_Socket_AsyncInFlight()) {
+            return;         // DMA owns the staging buffer - back to the loop
+        }
+        /* Short chunk went polled and is already committed - keep going */
     }
 }
 
 /**
- * @brief Find free client slot
+ * @brief Arm a telemetry subscription: "SUB <interval_ms> [<mask_hex>]"
+ * @note  Interval is clamped to 100 ms..60 s; with no mask the client
+ *        gets every field. The first frame out is always a keyframe.
  */
-static uint8_t TCP_Server_FindFreeClient(void) {
+static void TCP_Server_Subscribe_HandleRequest(uint8_t client_id, const char *args) {
+    telem_sub_t *sub = &telem_subs[client_id];
+    char msg[60];
+
+    uint32_t interval = streaming_interval;
+    uint16_t mask = TELEM_FIELD_MASK_ALL;
+
+    char *end = NULL;
+    uint32_t a = strtoul(args, &end, 10);
+    if (end != args) {
+        interval = a;
+        char *end2 = NULL;
+        uint32_t m = strtoul(end, &end2, 16);
+        if (end2 != end) {
+            mask = (uint16_t)(m & TELEM_FIELD_MASK_ALL);
+        }
+    }
+
+    if (interval < 100) interval = 100;
+    if (interval > 60000) interval = 60000;
+    if (mask == 0) mask = TELEM_FIELD_MASK_ALL;
+
+    sub->field_mask = mask;
+    sub->interval_ms = interval;
+    sub->next_send = HAL_GetTick();     // First frame goes out this pass
+    sub->frames_until_key = 0;          // ...and it is a keyframe
+    sub->active = 1;
+
+    snprintf(msg, sizeof(msg), "SUB OK %lu 0x%04X\r\n", interval, mask);
+    TCP_Server_Send(client_id, (uint8_t*)msg, strlen(msg));
+}
+
+/**
+ * @brief Per-pass subscription pump: one payload fill is shared by every
+ *        due client; each gets a keyframe or a delta against what it was
+ *        last sent
+ */
+static void TCP_Server_Subscribe_Pump(void) {
+    TelemetrySensorPayload_t current;
+    uint8_t frame[TELEM_MAX_FRAME];
+    uint8_t filled = 0;
+    uint32_t now = HAL_GetTick();
+
     for (uint8_t i = 0; i < TCP_MAX_CLIENTS; i++) {
-        if (tcp_clients[i].state == TCP_STATE_IDLE) {
-            return i;
+        telem_sub_t *sub = &telem_subs[i];
+
+        if (!sub->active || tcp_clients[i].state != TCP_STATE_CONNECTED) continue;
+        if ((int32_t)(now - sub->next_send) < 0) continue;
+
+        if (!filled) {
+            Telemetry_FillSensorPayload(&current);
+            filled = 1;
         }
+
+        uint16_t frame_len;
+        if (sub->frames_until_key == 0) {
+            frame_len = Telemetry_BuildKeyFrame(frame, sizeof(frame), &current);
+        } else {
+            frame_len = Telemetry_BuildDeltaFrame(frame, sizeof(frame),
+                                                  &current, &sub->last_sent,
+                                                  sub->field_mask);
+        }
+
+        if (frame_len == 0 && sub->frames_until_key != 0) {
+            /* Nothing changed - skip the slot, keep the keyframe cadence */
+            sub->next_send = now + sub->interval_ms;
+            continue;
+        }
+
+        if (TCP_Server_Send(i, frame, frame_len) == frame_len) {
+            sub->last_sent = current;
+            sub->frames_until_key = (sub->frames_until_key == 0)
+                                    ? TELEM_KEYFRAME_EVERY
+                                    : (uint8_t)(sub->frames_until_key - 1);
+        }
+        /* A failed send just drops this interval's frame; the delta
+         * reference is untouched so nothing is lost, only late */
+        sub->next_send = now + sub->interval_ms;
     }
-    return TCP_MAX_CLIENTS; // No free slots
 }
 
 /**
@@ -423,42 +895,38 @@ static void TCP_Server_UpdateStats(void) {
  * @brief Format sensor data for transmission
  */
 static void TCP_Server_FormatSensorData(char *buffer, uint16_t *temp_sensors, uint16_t *press_sensors) {
-    snprintf(buffer, 300, "SENSORS,TIME=%lu", HAL_GetTick());
+    /* Append formatters: no snprintf/strcat rescans in the periodic path */
+    char *p = buffer;
+
+    p = Fmt_Str(p, "SENSORS,TIME=");
+    p = Fmt_U32(p, HAL_GetTick());
 
     /* Add temperature sensors */
     if (temp_sensors) {
-        strcat(buffer, ",TEMP=");
+        p = Fmt_Str(p, ",TEMP=");
         for (int i = 0; i < 12; i++) {
-            char temp_str[10];
-            snprintf(temp_str, sizeof(temp_str), "%d.%d",
-                    temp_sensors[i] / 10, temp_sensors[i] % 10);
-            strcat(buffer, temp_str);
-            if (i < 11) strcat(buffer, ",");
+            if (i) p = Fmt_Char(p, ',');
+            p = Fmt_Fixed(p, temp_sensors[i], 1);
         }
     }
 
     /* Add pressure sensors */
     if (press_sensors) {
-        strcat(buffer, ",PRESS=");
+        p = Fmt_Str(p, ",PRESS=");
         for (int i = 0; i < 12; i++) {
-            char press_str[10];
-            snprintf(press_str, sizeof(press_str), "%d.%d",
-                    press_sensors[i] / 10, press_sensors[i] % 10);
-            strcat(buffer, press_str);
-            if (i < 11) strcat(buffer, ",");
+            if (i) p = Fmt_Char(p, ',');
+            p = Fmt_Fixed(p, press_sensors[i], 1);
         }
     }
 
-    strcat(buffer, "\r\n");
+    Fmt_Str(p, "\r\n");
 }
 
-/* Placeholder socket functions - these need to be implemented based on W5500 socket operations */
+/* Socket data transfer - burst SPI through the W5500 socket buffers */
 static uint16_t TCP_Server_SocketSend(uint8_t socket, uint8_t *data, uint16_t length) {
-    /* This would implement actual W5500 socket data transmission */
-    return length; // Placeholder
+    return W5500_Socket_SendData(socket, data, length);
 }
 
 static uint16_t TCP_Server_SocketReceive(uint8_t socket, uint8_t *buffer, uint16_t max_length) {
-    /* This would implement actual W5500 socket data reception */
-    return 0; // Placeholder
+    return W5500_Socket_ReceiveData(socket, buffer, max_length);
 }
@@ -0,0 +1,184 @@
+/**
+ * @file    warm_restart.c
+ * @brief   Warm-Restart State Preservation Implementation
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ */
+
+#include "warm_restart.h"
+#include "ch_control_core.h"
+#include "ch_staging.h"
+#include "ch_safety.h"
+#include "ch_temp_control.h"
+#include "crc_util.h"
+#include "uart_comm.h"
+#include <stdio.h>
+#include <string.h>
+
+/* ========================================================================== */
+/* PRIVATE VARIABLES                                                          */
+/* ========================================================================== */
+
+/* The block lives at the start of backup SRAM */
+#define WARM_BLOCK  ((WarmRestartBlock_t*)WARM_RESTART_SRAM_BASE)
+
+static uint8_t warm_reset_cause = 0;        // Reset was soft/IWDG/WWDG
+static uint8_t compressors_resumed = 0;
+static uint16_t mirror_sequence = 0;
+static const char *restore_result = "not attempted";
+
+/* ========================================================================== */
+/* PRIVATE FUNCTIONS                                                          */
+/* ========================================================================== */
+
+/**
+ * @brief Verify the block in backup SRAM (magic, layout, CRC)
+ */
+static uint8_t WarmRestart_BlockValid(void)
+{
+    if (WARM_BLOCK->magic != WARM_RESTART_MAGIC ||
+        WARM_BLOCK->length != sizeof(WarmRestartBlock_t)) {
+        return 0;
+    }
+    uint32_t crc = CRC32_Calculate((const uint8_t*)WARM_BLOCK,
+                                   sizeof(WarmRestartBlock_t) - sizeof(uint32_t));
+    return (crc == WARM_BLOCK->crc32) ? 1 : 0;
+}
+
+/* ========================================================================== */
+/* PUBLIC FUNCTIONS                                                           */
+/* ========================================================================== */
+
+void WarmRestart_Init(void)
+{
+    // Backup SRAM needs its clock and the backup regulator (content is
+    // then retained on VBAT like the RTC backup registers)
+    HAL_PWR_EnableBkUpAccess();
+    __HAL_RCC_BKPRAM_CLK_ENABLE();
+    HAL_PWREx_EnableBkUpReg();
+
+    // Latch the reset cause before Watchdog_Init clears the sticky
+    // flags for its own post-mortem. Warm = the backup domain (and the
+    // building's thermal state) carried straight through the reset.
+    uint32_t reset_flags = RCC->RSR;
+    warm_reset_cause = ((reset_flags & (RCC_RSR_SFTRSTF | RCC_RSR_IWDG1RSTF |
+                                        RCC_RSR_WWDG1RSTF)) != 0) &&
+                       ((reset_flags & (RCC_RSR_PORRSTF | RCC_RSR_BORRSTF)) == 0);
+
+    Send_Debug_Data(warm_reset_cause ? "Warm Restart: Warm reset detected\r\n"
+                                     : "Warm Restart: Cold boot\r\n");
+}
+
+uint8_t WarmRestart_TryRestore(void)
+{
+    if (!warm_reset_cause) {
+        restore_result = "cold boot";
+        return 0;
+    }
+    if (!WarmRestart_BlockValid()) {
+        restore_result = "block invalid";
+        Send_Debug_Data("Warm Restart: Saved state invalid, cold-starting\r\n");
+        return 0;
+    }
+    if (Safety_IsSystemLocked()) {
+        restore_result = "safety lockout";
+        Send_Debug_Data("Warm Restart: Safety lockout, cold-starting\r\n");
+        return 0;
+    }
+    if (WARM_BLOCK->compressor_mask == 0) {
+        restore_result = "plant was idle";
+        return 0;
+    }
+
+    // Carry the bookkeeping over: fault history for the service record,
+    // the active setpoint so control resumes where it left off. Live
+    // faults are deliberately NOT re-latched - the safety scans re-detect
+    // anything still real within one tick of the plant running.
+    g_chiller_core.status.fault_history |= (ChillerFaultCode_t)WARM_BLOCK->fault_history;
+    TempControl_SetSetpoint(WARM_BLOCK->setpoint);
+
+    // Re-stage from the saved running set - each unit re-validated by
+    // the safety system inside Staging_WarmRestore, timer remainders
+    // carried over so the protection windows continue, not restart
+    compressors_resumed = Staging_WarmRestore(WARM_BLOCK->compressor_mask,
+                                              WARM_BLOCK->comp_run_elapsed_ms,
+                                              WARM_BLOCK->condenser_mask,
+                                              WARM_BLOCK->cond_run_elapsed_ms,
+                                              WARM_BLOCK->since_comp_start_ms,
+                                              WARM_BLOCK->since_comp_stop_ms);
+
+    if (compressors_resumed > 0) {
+        g_chiller_core.status.current_state = (ChillerSystemState_t)WARM_BLOCK->system_state;
+        g_chiller_core.status.current_capacity_mode = (CapacityMode_t)WARM_BLOCK->capacity_mode;
+        g_chiller_core.status.state_enter_time = HAL_GetTick();
+        g_chiller_core.automatic_recoveries++;
+        restore_result = "resumed";
+    } else {
+        restore_result = "no unit passed re-validation";
+    }
+
+    char msg[100];
+    snprintf(msg, sizeof(msg),
+             "Warm Restart: Resumed %u compressor(s) from saved state (seq %u)\r\n",
+             compressors_resumed, WARM_BLOCK->sequence);
+    Send_Debug_Data(msg);
+    return compressors_resumed;
+}
+
+void WarmRestart_Mirror(void)
+{
+    WarmRestartBlock_t block;
+    uint32_t now = HAL_GetTick();
+
+    if (!g_chiller_core_initialized) return;
+
+    memset(&block, 0, sizeof(block));
+    block.magic = WARM_RESTART_MAGIC;
+    block.length = sizeof(WarmRestartBlock_t);
+    block.sequence = ++mirror_sequence;
+    block.system_state = (uint8_t)g_chiller_core.status.current_state;
+    block.capacity_mode = (uint8_t)g_chiller_core.status.current_capacity_mode;
+    block.active_faults = (uint16_t)g_chiller_core.status.active_faults;
+    block.fault_history = (uint16_t)g_chiller_core.status.fault_history;
+    block.setpoint = TempControl_GetSetpoint();
+
+    for (uint8_t i = 0; i < MAX_COMPRESSORS; i++) {
+        const CompressorStatus_t *comp = &g_staging_system.compressors[i];
+        if (comp->is_running) {
+            block.compressor_mask |= (1u << i);
+            block.comp_run_elapsed_ms[i] = now - comp->start_time;
+        }
+    }
+    for (uint8_t i = 0; i < MAX_CONDENSER_BANKS; i++) {
+        const CondenserStatus_t *cond = &g_staging_system.condensers[i];
+        if (cond->is_running) {
+            block.condenser_mask |= (1u << i);
+            block.cond_run_elapsed_ms[i] = now - cond->start_time;
+        }
+    }
+    block.since_comp_start_ms = now - g_staging_system.status.last_compressor_start;
+    block.since_comp_stop_ms = now - g_staging_system.status.last_compressor_stop;
+    block.save_uptime_ms = now;
+    block.crc32 = CRC32_Calculate((const uint8_t*)&block,
+                                  sizeof(WarmRestartBlock_t) - sizeof(uint32_t));
+
+    // One copy into backup SRAM; a reset mid-copy leaves a block that
+    // fails its CRC and the next boot cold-starts - never a torn resume
+    memcpy(WARM_BLOCK, &block, sizeof(block));
+}
+
+void WarmRestart_PrintStatus(void)
+{
+    char msg[120];
+
+    Send_Debug_Data("\r\n=== Warm Restart ===\r\n");
+    snprintf(msg, sizeof(msg), "Reset: %s, restore: %s, resumed: %u\r\n",
+             warm_reset_cause ? "warm" : "cold", restore_result, compressors_resumed);
+    Send_Debug_Data(msg);
+    snprintf(msg, sizeof(msg), "Mirror: seq %u, block %s, %u bytes\r\n",
+             mirror_sequence, WarmRestart_BlockValid() ? "valid" : "INVALID",
+             (unsigned)sizeof(WarmRestartBlock_t));
+    Send_Debug_Data(msg);
+    Send_Debug_Data("====================\r\n\r\n");
+}
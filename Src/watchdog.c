@@ -0,0 +1,175 @@
+/**
+ * @file    watchdog.c
+ * @brief   Independent Watchdog Supervision Implementation
+ * @author  Industrial Chiller Control System
+ * @version 1.0
+ * @date    2025
+ */
+
+#include "watchdog.h"
+#include "ch_control_core.h"
+#include "uart_comm.h"
+#include <stdio.h>
+
+static IWDG_HandleTypeDef hiwdg1;
+
+static uint8_t watchdog_running = 0;
+static uint32_t expected_mask = 0;      // Critical tasks that must check in
+static volatile uint32_t alive_mask = 0;    // Tasks seen since the last kick
+static uint32_t kick_count = 0;
+static uint32_t starved_passes = 0;     // Process passes with bits missing
+static uint8_t last_task_id = 0xFF;
+
+static volatile uint32_t *Watchdog_BkpReg(uint8_t index)
+{
+    return (&RTC->BKP0R) + index;
+}
+
+/**
+ * @brief Decode and log whatever the previous run left in backup RAM
+ */
+static void Watchdog_ReportPostMortem(void)
+{
+    uint32_t reset_flags = RCC->RSR;
+    RCC->RSR |= RCC_RSR_RMVF;       // Clear the sticky reset-cause flags
+
+    uint32_t marker = *Watchdog_BkpReg(WDG_BKP_MARKER);
+    if ((marker & WDG_MARKER_MAGIC_MASK) != WDG_MARKER_MAGIC) {
+        return;     // First boot or lost backup power - nothing recorded
+    }
+
+    uint8_t fault_type = (uint8_t)(marker >> 8);
+    uint8_t task_id = (uint8_t)marker;
+    uint8_t was_iwdg = (reset_flags & RCC_RSR_IWDG1RSTF) ? 1 : 0;
+
+    // A marker with no fault type only matters after a watchdog reset:
+    // a clean power cycle leaves the same runtime marker behind
+    if (fault_type == WDG_FAULT_NONE && !was_iwdg) {
+        return;
+    }
+
+    static const char *fault_names[] = {
+        "WATCHDOG WEDGE", "HARD FAULT", "MEMMANAGE FAULT",
+        "BUS FAULT", "USAGE FAULT"
+    };
+    const char *name = (fault_type <= WDG_FAULT_USAGEFAULT) ?
+                       fault_names[fault_type] : "UNKNOWN";
+
+    char msg[160];
+    snprintf(msg, sizeof(msg),
+             "Watchdog: previous run ended in %s - last task %u, PC=0x%08lX LR=0x%08lX CYC=%lu%s\r\n",
+             name, task_id,
+             *Watchdog_BkpReg(WDG_BKP_PC), *Watchdog_BkpReg(WDG_BKP_LR),
+             *Watchdog_BkpReg(WDG_BKP_CYCCNT),
+             was_iwdg ? " (IWDG reset)" : "");
+    Send_Debug_Data(msg);
+
+    snprintf(msg, sizeof(msg), "%s (task %u, PC 0x%08lX)",
+             name, task_id, *Watchdog_BkpReg(WDG_BKP_PC));
+    ChillerCore_LogFault(CH_FAULT_CRITICAL_SYSTEM, msg);
+
+    // Consume the capture so one event is reported once
+    *Watchdog_BkpReg(WDG_BKP_PC) = 0;
+    *Watchdog_BkpReg(WDG_BKP_LR) = 0;
+    *Watchdog_BkpReg(WDG_BKP_CYCCNT) = 0;
+}
+
+uint8_t Watchdog_Init(void)
+{
+    // Backup domain access is normally already open (RTCBackup_Init),
+    // but don't depend on call order
+    HAL_PWR_EnableBkUpAccess();
+
+    Watchdog_ReportPostMortem();
+
+    // Fresh runtime marker: no fault, no task yet
+    *Watchdog_BkpReg(WDG_BKP_MARKER) = WDG_MARKER_MAGIC | 0xFF;
+
+    // LSI ~32 kHz / 64 = 500 Hz; reload 2000 -> ~4 s timeout. Generous
+    // against the slowest legitimate pass (SD re-init, flash commits)
+    // while still catching a wedge within seconds.
+    hiwdg1.Instance = IWDG1;
+    hiwdg1.Init.Prescaler = IWDG_PRESCALER_64;
+    hiwdg1.Init.Reload = 2000;
+    hiwdg1.Init.Window = IWDG_WINDOW_DISABLE;
+
+    if (HAL_IWDG_Init(&hiwdg1) != HAL_OK) {
+        Send_Debug_Data("Watchdog: IWDG start FAILED\r\n");
+        return 0;
+    }
+
+    watchdog_running = 1;
+    Send_Debug_Data("Watchdog: IWDG armed (4s, task-aliveness gated)\r\n");
+    return 1;
+}
+
+void Watchdog_ExpectTask(uint8_t task_id)
+{
+    if (task_id < 32) {
+        expected_mask |= (1UL << task_id);
+    }
+}
+
+void Watchdog_TaskAlive(uint8_t task_id)
+{
+    if (task_id < 32) {
+        alive_mask |= (1UL << task_id);
+    }
+
+    // Mirror into backup RAM so a wedge names its task after the reset
+    if (task_id != last_task_id) {
+        last_task_id = task_id;
+        *Watchdog_BkpReg(WDG_BKP_MARKER) = WDG_MARKER_MAGIC | task_id;
+    }
+}
+
+void Watchdog_Process(void)
+{
+    if (!watchdog_running) {
+        return;
+    }
+
+    if ((alive_mask & expected_mask) == expected_mask) {
+        alive_mask = 0;
+        kick_count++;
+        HAL_IWDG_Refresh(&hiwdg1);
+    } else {
+        // Some critical task has not run since the last kick. Do NOT
+        // refresh - if it stays away, the IWDG does its job.
+        starved_passes++;
+    }
+}
+
+void Watchdog_FaultCapture(uint32_t *stacked_frame, uint32_t fault_type)
+{
+    // Interrupt context, system state unknown - raw register writes only
+    *Watchdog_BkpReg(WDG_BKP_MARKER) = WDG_MARKER_MAGIC |
+                                       ((fault_type & 0xFF) << 8) | last_task_id;
+    if (stacked_frame != 0) {
+        *Watchdog_BkpReg(WDG_BKP_PC) = stacked_frame[6];
+        *Watchdog_BkpReg(WDG_BKP_LR) = stacked_frame[5];
+    }
+    *Watchdog_BkpReg(WDG_BKP_CYCCNT) = DWT->CYCCNT;
+
+    // Wait for the IWDG (or debugger). Spinning keeps the fault state
+    // intact for a live debug session; in the field the reset comes
+    // within the watchdog timeout.
+    while (1) {
+    }
+}
+
+void Watchdog_PrintStatus(void)
+{
+    char msg[140];
+
+    Send_Debug_Data("\r\n=== Watchdog ===\r\n");
+    snprintf(msg, sizeof(msg), "State: %s, kicks=%lu, starved passes=%lu\r\n",
+             watchdog_running ? "ARMED" : "OFF", kick_count, starved_passes);
+    Send_Debug_Data(msg);
+    snprintf(msg, sizeof(msg), "Expected mask: 0x%08lX, alive since kick: 0x%08lX\r\n",
+             expected_mask, alive_mask);
+    Send_Debug_Data(msg);
+    snprintf(msg, sizeof(msg), "Last task: %u\r\n", last_task_id);
+    Send_Debug_Data(msg);
+    Send_Debug_Data("================\r\n\r\n");
+}